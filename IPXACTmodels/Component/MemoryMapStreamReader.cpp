@@ -0,0 +1,694 @@
+//-----------------------------------------------------------------------------
+// File: MemoryMapStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Reader for creating memory maps directly from an XML stream.
+//-----------------------------------------------------------------------------
+
+#include "MemoryMapStreamReader.h"
+
+#include "AddressBlock.h"
+#include "AlternateRegister.h"
+#include "EnumeratedValueReader.h"
+#include "Field.h"
+#include "FieldReset.h"
+#include "MemoryMap.h"
+#include "MemoryRemap.h"
+#include "Register.h"
+#include "RegisterFile.h"
+#include "SubSpaceMap.h"
+#include "SubspaceMapReader.h"
+#include "WriteValueConstraint.h"
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::MemoryMapStreamReader()
+//-----------------------------------------------------------------------------
+MemoryMapStreamReader::MemoryMapStreamReader(): CommonItemsStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createMemoryMapFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryMap> MemoryMapStreamReader::createMemoryMapFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<MemoryMap> newMemoryMap(new MemoryMap());
+    QDomElement delegated = createDelegatedElements();
+
+    SubspaceMapReader subspaceMapReader;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (readMemoryMapBaseElement(reader, newMemoryMap))
+        {
+            continue;
+        }
+        else if (elementName == QLatin1String("ipxact:subspaceMap"))
+        {
+            QDomElement subspaceMapElement = readDomElement(reader, createDelegatedElements());
+            newMemoryMap->getMemoryBlocks()->append(subspaceMapReader.createSubspaceMapFrom(subspaceMapElement));
+        }
+        else if (elementName == QLatin1String("ipxact:memoryRemap"))
+        {
+            newMemoryMap->getMemoryRemaps()->append(createMemoryRemapFrom(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:addressUnitBits"))
+        {
+            newMemoryMap->setAddressUnitBits(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:shared"))
+        {
+            QString sharedValue = readElementText(reader);
+            if (sharedValue == QLatin1String("yes"))
+            {
+                newMemoryMap->setShared(true);
+            }
+            else if (sharedValue == QLatin1String("no"))
+            {
+                newMemoryMap->setShared(false);
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:vendorExtensions"))
+        {
+            readDomElement(reader, delegated);
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    parseVendorExtensions(delegated, newMemoryMap);
+
+    return newMemoryMap;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readMemoryMapBaseElement()
+//-----------------------------------------------------------------------------
+bool MemoryMapStreamReader::readMemoryMapBaseElement(QXmlStreamReader& reader,
+    QSharedPointer<MemoryMapBase> memoryMapBase)
+{
+    if (readNameGroupElement(reader, memoryMapBase))
+    {
+        return true;
+    }
+
+    QStringRef elementName = reader.qualifiedName();
+    if (elementName == QLatin1String("ipxact:isPresent"))
+    {
+        memoryMapBase->setIsPresent(readElementText(reader));
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:addressBlock"))
+    {
+        memoryMapBase->getMemoryBlocks()->append(createAddressBlockFrom(reader));
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createMemoryRemapFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryRemap> MemoryMapStreamReader::createMemoryRemapFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<MemoryRemap> newMemoryRemap(new MemoryRemap());
+    newMemoryRemap->setRemapState(reader.attributes().value(QLatin1String("state")).toString());
+
+    // Like in MemoryMapReader, only the address blocks of a remap are read.
+    while (readNextChildElement(reader))
+    {
+        if (readMemoryMapBaseElement(reader, newMemoryRemap) == false)
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    return newMemoryRemap;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createAddressBlockFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<AddressBlock> MemoryMapStreamReader::createAddressBlockFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<AddressBlock> newAddressBlock(new AddressBlock());
+    QDomElement delegated = createDelegatedElements();
+
+    QString range;
+    QString width;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (readNameGroupElement(reader, newAddressBlock))
+        {
+            continue;
+        }
+        else if (elementName == QLatin1String("ipxact:isPresent"))
+        {
+            newAddressBlock->setIsPresent(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:baseAddress"))
+        {
+            newAddressBlock->setBaseAddress(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:typeIdentifier"))
+        {
+            newAddressBlock->setTypeIdentifier(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:range"))
+        {
+            range = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:width"))
+        {
+            width = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:usage"))
+        {
+            newAddressBlock->setUsage(General::str2Usage(readElementText(reader), General::USAGE_COUNT));
+        }
+        else if (elementName == QLatin1String("ipxact:volatile"))
+        {
+            QString volatileString = readElementText(reader);
+            if (volatileString == QLatin1String("true"))
+            {
+                newAddressBlock->setVolatile(true);
+            }
+            else if (volatileString == QLatin1String("false"))
+            {
+                newAddressBlock->setVolatile(false);
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:access"))
+        {
+            newAddressBlock->setAccess(
+                AccessTypes::str2Access(readElementText(reader), AccessTypes::ACCESS_COUNT));
+        }
+        else if (elementName == QLatin1String("ipxact:register"))
+        {
+            newAddressBlock->getRegisterData()->append(createRegisterFrom(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:registerFile"))
+        {
+            newAddressBlock->getRegisterData()->append(createRegisterFileFrom(reader));
+        }
+        else if (isDelegatedElement(reader))
+        {
+            readDomElement(reader, delegated);
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newAddressBlock->setRange(range);
+    newAddressBlock->setWidth(width);
+
+    QSharedPointer<QList<QSharedPointer<Parameter> > > newParameters = parseAndCreateParameters(delegated);
+    if (!newParameters->isEmpty())
+    {
+        newAddressBlock->setParameters(newParameters);
+    }
+
+    parseVendorExtensions(delegated, newAddressBlock);
+
+    return newAddressBlock;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readRegisterBaseElement()
+//-----------------------------------------------------------------------------
+bool MemoryMapStreamReader::readRegisterBaseElement(QXmlStreamReader& reader,
+    QSharedPointer<RegisterBase> registerBase, QDomElement& delegated)
+{
+    if (readNameGroupElement(reader, registerBase))
+    {
+        return true;
+    }
+
+    QStringRef elementName = reader.qualifiedName();
+    if (elementName == QLatin1String("ipxact:isPresent"))
+    {
+        QString isPresent = readElementText(reader);
+        if (!isPresent.isEmpty())
+        {
+            registerBase->setIsPresent(isPresent);
+        }
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:typeIdentifier"))
+    {
+        registerBase->setTypeIdentifier(readElementText(reader));
+        return true;
+    }
+    else if (isDelegatedElement(reader))
+    {
+        readDomElement(reader, delegated);
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readRegisterDefinitionElement()
+//-----------------------------------------------------------------------------
+bool MemoryMapStreamReader::readRegisterDefinitionElement(QXmlStreamReader& reader,
+    QSharedPointer<RegisterDefinition> registerDefinition)
+{
+    QStringRef elementName = reader.qualifiedName();
+    if (elementName == QLatin1String("ipxact:volatile"))
+    {
+        registerDefinition->setVolatile(readElementText(reader) == QLatin1String("true"));
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:access"))
+    {
+        registerDefinition->setAccess(AccessTypes::str2Access(readElementText(reader), AccessTypes::ACCESS_COUNT));
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:field"))
+    {
+        registerDefinition->getFields()->append(createFieldFrom(reader));
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readDelegatedElements()
+//-----------------------------------------------------------------------------
+void MemoryMapStreamReader::readDelegatedElements(QDomElement const& delegated,
+    QSharedPointer<RegisterBase> registerBase) const
+{
+    QSharedPointer<QList<QSharedPointer<Parameter> > > newParameters = parseAndCreateParameters(delegated);
+    if (!newParameters->isEmpty())
+    {
+        registerBase->setParameters(newParameters);
+    }
+
+    parseVendorExtensions(delegated, registerBase);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createRegisterFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Register> MemoryMapStreamReader::createRegisterFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<Register> newRegister(new Register());
+    QDomElement delegated = createDelegatedElements();
+
+    QString addressOffset;
+    QString size;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (readRegisterBaseElement(reader, newRegister, delegated) ||
+            readRegisterDefinitionElement(reader, newRegister))
+        {
+            continue;
+        }
+        else if (elementName == QLatin1String("ipxact:dim"))
+        {
+            newRegister->setDimension(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:addressOffset"))
+        {
+            addressOffset = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:size"))
+        {
+            size = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:alternateRegisters"))
+        {
+            while (readNextChildElement(reader))
+            {
+                if (reader.qualifiedName() == QLatin1String("ipxact:alternateRegister"))
+                {
+                    newRegister->getAlternateRegisters()->append(createAlternateRegisterFrom(reader));
+                }
+                else
+                {
+                    reader.skipCurrentElement();
+                }
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newRegister->setAddressOffset(addressOffset);
+    newRegister->setSize(size);
+
+    readDelegatedElements(delegated, newRegister);
+
+    return newRegister;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createRegisterFileFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<RegisterFile> MemoryMapStreamReader::createRegisterFileFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<RegisterFile> newRegisterFile(new RegisterFile());
+    QDomElement delegated = createDelegatedElements();
+
+    QString addressOffset;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (readRegisterBaseElement(reader, newRegisterFile, delegated))
+        {
+            continue;
+        }
+        else if (elementName == QLatin1String("ipxact:dim"))
+        {
+            newRegisterFile->setDimension(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:addressOffset"))
+        {
+            addressOffset = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:range"))
+        {
+            newRegisterFile->setRange(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:register"))
+        {
+            newRegisterFile->getRegisterData()->append(createRegisterFrom(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:registerFile"))
+        {
+            newRegisterFile->getRegisterData()->append(createRegisterFileFrom(reader));
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newRegisterFile->setAddressOffset(addressOffset);
+
+    readDelegatedElements(delegated, newRegisterFile);
+
+    return newRegisterFile;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createAlternateRegisterFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<AlternateRegister> MemoryMapStreamReader::createAlternateRegisterFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<AlternateRegister> newAlternateRegister(new AlternateRegister());
+    QDomElement delegated = createDelegatedElements();
+
+    while (readNextChildElement(reader))
+    {
+        if (readRegisterBaseElement(reader, newAlternateRegister, delegated) ||
+            readRegisterDefinitionElement(reader, newAlternateRegister))
+        {
+            continue;
+        }
+        else if (reader.qualifiedName() == QLatin1String("ipxact:alternateGroups"))
+        {
+            while (readNextChildElement(reader))
+            {
+                if (reader.qualifiedName() == QLatin1String("ipxact:alternateGroup"))
+                {
+                    newAlternateRegister->getAlternateGroups()->append(readElementText(reader));
+                }
+                else
+                {
+                    reader.skipCurrentElement();
+                }
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    readDelegatedElements(delegated, newAlternateRegister);
+
+    return newAlternateRegister;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::createFieldFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Field> MemoryMapStreamReader::createFieldFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<Field> newField(new Field());
+    QDomElement delegated = createDelegatedElements();
+
+    if (reader.attributes().hasAttribute(QLatin1String("fieldID")))
+    {
+        newField->setId(reader.attributes().value(QLatin1String("fieldID")).toString());
+    }
+
+    QString bitOffset;
+    QString bitWidth;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (readNameGroupElement(reader, newField))
+        {
+            continue;
+        }
+        else if (elementName == QLatin1String("ipxact:isPresent"))
+        {
+            QString isPresent = readElementText(reader);
+            if (!isPresent.isEmpty())
+            {
+                newField->setIsPresent(isPresent);
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:bitOffset"))
+        {
+            bitOffset = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:resets"))
+        {
+            readResets(reader, newField);
+        }
+        else if (elementName == QLatin1String("ipxact:typeIdentifier"))
+        {
+            newField->setTypeIdentifier(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:bitWidth"))
+        {
+            bitWidth = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:volatile"))
+        {
+            newField->setVolatile(readElementText(reader) == QLatin1String("true"));
+        }
+        else if (elementName == QLatin1String("ipxact:access"))
+        {
+            newField->setAccess(AccessTypes::str2Access(readElementText(reader), AccessTypes::ACCESS_COUNT));
+        }
+        else if (elementName == QLatin1String("ipxact:enumeratedValues"))
+        {
+            readEnumeratedValues(reader, newField);
+        }
+        else if (elementName == QLatin1String("ipxact:modifiedWriteValue"))
+        {
+            QXmlStreamAttributes attributes = reader.attributes();
+
+            newField->setModifiedWrite(General::str2ModifiedWrite(readElementText(reader)));
+            if (attributes.hasAttribute(QLatin1String("modify")))
+            {
+                newField->setModifiedWriteModify(attributes.value(QLatin1String("modify")).toString());
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:writeValueConstraint"))
+        {
+            readWriteValueConstraint(reader, newField);
+        }
+        else if (elementName == QLatin1String("ipxact:readAction"))
+        {
+            QXmlStreamAttributes attributes = reader.attributes();
+
+            newField->setReadAction(General::str2ReadAction(readElementText(reader)));
+            if (attributes.hasAttribute(QLatin1String("modify")))
+            {
+                newField->setReadActionModify(attributes.value(QLatin1String("modify")).toString());
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:testable"))
+        {
+            QXmlStreamAttributes attributes = reader.attributes();
+
+            newField->setTestable(readElementText(reader) == QLatin1String("true"));
+            if (attributes.hasAttribute(QLatin1String("testConstraint")))
+            {
+                newField->setTestConstraint(General::str2TestConstraint(
+                    attributes.value(QLatin1String("testConstraint")).toString()));
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:reserved"))
+        {
+            newField->setReserved(readElementText(reader));
+        }
+        else if (isDelegatedElement(reader))
+        {
+            readDomElement(reader, delegated);
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newField->setBitOffset(bitOffset);
+    newField->setBitWidth(bitWidth);
+
+    newField->getParameters()->append(*parseAndCreateParameters(delegated));
+
+    parseVendorExtensions(delegated, newField);
+
+    return newField;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readResets()
+//-----------------------------------------------------------------------------
+void MemoryMapStreamReader::readResets(QXmlStreamReader& reader, QSharedPointer<Field> newField)
+{
+    while (readNextChildElement(reader))
+    {
+        if (reader.qualifiedName() != QLatin1String("ipxact:reset"))
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        QSharedPointer<FieldReset> newReset(new FieldReset());
+        if (reader.attributes().hasAttribute(QLatin1String("resetTypeRef")))
+        {
+            newReset->setResetTypeReference(reader.attributes().value(QLatin1String("resetTypeRef")).toString());
+        }
+
+        QString resetValue;
+        while (readNextChildElement(reader))
+        {
+            if (reader.qualifiedName() == QLatin1String("ipxact:value"))
+            {
+                resetValue = readElementText(reader);
+            }
+            else if (reader.qualifiedName() == QLatin1String("ipxact:mask"))
+            {
+                newReset->setResetMask(readElementText(reader));
+            }
+            else
+            {
+                reader.skipCurrentElement();
+            }
+        }
+
+        newReset->setResetValue(resetValue);
+        newField->getResets()->append(newReset);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readEnumeratedValues()
+//-----------------------------------------------------------------------------
+void MemoryMapStreamReader::readEnumeratedValues(QXmlStreamReader& reader, QSharedPointer<Field> newField)
+{
+    EnumeratedValueReader enumerationReader;
+
+    while (readNextChildElement(reader))
+    {
+        if (reader.qualifiedName() == QLatin1String("ipxact:enumeratedValue"))
+        {
+            QDomElement enumerationElement = readDomElement(reader, createDelegatedElements());
+            newField->getEnumeratedValues()->append(
+                enumerationReader.createEnumeratedValueFrom(enumerationElement));
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapStreamReader::readWriteValueConstraint()
+//-----------------------------------------------------------------------------
+void MemoryMapStreamReader::readWriteValueConstraint(QXmlStreamReader& reader, QSharedPointer<Field> newField)
+{
+    QSharedPointer<WriteValueConstraint> writeConstraint(new WriteValueConstraint());
+
+    bool writeAsRead = false;
+    bool useEnumeratedValues = false;
+    QString minimum;
+    QString maximum;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+        if (elementName == QLatin1String("ipxact:writeAsRead"))
+        {
+            writeAsRead = true;
+            reader.skipCurrentElement();
+        }
+        else if (elementName == QLatin1String("ipxact:useEnumeratedValues"))
+        {
+            useEnumeratedValues = true;
+            reader.skipCurrentElement();
+        }
+        else if (elementName == QLatin1String("ipxact:minimum"))
+        {
+            minimum = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:maximum"))
+        {
+            maximum = readElementText(reader);
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    if (writeAsRead)
+    {
+        writeConstraint->setType(WriteValueConstraint::WRITE_AS_READ);
+    }
+    else if (useEnumeratedValues)
+    {
+        writeConstraint->setType(WriteValueConstraint::USE_ENUM);
+    }
+    else
+    {
+        writeConstraint->setMinimum(minimum);
+        writeConstraint->setMaximum(maximum);
+    }
+
+    newField->setWriteConstraint(writeConstraint);
+}
@@ -0,0 +1,185 @@
+//-----------------------------------------------------------------------------
+// File: MemoryMapStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Reader for creating memory maps directly from an XML stream.
+//-----------------------------------------------------------------------------
+
+#ifndef MEMORYMAPSTREAMREADER_H
+#define MEMORYMAPSTREAMREADER_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <IPXACTmodels/common/CommonItemsStreamReader.h>
+
+#include <QSharedPointer>
+#include <QXmlStreamReader>
+
+class AddressBlock;
+class AlternateRegister;
+class Field;
+class MemoryMap;
+class MemoryMapBase;
+class MemoryRemap;
+class Register;
+class RegisterBase;
+class RegisterDefinition;
+class RegisterFile;
+
+//-----------------------------------------------------------------------------
+//! Reader for creating memory maps directly from an XML stream.
+//
+// The created memory maps are identical to the ones created by MemoryMapReader, but the address blocks,
+// registers and fields are created without building their DOM first.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT MemoryMapStreamReader : public CommonItemsStreamReader
+{
+public:
+
+    //! The constructor.
+    MemoryMapStreamReader();
+
+    //! The destructor.
+    virtual ~MemoryMapStreamReader() = default;
+
+    //! No copying allowed.
+    MemoryMapStreamReader(MemoryMapStreamReader const& rhs) = delete;
+    MemoryMapStreamReader& operator=(MemoryMapStreamReader const& rhs) = delete;
+
+    /*!
+     *  Creates a new memory map from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:memoryMap element.
+     *                          The stream is left at the end of the element.
+     *
+     *      @return The created memory map.
+     */
+    QSharedPointer<MemoryMap> createMemoryMapFrom(QXmlStreamReader& reader);
+
+private:
+
+    /*!
+     *  Reads the current element, if it is common to memory maps and memory remaps.
+     *
+     *      @param [in] reader          The stream positioned at the start of the element.
+     *      @param [in] memoryMapBase   The memory map or remap being read.
+     *
+     *      @return True, if the element was read, otherwise false.
+     */
+    bool readMemoryMapBaseElement(QXmlStreamReader& reader, QSharedPointer<MemoryMapBase> memoryMapBase);
+
+    /*!
+     *  Creates a memory remap from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:memoryRemap element.
+     *
+     *      @return The created memory remap.
+     */
+    QSharedPointer<MemoryRemap> createMemoryRemapFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Creates an address block from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:addressBlock element.
+     *
+     *      @return The created address block.
+     */
+    QSharedPointer<AddressBlock> createAddressBlockFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Reads the current element, if it is common to registers, register files and alternate registers.
+     *
+     *      @param [in] reader          The stream positioned at the start of the element.
+     *      @param [in] registerBase    The item being read.
+     *      @param [in] delegated       The element collecting the child elements for the DOM readers.
+     *
+     *      @return True, if the element was read, otherwise false.
+     */
+    bool readRegisterBaseElement(QXmlStreamReader& reader, QSharedPointer<RegisterBase> registerBase,
+        QDomElement& delegated);
+
+    /*!
+     *  Reads the current element, if it is common to registers and alternate registers.
+     *
+     *      @param [in] reader              The stream positioned at the start of the element.
+     *      @param [in] registerDefinition  The item being read.
+     *
+     *      @return True, if the element was read, otherwise false.
+     */
+    bool readRegisterDefinitionElement(QXmlStreamReader& reader,
+        QSharedPointer<RegisterDefinition> registerDefinition);
+
+    /*!
+     *  Sets the parameters and vendor extensions read by the DOM readers.
+     *
+     *      @param [in] delegated       The collected child elements for the DOM readers.
+     *      @param [in] registerBase    The item receiving the parameters and vendor extensions.
+     */
+    void readDelegatedElements(QDomElement const& delegated, QSharedPointer<RegisterBase> registerBase) const;
+
+    /*!
+     *  Creates a register from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:register element.
+     *
+     *      @return The created register.
+     */
+    QSharedPointer<Register> createRegisterFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Creates a register file from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:registerFile element.
+     *
+     *      @return The created register file.
+     */
+    QSharedPointer<RegisterFile> createRegisterFileFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Creates an alternate register from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:alternateRegister element.
+     *
+     *      @return The created alternate register.
+     */
+    QSharedPointer<AlternateRegister> createAlternateRegisterFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Creates a field from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:field element.
+     *
+     *      @return The created field.
+     */
+    QSharedPointer<Field> createFieldFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Reads the resets of a field.
+     *
+     *      @param [in] reader      The stream positioned at the start of the ipxact:resets element.
+     *      @param [in] newField    The field receiving the resets.
+     */
+    void readResets(QXmlStreamReader& reader, QSharedPointer<Field> newField);
+
+    /*!
+     *  Reads the enumerated values of a field.
+     *
+     *      @param [in] reader      The stream positioned at the start of the ipxact:enumeratedValues element.
+     *      @param [in] newField    The field receiving the enumerated values.
+     */
+    void readEnumeratedValues(QXmlStreamReader& reader, QSharedPointer<Field> newField);
+
+    /*!
+     *  Reads the write value constraint of a field.
+     *
+     *      @param [in] reader      The stream positioned at the start of the ipxact:writeValueConstraint element.
+     *      @param [in] newField    The field receiving the constraint.
+     */
+    void readWriteValueConstraint(QXmlStreamReader& reader, QSharedPointer<Field> newField);
+};
+
+#endif // MEMORYMAPSTREAMREADER_H
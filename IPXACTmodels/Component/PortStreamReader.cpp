@@ -0,0 +1,376 @@
+//-----------------------------------------------------------------------------
+// File: PortStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Reader for creating ports directly from an XML stream.
+//-----------------------------------------------------------------------------
+
+#include "PortStreamReader.h"
+
+#include <IPXACTmodels/common/ProtocolReader.h>
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::PortStreamReader()
+//-----------------------------------------------------------------------------
+PortStreamReader::PortStreamReader(): CommonItemsStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::createPortFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Port> PortStreamReader::createPortFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<Port> newPort(new Port());
+    QDomElement delegated = createDelegatedElements();
+
+    QString isPresent;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (readNameGroupElement(reader, newPort))
+        {
+            continue;
+        }
+        else if (elementName == QLatin1String("ipxact:isPresent"))
+        {
+            isPresent = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:wire"))
+        {
+            newPort->setWire(createWireFrom(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:transactional"))
+        {
+            newPort->setTransactional(createTransactionalFrom(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:arrays"))
+        {
+            readArrays(reader, newPort);
+        }
+        else if (elementName == QLatin1String("ipxact:vendorExtensions"))
+        {
+            readDomElement(reader, delegated);
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newPort->setIsPresent(isPresent);
+
+    readPortExtensions(delegated, newPort);
+
+    return newPort;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::createWireFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Wire> PortStreamReader::createWireFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<Wire> newWire(new Wire());
+
+    if (!reader.attributes().value(QLatin1String("allLogicalDirectionsAllowed")).isEmpty())
+    {
+        newWire->setAllLogicalDirectionsAllowed(true);
+    }
+
+    QString direction;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (elementName == QLatin1String("ipxact:direction"))
+        {
+            direction = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:vectors"))
+        {
+            while (readNextChildElement(reader))
+            {
+                if (reader.qualifiedName() != QLatin1String("ipxact:vector"))
+                {
+                    reader.skipCurrentElement();
+                    continue;
+                }
+
+                QString left;
+                QString right;
+                while (readNextChildElement(reader))
+                {
+                    if (reader.qualifiedName() == QLatin1String("ipxact:left"))
+                    {
+                        left = readElementText(reader);
+                    }
+                    else if (reader.qualifiedName() == QLatin1String("ipxact:right"))
+                    {
+                        right = readElementText(reader);
+                    }
+                    else
+                    {
+                        reader.skipCurrentElement();
+                    }
+                }
+
+                newWire->setVectorLeftBound(left);
+                newWire->setVectorRightBound(right);
+            }
+        }
+        else if (elementName == QLatin1String("ipxact:wireTypeDefs"))
+        {
+            newWire->setWireTypeDefs(readTypeDefinitions(reader, QLatin1String("ipxact:wireTypeDef"),
+                QLatin1String("constrained")));
+        }
+        else if (elementName == QLatin1String("ipxact:drivers"))
+        {
+            while (readNextChildElement(reader))
+            {
+                if (reader.qualifiedName() != QLatin1String("ipxact:driver"))
+                {
+                    reader.skipCurrentElement();
+                    continue;
+                }
+
+                QString defaultValue;
+                while (readNextChildElement(reader))
+                {
+                    if (reader.qualifiedName() == QLatin1String("ipxact:defaultValue"))
+                    {
+                        defaultValue = readElementText(reader);
+                    }
+                    else
+                    {
+                        reader.skipCurrentElement();
+                    }
+                }
+
+                newWire->setDefaultDriverValue(defaultValue);
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newWire->setDirection(DirectionTypes::str2Direction(direction, DirectionTypes::IN));
+
+    return newWire;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::createTransactionalFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Transactional> PortStreamReader::createTransactionalFrom(QXmlStreamReader& reader)
+{
+    QSharedPointer<Transactional> newTransactional(new Transactional());
+
+    if (!reader.attributes().value(QLatin1String("allLogicalInitiativesAllowed")).isEmpty())
+    {
+        newTransactional->setAllLogicalInitiativesAllowed(true);
+    }
+
+    QString initiative;
+
+    while (readNextChildElement(reader))
+    {
+        QStringRef elementName = reader.qualifiedName();
+
+        if (elementName == QLatin1String("ipxact:initiative"))
+        {
+            initiative = readElementText(reader);
+        }
+        else if (elementName == QLatin1String("ipxact:kind"))
+        {
+            QString customKind = reader.attributes().value(QLatin1String("custom")).toString();
+            bool hasCustomKind = reader.attributes().hasAttribute(QLatin1String("custom"));
+
+            QString transactionalKind = readElementText(reader);
+            if (transactionalKind == QLatin1String("custom") && hasCustomKind)
+            {
+                transactionalKind = customKind;
+            }
+            newTransactional->setKind(transactionalKind);
+        }
+        else if (elementName == QLatin1String("ipxact:busWidth"))
+        {
+            newTransactional->setBusWidth(readElementText(reader));
+        }
+        else if (elementName == QLatin1String("ipxact:protocol"))
+        {
+            ProtocolReader protocolReader;
+            newTransactional->setProtocol(
+                protocolReader.createProtocolFrom(readDomElement(reader, createDelegatedElements())));
+        }
+        else if (elementName == QLatin1String("ipxact:transTypeDefs"))
+        {
+            newTransactional->setTransTypeDefs(readTypeDefinitions(reader, QLatin1String("ipxact:transTypeDef"),
+                QLatin1String("exact")));
+        }
+        else if (elementName == QLatin1String("ipxact:connection"))
+        {
+            while (readNextChildElement(reader))
+            {
+                if (reader.qualifiedName() == QLatin1String("ipxact:maxConnections"))
+                {
+                    newTransactional->setMaxConnections(readElementText(reader));
+                }
+                else if (reader.qualifiedName() == QLatin1String("ipxact:minConnections"))
+                {
+                    newTransactional->setMinConnections(readElementText(reader));
+                }
+                else
+                {
+                    reader.skipCurrentElement();
+                }
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    newTransactional->setInitiative(initiative);
+
+    return newTransactional;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::readTypeDefinitions()
+//-----------------------------------------------------------------------------
+QSharedPointer<QList<QSharedPointer<WireTypeDef> > > PortStreamReader::readTypeDefinitions(
+    QXmlStreamReader& reader, QLatin1String const& elementName, QLatin1String const& attributeName)
+{
+    QSharedPointer<QList<QSharedPointer<WireTypeDef> > > typeDefinitions(new QList<QSharedPointer<WireTypeDef> >());
+
+    while (readNextChildElement(reader))
+    {
+        if (reader.qualifiedName() != elementName)
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        QString typeName;
+        bool constrained = false;
+        QSharedPointer<QStringList> definitionList(new QStringList());
+        QSharedPointer<QStringList> viewRefs(new QStringList());
+
+        while (readNextChildElement(reader))
+        {
+            QStringRef childName = reader.qualifiedName();
+            if (childName == QLatin1String("ipxact:typeName"))
+            {
+                constrained = !reader.attributes().value(attributeName).isEmpty();
+                typeName = readElementText(reader);
+            }
+            else if (childName == QLatin1String("ipxact:typeDefinition"))
+            {
+                definitionList->append(readElementText(reader));
+            }
+            else if (childName == QLatin1String("ipxact:viewRef"))
+            {
+                viewRefs->append(readElementText(reader));
+            }
+            else
+            {
+                reader.skipCurrentElement();
+            }
+        }
+
+        QSharedPointer<WireTypeDef> newWireTypeDefinition(new WireTypeDef(typeName));
+        if (constrained)
+        {
+            newWireTypeDefinition->setConstrained(true);
+        }
+
+        if (!definitionList->isEmpty())
+        {
+            newWireTypeDefinition->setTypeDefinitions(definitionList);
+        }
+
+        if (!viewRefs->isEmpty())
+        {
+            newWireTypeDefinition->setViewRefs(viewRefs);
+        }
+
+        typeDefinitions->append(newWireTypeDefinition);
+    }
+
+    return typeDefinitions;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::readArrays()
+//-----------------------------------------------------------------------------
+void PortStreamReader::readArrays(QXmlStreamReader& reader, QSharedPointer<Port> newPort)
+{
+    while (readNextChildElement(reader))
+    {
+        if (reader.qualifiedName() != QLatin1String("ipxact:array"))
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        QString arrayLeft;
+        QString arrayRight;
+        while (readNextChildElement(reader))
+        {
+            if (reader.qualifiedName() == QLatin1String("ipxact:left"))
+            {
+                arrayLeft = readElementText(reader);
+            }
+            else if (reader.qualifiedName() == QLatin1String("ipxact:right"))
+            {
+                arrayRight = readElementText(reader);
+            }
+            else
+            {
+                reader.skipCurrentElement();
+            }
+        }
+
+        newPort->getArrays()->append(QSharedPointer<Array>(new Array(arrayLeft, arrayRight)));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortStreamReader::readPortExtensions()
+//-----------------------------------------------------------------------------
+void PortStreamReader::readPortExtensions(QDomElement const& delegated, QSharedPointer<Port> newPort) const
+{
+    QDomElement extensionsNode = delegated.firstChildElement(QStringLiteral("ipxact:vendorExtensions"));
+
+    if (!extensionsNode.firstChildElement(QStringLiteral("kactus2:adHocVisible")).isNull())
+    {
+        newPort->setAdHocVisible(true);
+    }
+
+    QDomElement positionElement = extensionsNode.firstChildElement(QStringLiteral("kactus2:position"));
+    if (!positionElement.isNull())
+    {
+        int positionX = positionElement.attribute(QStringLiteral("x")).toInt();
+        int positionY = positionElement.attribute(QStringLiteral("y")).toInt();
+        newPort->setDefaultPos(QPointF(positionX, positionY));
+    }
+
+    QDomElement tagsElement = extensionsNode.firstChildElement(QStringLiteral("kactus2:portTags"));
+    if (!tagsElement.isNull())
+    {
+        newPort->setPortTags(tagsElement.firstChild().nodeValue());
+    }
+
+    parseVendorExtensions(delegated, newPort);
+}
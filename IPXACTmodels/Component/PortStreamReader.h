@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// File: PortStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Reader for creating ports directly from an XML stream.
+//-----------------------------------------------------------------------------
+
+#ifndef PORTSTREAMREADER_H
+#define PORTSTREAMREADER_H
+
+#include "Port.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <IPXACTmodels/common/CommonItemsStreamReader.h>
+
+#include <QSharedPointer>
+#include <QXmlStreamReader>
+
+//-----------------------------------------------------------------------------
+//! Reader for creating ports directly from an XML stream.
+//
+// The created ports are identical to the ones created by PortReader, without building their DOM first.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT PortStreamReader : public CommonItemsStreamReader
+{
+public:
+
+    //! The constructor.
+    PortStreamReader();
+
+    //! The destructor.
+    virtual ~PortStreamReader() = default;
+
+    //! No copying allowed.
+    PortStreamReader(PortStreamReader const& rhs) = delete;
+    PortStreamReader& operator=(PortStreamReader const& rhs) = delete;
+
+    /*!
+     *  Creates a new port from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:port element.
+     *                          The stream is left at the end of the element.
+     *
+     *      @return The created port.
+     */
+    QSharedPointer<Port> createPortFrom(QXmlStreamReader& reader);
+
+private:
+
+    /*!
+     *  Creates a wire from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:wire element.
+     *
+     *      @return The created wire.
+     */
+    QSharedPointer<Wire> createWireFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Creates a transactional from the stream.
+     *
+     *      @param [in] reader  The stream positioned at the start of the ipxact:transactional element.
+     *
+     *      @return The created transactional.
+     */
+    QSharedPointer<Transactional> createTransactionalFrom(QXmlStreamReader& reader);
+
+    /*!
+     *  Reads the wire or transactional type definitions.
+     *
+     *      @param [in] reader          The stream positioned at the start of the type definitions element.
+     *      @param [in] elementName     The name of a single type definition element.
+     *      @param [in] attributeName   The name of the type name attribute marking a constrained type.
+     *
+     *      @return The read type definitions.
+     */
+    QSharedPointer<QList<QSharedPointer<WireTypeDef> > > readTypeDefinitions(QXmlStreamReader& reader,
+        QLatin1String const& elementName, QLatin1String const& attributeName);
+
+    /*!
+     *  Reads the arrays of a port.
+     *
+     *      @param [in] reader      The stream positioned at the start of the ipxact:arrays element.
+     *      @param [in] newPort     The port receiving the arrays.
+     */
+    void readArrays(QXmlStreamReader& reader, QSharedPointer<Port> newPort);
+
+    /*!
+     *  Reads the Kactus2 and generic vendor extensions of a port.
+     *
+     *      @param [in] delegated   The collected vendor extensions.
+     *      @param [in] newPort     The port receiving the extensions.
+     */
+    void readPortExtensions(QDomElement const& delegated, QSharedPointer<Port> newPort) const;
+};
+
+#endif // PORTSTREAMREADER_H
@@ -17,6 +17,7 @@
 #include <IPXACTmodels/Component/validators/RegisterValidator.h>
 #include <IPXACTmodels/Component/validators/RegisterFileValidator.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
+#include <IPXACTmodels/common/validators/ValidationCache.h>
 
 #include <IPXACTmodels/Component/AddressBlock.h>
 #include <IPXACTmodels/Component/RegisterBase.h>
@@ -24,7 +25,9 @@
 #include <IPXACTmodels/Component/Field.h>
 #include <IPXACTmodels/common/Parameter.h>
 
+#include <QHash>
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: AddressBlockValidator::AddressBlockValidator()
@@ -56,6 +59,23 @@ void AddressBlockValidator::componentChange(QSharedPointer<Component> newCompone
     registerValidator_->componentChange(newComponent);
 }
 
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::setValidationCache()
+//-----------------------------------------------------------------------------
+void AddressBlockValidator::setValidationCache(QSharedPointer<ValidationCache> cache)
+{
+    validationCache_ = cache;
+    registerValidator_->setValidationCache(cache);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::getValidationCache()
+//-----------------------------------------------------------------------------
+QSharedPointer<ValidationCache> AddressBlockValidator::getValidationCache() const
+{
+    return validationCache_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: AddressBlockValidator::getRegisterValidator()
 //-----------------------------------------------------------------------------
@@ -76,6 +96,21 @@ QSharedPointer<RegisterFileValidator> AddressBlockValidator::getRegisterFileVali
 //-----------------------------------------------------------------------------
 bool AddressBlockValidator::validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits)
     const
+{
+    if (validationCache_)
+    {
+        return validationCache_->validate(addressBlock, addressUnitBits,
+            [this, &addressBlock, &addressUnitBits]() { return validateAddressBlock(addressBlock, addressUnitBits); });
+    }
+
+    return validateAddressBlock(addressBlock, addressUnitBits);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::validateAddressBlock()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::validateAddressBlock(QSharedPointer<AddressBlock> addressBlock,
+    QString const& addressUnitBits) const
 {
     return MemoryBlockValidator::validate(addressBlock) &&
         hasValidRange(addressBlock) &&
@@ -114,9 +149,11 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
 {
     if (!addressBlock->getRegisterData()->isEmpty())
     {
-        QStringList registerNames;
+        QSet<QString> registerNames;
 
-        QStringList typeIdentifiers;
+        // Index of the first register with each type identifier, counted over the registers only.
+        QHash<QString, int> typeIdentifierIndexes;
+        int registerIndex = 0;
         MemoryReserve reservedArea;
 
         bool aubChangeOk = true;
@@ -139,9 +176,9 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
                 else
                 {
                     if (!targetRegister->getTypeIdentifier().isEmpty() &&
-                        typeIdentifiers.contains(targetRegister->getTypeIdentifier()))
+                        typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
                     {
-                        int typeIdentifierIndex = typeIdentifiers.indexOf(targetRegister->getTypeIdentifier());
+                        int typeIdentifierIndex = typeIdentifierIndexes.value(targetRegister->getTypeIdentifier());
                         if (!registersHaveSimilarDefinitionGroups(targetRegister, addressBlock,
                             typeIdentifierIndex))
                         {
@@ -171,8 +208,12 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
                         }
                     }
 
-                    registerNames.append(targetRegister->name());
-                    typeIdentifiers.append(targetRegister->getTypeIdentifier());
+                    registerNames.insert(targetRegister->name());
+                    if (!typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
+                    {
+                        typeIdentifierIndexes.insert(targetRegister->getTypeIdentifier(), registerIndex);
+                    }
+                    registerIndex++;
                 }
             }
         }
@@ -376,9 +417,12 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
 {
     if (!addressBlock->getRegisterData()->isEmpty())
     {
-        QStringList registerNames;
-        QStringList duplicateNames;
-        QStringList typeIdentifiers;
+        QSet<QString> registerNames;
+        QSet<QString> duplicateNames;
+
+        // Index of the first register with each type identifier, counted over the registers only.
+        QHash<QString, int> typeIdentifierIndexes;
+        int registerIndex = 0;
 
         MemoryReserve reservedArea;
         bool aubChangeOk = true;
@@ -395,11 +439,11 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                 {
                     errors.append(QObject::tr("Name %1 of registers in addressBlock %2 is not unique.")
                         .arg(targetRegister->name()).arg(addressBlock->name()));
-                    duplicateNames.append(targetRegister->name());
+                    duplicateNames.insert(targetRegister->name());
                 }
                 else
                 {
-                    registerNames.append(targetRegister->name());
+                    registerNames.insert(targetRegister->name());
                 }
 
                 registerValidator_->findErrorsIn(errors, targetRegister, context);
@@ -417,9 +461,9 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                 }
 
                 if (!targetRegister->getTypeIdentifier().isEmpty() &&
-                    typeIdentifiers.contains(targetRegister->getTypeIdentifier()))
+                    typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
                 {
-                    int typeIdentifierIndex = typeIdentifiers.indexOf(targetRegister->getTypeIdentifier());
+                    int typeIdentifierIndex = typeIdentifierIndexes.value(targetRegister->getTypeIdentifier());
 
                     if (!registersHaveSimilarDefinitionGroups(targetRegister, addressBlock, typeIdentifierIndex))
                     {
@@ -427,7 +471,12 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                             "similar register definitions within %1").arg(context));
                     }
                 }
-                typeIdentifiers.append(targetRegister->getTypeIdentifier());
+
+                if (!typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
+                {
+                    typeIdentifierIndexes.insert(targetRegister->getTypeIdentifier(), registerIndex);
+                }
+                registerIndex++;
 
                 if (!hasValidAccessWithRegister(addressBlock, targetRegister))
                 {
@@ -27,6 +27,7 @@ class Component;
 class RegisterValidator;
 class RegisterFileValidator;
 class ParameterValidator;
+class ValidationCache;
 
 //-----------------------------------------------------------------------------
 //! Validator for ipxact:addressBlock.
@@ -57,6 +58,20 @@ public:
      */
     void componentChange(QSharedPointer<Component> newComponent);
 
+    /*!
+     *  Set the cache for the validation results of the address blocks and their registers.
+     *
+     *      @param [in] cache   The cache to use, or null for validating without a cache.
+     */
+    void setValidationCache(QSharedPointer<ValidationCache> cache);
+
+    /*!
+     *  Get the cache for the validation results.
+     *
+     *      @return The used cache, or null if the results are not cached.
+     */
+    QSharedPointer<ValidationCache> getValidationCache() const;
+
     /*!
      *  Get the used register validator.
      *
@@ -153,6 +168,16 @@ public:
 
 private:
 
+    /*!
+     *  Validates the given address block without using the cache.
+     *
+     *      @param [in] addressBlock        The address block to validate.
+     *      @param [in] addressUnitBits     The address unit bits used by the memory map.
+     *
+     *      @return True, if the address block is valid IP-XACT, otherwise false.
+     */
+    bool validateAddressBlock(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits) const;
+
 	// Disable copying.
 	AddressBlockValidator(AddressBlockValidator const& rhs);
 	AddressBlockValidator& operator=(AddressBlockValidator const& rhs);
@@ -247,6 +272,9 @@ private:
 
     //! The validator used for register files.
     QSharedPointer<RegisterFileValidator> registerFileValidator_;
+
+    //! The cache for the validation results, if any.
+    QSharedPointer<ValidationCache> validationCache_;
 };
 
 #endif // ADDRESSBLOCKVALIDATOR_H
@@ -690,31 +690,55 @@ bool ComponentValidator::hasValidAssertions(QSharedPointer<Component> component)
 // Function: ComponentValidator::findErrorsIn()
 //-----------------------------------------------------------------------------
 void ComponentValidator::findErrorsIn(QVector<QString>& errors, QSharedPointer<Component> component)
+{
+    for (int group = INTERFACE_ELEMENTS; group < ELEMENT_GROUP_COUNT; ++group)
+    {
+        findErrorsIn(errors, component, static_cast<ElementGroup>(group));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidator::findErrorsIn()
+//-----------------------------------------------------------------------------
+void ComponentValidator::findErrorsIn(QVector<QString>& errors, QSharedPointer<Component> component,
+    ElementGroup group)
 {
     changeComponent(component);
 
     QString context = QObject::tr("component %1").arg(component->getVlnv().toString());
 
-    findErrorsInVLNV(errors, component);
-    findErrorsInBusInterface(errors, component, context);
-    findErrorsInIndirectInterfaces(errors, component, context);
-    findErrorsInChannels(errors, component, context);
-    findErrorsInRemapStates(errors, component, context);
-    findErrorsInAddressSpaces(errors, component, context);
-    findErrorsInMemoryMaps(errors, component, context);
-    findErrorsInViews(errors, component, context);
-    findErrorsInComponentInstantiations(errors, component, context);
-    findErrorsInDesignInstantiations(errors, component, context);
-    findErrorsInDesignConfigurationInstantiations(errors, component, context);
-    findErrorsInPorts(errors, component, context);
-    findErrorsInComponentGenerators(errors, component, context);
-    findErrorsInChoices(errors, component, context);
-    findErrorsInFileSets(errors, component, context);
-    findErrorsInCPUs(errors, component, context);
-    findErrorsInOtherClockDrivers(errors, component, context);
-    findErrorsInResetTypes(errors, component, context);
-    findErrorsInParameters(errors, component, context);
-    findErrorsInAssertions(errors, component, context);
+    if (group == INTERFACE_ELEMENTS)
+    {
+        findErrorsInVLNV(errors, component);
+        findErrorsInBusInterface(errors, component, context);
+        findErrorsInIndirectInterfaces(errors, component, context);
+        findErrorsInChannels(errors, component, context);
+        findErrorsInRemapStates(errors, component, context);
+    }
+    else if (group == MEMORY_ELEMENTS)
+    {
+        findErrorsInAddressSpaces(errors, component, context);
+        findErrorsInMemoryMaps(errors, component, context);
+    }
+    else if (group == MODEL_ELEMENTS)
+    {
+        findErrorsInViews(errors, component, context);
+        findErrorsInComponentInstantiations(errors, component, context);
+        findErrorsInDesignInstantiations(errors, component, context);
+        findErrorsInDesignConfigurationInstantiations(errors, component, context);
+        findErrorsInPorts(errors, component, context);
+    }
+    else if (group == OTHER_ELEMENTS)
+    {
+        findErrorsInComponentGenerators(errors, component, context);
+        findErrorsInChoices(errors, component, context);
+        findErrorsInFileSets(errors, component, context);
+        findErrorsInCPUs(errors, component, context);
+        findErrorsInOtherClockDrivers(errors, component, context);
+        findErrorsInResetTypes(errors, component, context);
+        findErrorsInParameters(errors, component, context);
+        findErrorsInAssertions(errors, component, context);
+    }
 }
 
 //-----------------------------------------------------------------------------
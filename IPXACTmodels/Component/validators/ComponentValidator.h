@@ -48,6 +48,19 @@ class IPXACTMODELS_EXPORT ComponentValidator
 {
 public:
 
+    /*!
+     *  Groups of component elements that do not depend on the validation of each other.
+     *  The errors of the groups in this order are the errors of the whole component.
+     */
+    enum ElementGroup
+    {
+        INTERFACE_ELEMENTS,     //!< VLNV, bus and indirect interfaces, channels and remap states.
+        MEMORY_ELEMENTS,        //!< Address spaces and memory maps.
+        MODEL_ELEMENTS,         //!< Views, instantiations and ports.
+        OTHER_ELEMENTS,         //!< Generators, choices, file sets, CPUs, clocks, resets, parameters and assertions.
+        ELEMENT_GROUP_COUNT
+    };
+
     /*!
      *  The constructor.
      *
@@ -267,6 +280,15 @@ public:
      */
     void findErrorsIn(QVector<QString>& errors, QSharedPointer<Component> component);
 
+    /*!
+     *  Locate errors within a group of component elements.
+     *
+     *      @param [in] errors      List of found errors.
+     *      @param [in] component   The selected component.
+     *      @param [in] group       The group of elements to check.
+     */
+    void findErrorsIn(QVector<QString>& errors, QSharedPointer<Component> component, ElementGroup group);
+
 private:
 
 	// Disable copying.
@@ -16,6 +16,7 @@
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/common/Parameter.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
+#include <IPXACTmodels/common/validators/ValidationCache.h>
 #include <IPXACTmodels/Component/Field.h>
 #include <IPXACTmodels/Component/EnumeratedValue.h>
 #include <IPXACTmodels/Component/WriteValueConstraint.h>
@@ -51,6 +52,22 @@ void FieldValidator::componentChange(QSharedPointer<Component> newComponent)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: FieldValidator::setValidationCache()
+//-----------------------------------------------------------------------------
+void FieldValidator::setValidationCache(QSharedPointer<ValidationCache> cache)
+{
+    validationCache_ = cache;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FieldValidator::getValidationCache()
+//-----------------------------------------------------------------------------
+QSharedPointer<ValidationCache> FieldValidator::getValidationCache() const
+{
+    return validationCache_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: FieldValidator::getEnumeratedValueValidator()
 //-----------------------------------------------------------------------------
@@ -63,6 +80,19 @@ QSharedPointer<EnumeratedValueValidator> FieldValidator::getEnumeratedValueValid
 // Function: FieldValidator::validate()
 //-----------------------------------------------------------------------------
 bool FieldValidator::validate(QSharedPointer<Field> field) const
+{
+    if (validationCache_)
+    {
+        return validationCache_->validate(field, QString(), [this, &field]() { return validateField(field); });
+    }
+
+    return validateField(field);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FieldValidator::validateField()
+//-----------------------------------------------------------------------------
+bool FieldValidator::validateField(QSharedPointer<Field> field) const
 {
     return hasValidName(field) && hasValidIsPresent(field) && hasValidBitOffset(field) &&
         hasValidResets(field) && hasValidWriteValueConstraint(field) &&
@@ -26,6 +26,7 @@ class ResetType;
 class ParameterValidator;
 class EnumeratedValueValidator;
 class Component;
+class ValidationCache;
 
 //-----------------------------------------------------------------------------
 //! Validator for ipxact:Field.
@@ -57,6 +58,20 @@ public:
      */
     void componentChange(QSharedPointer<Component> newComponent);
 
+    /*!
+     *  Set the cache for the validation results.
+     *
+     *      @param [in] cache   The cache to use, or null for validating without a cache.
+     */
+    void setValidationCache(QSharedPointer<ValidationCache> cache);
+
+    /*!
+     *  Get the cache for the validation results.
+     *
+     *      @return The used cache, or null if the results are not cached.
+     */
+    QSharedPointer<ValidationCache> getValidationCache() const;
+
     /*!
      *  Get the validator used for enumerated values.
      *
@@ -210,6 +225,15 @@ public:
 
 private:
 
+    /*!
+     *  Validates the given field without using the cache.
+     *
+     *      @param [in] field   The field to validate.
+     *
+     *      @return True, if the field is valid IP-XACT, otherwise false.
+     */
+    bool validateField(QSharedPointer<Field> field) const;
+
 	// Disable copying.
 	FieldValidator(FieldValidator const& rhs);
 	FieldValidator& operator=(FieldValidator const& rhs);
@@ -357,6 +381,9 @@ private:
 
     //! The reset types of the containing component.
     QSharedPointer<QList<QSharedPointer<ResetType> > > availableResetTypes_;
+
+    //! The cache for the validation results, if any.
+    QSharedPointer<ValidationCache> validationCache_;
 };
 
 #endif // FIELDVALIDATOR_H
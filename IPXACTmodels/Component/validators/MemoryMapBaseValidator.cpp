@@ -24,7 +24,12 @@
 #include <IPXACTmodels/Component/validators/AddressBlockValidator.h>
 #include <IPXACTmodels/Component/validators/SubspaceMapValidator.h>
 
+#include <IPXACTmodels/common/validators/ValidationCache.h>
+
 #include <QRegularExpression>
+#include <QSet>
+
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 // Function: MemoryMapBaseValidator::MemoryMapBaseValidator()
@@ -59,6 +64,23 @@ void MemoryMapBaseValidator::componentChange(QSharedPointer<Component> newCompon
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::setValidationCache()
+//-----------------------------------------------------------------------------
+void MemoryMapBaseValidator::setValidationCache(QSharedPointer<ValidationCache> cache)
+{
+    validationCache_ = cache;
+    addressBlockValidator_->setValidationCache(cache);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::getValidationCache()
+//-----------------------------------------------------------------------------
+QSharedPointer<ValidationCache> MemoryMapBaseValidator::getValidationCache() const
+{
+    return validationCache_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryMapBaseValidator::getAddressBlockValidator()
 //-----------------------------------------------------------------------------
@@ -131,7 +153,7 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
 {
     if (!memoryMapBase->getMemoryBlocks()->isEmpty())
     {
-        QStringList memoryBlockNames;
+        QSet<QString> memoryBlockNames;
         for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
         {
             QSharedPointer<MemoryBlockBase> blockData = memoryMapBase->getMemoryBlocks()->at(blockIndex);
@@ -140,7 +162,7 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
                 return false;
             }
 
-            memoryBlockNames.append(blockData->name());
+            memoryBlockNames.insert(blockData->name());
 
             QSharedPointer<AddressBlock> addressBlock = blockData.dynamicCast<AddressBlock>();
             if (addressBlock &&
@@ -157,12 +179,9 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
                     return false;
                 }
             }
-
-            if (memoryBlockOverlaps(blockData, memoryMapBase, blockIndex))
-            {
-                return false;
-            }
         }
+
+        return findOverlappingBlocks(getPresentBlockBounds(memoryMapBase), true).isEmpty();
     }
 
     return true;
@@ -189,53 +208,113 @@ bool MemoryMapBaseValidator::addressBlockWidthIsMultiplicationOfAUB(QString cons
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::addressBlockOverlap()
+// Function: MemoryMapBaseValidator::getPresentBlockBounds()
 //-----------------------------------------------------------------------------
-bool MemoryMapBaseValidator::memoryBlockOverlaps(QSharedPointer<MemoryBlockBase> memoryBlock,
-    QSharedPointer<MemoryMapBase> memoryMapBase, int memoryBlockIndex) const
+QVector<MemoryMapBaseValidator::MemoryBlockBounds> MemoryMapBaseValidator::getPresentBlockBounds(
+    QSharedPointer<MemoryMapBase> memoryMapBase) const
 {
-    for (int blockIndex = memoryBlockIndex + 1; blockIndex < memoryMapBase->getMemoryBlocks()->size();
-        ++blockIndex)
+    QVector<MemoryBlockBounds> blockBounds;
+    blockBounds.reserve(memoryMapBase->getMemoryBlocks()->size());
+
+    for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
     {
-        QSharedPointer<MemoryBlockBase> comparisonBlock = memoryMapBase->getMemoryBlocks()->at(blockIndex);
-        if (twoMemoryBlocksOverlap(memoryBlock, comparisonBlock))
+        QSharedPointer<MemoryBlockBase> memoryBlock = memoryMapBase->getMemoryBlocks()->at(blockIndex);
+        if (memoryBlock && (memoryBlock->getIsPresent().isEmpty() ||
+            expressionParser_->parseExpression(memoryBlock->getIsPresent()).toInt()))
         {
-            return true;
+            MemoryBlockBounds bounds;
+            bounds.blockIndex = blockIndex;
+            bounds.begin = expressionParser_->parseExpression(memoryBlock->getBaseAddress()).toULongLong();
+            bounds.end = bounds.begin + getBlockRange(memoryBlock) - 1;
+
+            blockBounds.append(bounds);
         }
     }
 
-    return false;
+    return blockBounds;
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::twoAddressBlocksOverlap()
+// Function: MemoryMapBaseValidator::findOverlappingBlocks()
 //-----------------------------------------------------------------------------
-bool MemoryMapBaseValidator::twoMemoryBlocksOverlap(QSharedPointer<MemoryBlockBase> memoryBlock,
-    QSharedPointer<MemoryBlockBase> comparedBlock) const
+QVector<QPair<int, int> > MemoryMapBaseValidator::findOverlappingBlocks(
+    QVector<MemoryBlockBounds> const& blockBounds, bool stopAtFirst) const
 {
-    bool blockPresent = memoryBlock->getIsPresent().isEmpty() ||
-        expressionParser_->parseExpression(memoryBlock->getIsPresent()).toInt();
-    bool comparedPresent = comparedBlock->getIsPresent().isEmpty() ||
-        expressionParser_->parseExpression(comparedBlock->getIsPresent()).toInt();
+    QVector<QPair<int, int> > overlappingBlocks;
 
-    if (blockPresent && comparedPresent)
+    // Blocks with an empty or wrapped range end before they begin and cannot be swept in address order.
+    QVector<MemoryBlockBounds> regularBlocks;
+    QVector<MemoryBlockBounds> irregularBlocks;
+    for (MemoryBlockBounds const& bounds : blockBounds)
     {
-        quint64 blockBegin = expressionParser_->parseExpression(memoryBlock->getBaseAddress()).toULongLong();
-        quint64 blockEnd = blockBegin + getBlockRange(memoryBlock) - 1;
+        if (bounds.begin <= bounds.end)
+        {
+            regularBlocks.append(bounds);
+        }
+        else
+        {
+            irregularBlocks.append(bounds);
+        }
+    }
 
-        quint64 compareBegin = expressionParser_->parseExpression(comparedBlock->getBaseAddress()).toULongLong();
-        quint64 compareEnd = compareBegin + getBlockRange(comparedBlock) - 1;
+    std::sort(regularBlocks.begin(), regularBlocks.end(),
+        [](MemoryBlockBounds const& first, MemoryBlockBounds const& second) { return first.begin < second.begin; });
 
-        if (((blockBegin >= compareBegin && blockBegin <= compareEnd) ||
-            (blockEnd >= compareBegin && blockEnd <= compareEnd)) ||
-            ((compareBegin >= blockBegin && compareBegin <= blockEnd) ||
-            (compareEnd >= blockBegin && compareEnd <= blockEnd)))
+    // Sweep the blocks in address order, keeping the blocks that are still open at the current address.
+    QVector<MemoryBlockBounds> openBlocks;
+    for (MemoryBlockBounds const& current : regularBlocks)
+    {
+        openBlocks.erase(std::remove_if(openBlocks.begin(), openBlocks.end(),
+            [&current](MemoryBlockBounds const& open) { return open.end < current.begin; }), openBlocks.end());
+
+        for (MemoryBlockBounds const& open : openBlocks)
         {
-            return true;
+            overlappingBlocks.append(qMakePair(qMin(open.blockIndex, current.blockIndex),
+                qMax(open.blockIndex, current.blockIndex)));
+
+            if (stopAtFirst)
+            {
+                return overlappingBlocks;
+            }
+        }
+
+        openBlocks.append(current);
+    }
+
+    for (int irregularIndex = 0; irregularIndex < irregularBlocks.size(); ++irregularIndex)
+    {
+        MemoryBlockBounds const& irregular = irregularBlocks.at(irregularIndex);
+
+        QVector<MemoryBlockBounds> comparedBlocks = regularBlocks + irregularBlocks.mid(irregularIndex + 1);
+        for (MemoryBlockBounds const& compared : comparedBlocks)
+        {
+            if (twoMemoryBlocksOverlap(irregular, compared))
+            {
+                overlappingBlocks.append(qMakePair(qMin(irregular.blockIndex, compared.blockIndex),
+                    qMax(irregular.blockIndex, compared.blockIndex)));
+
+                if (stopAtFirst)
+                {
+                    return overlappingBlocks;
+                }
+            }
         }
     }
 
-    return false;
+    std::sort(overlappingBlocks.begin(), overlappingBlocks.end());
+    return overlappingBlocks;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::twoMemoryBlocksOverlap()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::twoMemoryBlocksOverlap(MemoryBlockBounds const& first,
+    MemoryBlockBounds const& second)
+{
+    return (first.begin >= second.begin && first.begin <= second.end) ||
+        (first.end >= second.begin && first.end <= second.end) ||
+        (second.begin >= first.begin && second.begin <= first.end) ||
+        (second.end >= first.begin && second.end <= first.end);
 }
 
 //-----------------------------------------------------------------------------
@@ -363,7 +442,13 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
 {
     if (!memoryMapBase->getMemoryBlocks()->isEmpty())
     {
-        QStringList memoryBlockNames;
+        QVector<QVector<int> > overlappingIndexes(memoryMapBase->getMemoryBlocks()->size());
+        for (QPair<int, int> const& overlap : findOverlappingBlocks(getPresentBlockBounds(memoryMapBase), false))
+        {
+            overlappingIndexes[overlap.first].append(overlap.second);
+        }
+
+        QSet<QString> memoryBlockNames;
         for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
         {
             QSharedPointer<MemoryBlockBase> memoryBlock = memoryMapBase->getMemoryBlocks()->at(blockIndex);
@@ -373,7 +458,7 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
                     .arg(memoryBlock->name()).arg(context));
             }
 
-            memoryBlockNames.append(memoryBlock->name());
+            memoryBlockNames.insert(memoryBlock->name());
 
             QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
             QSharedPointer<SubSpaceMap> subspace = memoryBlock.dynamicCast<SubSpaceMap>();
@@ -396,7 +481,8 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
                     subspaceValidator_->findErrorsIn(errors, subspace, context);
                 }
 
-                findErrorsInOverlappingBlocks(errors, memoryMapBase, memoryBlock, blockIndex, context);
+                findErrorsInOverlappingBlocks(errors, memoryMapBase, memoryBlock, overlappingIndexes.at(blockIndex),
+                    context);
             }
         }
     }
@@ -406,21 +492,14 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
 // Function: MemoryMapBaseValidator::findErrorsInOverlappingBlocks()
 //-----------------------------------------------------------------------------
 void MemoryMapBaseValidator::findErrorsInOverlappingBlocks(QVector<QString>& errors,
-    QSharedPointer<MemoryMapBase> memoryMapBase, QSharedPointer<MemoryBlockBase> memoryBlock, int blockIndex,
-    QString const& context) const
+    QSharedPointer<MemoryMapBase> memoryMapBase, QSharedPointer<MemoryBlockBase> memoryBlock,
+    QVector<int> const& overlappingIndexes, QString const& context) const
 {
-    for (int comparisonIndex = blockIndex + 1; comparisonIndex < memoryMapBase->getMemoryBlocks()->size();
-        ++comparisonIndex)
+    for (int comparisonIndex : overlappingIndexes)
     {
         QSharedPointer<MemoryBlockBase> comparisonBlock = memoryMapBase->getMemoryBlocks()->at(comparisonIndex);
-        if (comparisonBlock)
-        {
-            if (twoMemoryBlocksOverlap(memoryBlock, comparisonBlock))
-            {
-                errors.append(QObject::tr("Memory blocks %1 and %2 overlap in %3")
-                    .arg(memoryBlock->name()).arg(comparisonBlock->name()).arg(context));
-            }
-        }
+        errors.append(QObject::tr("Memory blocks %1 and %2 overlap in %3")
+            .arg(memoryBlock->name()).arg(comparisonBlock->name()).arg(context));
     }
 }
 
@@ -14,8 +14,10 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <QPair>
 #include <QSharedPointer>
 #include <QString>
+#include <QVector>
 
 class ExpressionParser;
 class MemoryMapBase;
@@ -29,6 +31,7 @@ class SubSpaceMap;
 class BusInterface;
 class AddressSpace;
 class Segment;
+class ValidationCache;
 
 //-----------------------------------------------------------------------------
 //! Validator for the base ipxact:memoryMap.
@@ -59,6 +62,20 @@ public:
      */
     void componentChange(QSharedPointer<Component> newComponent);
 
+    /*!
+     *  Set the cache for the validation results of the memory maps and their memory blocks.
+     *
+     *      @param [in] cache   The cache to use, or null for validating without a cache.
+     */
+    void setValidationCache(QSharedPointer<ValidationCache> cache);
+
+    /*!
+     *  Get the cache for the validation results.
+     *
+     *      @return The used cache, or null if the results are not cached.
+     */
+    QSharedPointer<ValidationCache> getValidationCache() const;
+
     /*!
      *  Get the validator used for address blocks.
      *
@@ -137,26 +154,43 @@ private:
 	MemoryMapBaseValidator(MemoryMapBaseValidator const& rhs);
 	MemoryMapBaseValidator& operator=(MemoryMapBaseValidator const& rhs);
 
+    //! The evaluated address bounds of a present memory block.
+    struct MemoryBlockBounds
+    {
+        int blockIndex;     //!< Index of the block within the memory map.
+        quint64 begin;      //!< The first address of the block.
+        quint64 end;        //!< The last address of the block.
+    };
+
     /*!
-     *  Check if the memory block overlaps with another memory block.
+     *  Evaluate the bounds of all the present memory blocks in a memory map.
      *
-     *      @param [in] memoryBlock         The selected memory block.
-     *      @param [in] memoryMapBase       The selected memory map base.
-     *      @param [in] memoryBlockIndex    The index of the memory block.
+     *      @param [in] memoryMapBase   The selected memory map base.
      *
-     *      @return True, if the memory blocks overlap, otherwise false.
+     *      @return The bounds of the present memory blocks.
      */
-    bool memoryBlockOverlaps(QSharedPointer<MemoryBlockBase> memoryBlock,
-        QSharedPointer<MemoryMapBase> memoryMapBase, int memoryBlockIndex) const;
+    QVector<MemoryBlockBounds> getPresentBlockBounds(QSharedPointer<MemoryMapBase> memoryMapBase) const;
+
+    /*!
+     *  Find the overlapping memory blocks.
+     *
+     *      @param [in] blockBounds     The bounds of the present memory blocks.
+     *      @param [in] stopAtFirst     Flag for returning as soon as one overlap has been found.
+     *
+     *      @return Index pairs of the overlapping blocks, the smaller index first.
+     */
+    QVector<QPair<int, int> > findOverlappingBlocks(QVector<MemoryBlockBounds> const& blockBounds,
+        bool stopAtFirst) const;
 
     /*!
      *  Check if two memory blocks overlap.
      *
-     *      @param [in] memoryBlock     The selected memory block.
-     *      @param [in] comparedBlock   The compared memory block.
+     *      @param [in] first   Bounds of the first memory block.
+     *      @param [in] second  Bounds of the second memory block.
+     *
+     *      @return True, if the memory blocks overlap, otherwise false.
      */
-    bool twoMemoryBlocksOverlap(QSharedPointer<MemoryBlockBase> memoryBlock,
-        QSharedPointer<MemoryBlockBase> comparedBlock) const;
+    static bool twoMemoryBlocksOverlap(MemoryBlockBounds const& first, MemoryBlockBounds const& second);
 
     /*!
      *  Get the range of the selected memory block
@@ -232,14 +266,15 @@ private:
     /*!
      *  Find errors within overlapping memory blocks.
      *
-     *      @param [in] errors          List of found errors.
-     *      @param [in] memoryMapBase   The selected memory map base.
-     *      @param [in] memoryBlock     The selected memory block.
-     *      @param [in] blockIndex      The index of the address block.
-     *      @param [in] context         Context to help locate the error.
+     *      @param [in] errors              List of found errors.
+     *      @param [in] memoryMapBase       The selected memory map base.
+     *      @param [in] memoryBlock         The selected memory block.
+     *      @param [in] overlappingIndexes  Indexes of the later blocks overlapping the selected block.
+     *      @param [in] context             Context to help locate the error.
      */
     void findErrorsInOverlappingBlocks(QVector<QString>& errors, QSharedPointer<MemoryMapBase> memoryMapBase,
-        QSharedPointer<MemoryBlockBase> memoryBlock, int blockIndex, QString const& context) const;
+        QSharedPointer<MemoryBlockBase> memoryBlock, QVector<int> const& overlappingIndexes,
+        QString const& context) const;
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -259,6 +294,9 @@ private:
 
     //! List of available address spaces.
     QSharedPointer<QList<QSharedPointer<AddressSpace> > > availableSpaces_;
+
+    //! The cache for the validation results, if any.
+    QSharedPointer<ValidationCache> validationCache_;
 };
 
 #endif // MEMORYMAPBASEVALIDATOR_H
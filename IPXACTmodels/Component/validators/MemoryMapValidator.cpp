@@ -18,6 +18,8 @@
 #include <IPXACTmodels/Component/RemapState.h>
 #include <IPXACTmodels/Component/Component.h>
 
+#include <IPXACTmodels/common/validators/ValidationCache.h>
+
 //-----------------------------------------------------------------------------
 // Function: MemoryMapValidator::MemoryMapValidator()
 //-----------------------------------------------------------------------------
@@ -52,6 +54,20 @@ void MemoryMapValidator::componentChange(QSharedPointer<Component> newComponent)
 // Function: MemoryMapValidator::validate()
 //-----------------------------------------------------------------------------
 bool MemoryMapValidator::validate(QSharedPointer<MemoryMap> memoryMap) const
+{
+    QSharedPointer<ValidationCache> cache = getValidationCache();
+    if (cache)
+    {
+        return cache->validate(memoryMap, QString(), [this, &memoryMap]() { return validateMemoryMap(memoryMap); });
+    }
+
+    return validateMemoryMap(memoryMap);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapValidator::validateMemoryMap()
+//-----------------------------------------------------------------------------
+bool MemoryMapValidator::validateMemoryMap(QSharedPointer<MemoryMap> memoryMap) const
 {
     return MemoryMapBaseValidator::validate(memoryMap, memoryMap->getAddressUnitBits()) &&
         hasValidAddressUnitBits(memoryMap) && hasValidMemoryRemaps(memoryMap);
@@ -108,6 +108,15 @@ private:
 	MemoryMapValidator(MemoryMapValidator const& rhs);
 	MemoryMapValidator& operator=(MemoryMapValidator const& rhs);
 
+    /*!
+     *  Validates the given memory map without using the cache.
+     *
+     *      @param [in] memoryMap   The memory map to validate.
+     *
+     *      @return True, if the memory map is valid IP-XACT, otherwise false.
+     */
+    bool validateMemoryMap(QSharedPointer<MemoryMap> memoryMap) const;
+
     /*!
      *  Locate errors within memory map address unit bits.
      *
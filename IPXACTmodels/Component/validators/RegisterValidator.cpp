@@ -14,6 +14,7 @@
 #include <editors/ComponentEditor/common/ExpressionParser.h>
 #include <IPXACTmodels/Component/validators/FieldValidator.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
+#include <IPXACTmodels/common/validators/ValidationCache.h>
 
 #include <IPXACTmodels/Component/validators/MemoryReserve.h>
 #include <IPXACTmodels/Component/RegisterBase.h>
@@ -45,6 +46,23 @@ void RegisterValidator::componentChange(QSharedPointer<Component> newComponent)
     fieldValidator_->componentChange(newComponent);
 }
 
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::setValidationCache()
+//-----------------------------------------------------------------------------
+void RegisterValidator::setValidationCache(QSharedPointer<ValidationCache> cache)
+{
+    validationCache_ = cache;
+    fieldValidator_->setValidationCache(cache);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::getValidationCache()
+//-----------------------------------------------------------------------------
+QSharedPointer<ValidationCache> RegisterValidator::getValidationCache() const
+{
+    return validationCache_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: RegisterValidator::getFieldValidator()
 //-----------------------------------------------------------------------------
@@ -57,6 +75,20 @@ QSharedPointer<FieldValidator> RegisterValidator::getFieldValidator() const
 // Function: RegisterValidator::validate()
 //-----------------------------------------------------------------------------
 bool RegisterValidator::validate(QSharedPointer<Register> selectedRegister) const
+{
+    if (validationCache_)
+    {
+        return validationCache_->validate(selectedRegister, QString(),
+            [this, &selectedRegister]() { return validateRegister(selectedRegister); });
+    }
+
+    return validateRegister(selectedRegister);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::validateRegister()
+//-----------------------------------------------------------------------------
+bool RegisterValidator::validateRegister(QSharedPointer<Register> selectedRegister) const
 {
     return RegisterBaseValidator::validate(selectedRegister) &&
            hasValidSize(selectedRegister) &&
@@ -30,6 +30,7 @@ class ParameterValidator;
 class RegisterBaseValidator;
 class ResetType;
 class Component;
+class ValidationCache;
 
 //-----------------------------------------------------------------------------
 //! Validator for ipxact:Register.
@@ -59,6 +60,20 @@ public:
      */
     void componentChange(QSharedPointer<Component> newComponent);
 
+    /*!
+     *  Set the cache for the validation results of the registers and their fields.
+     *
+     *      @param [in] cache   The cache to use, or null for validating without a cache.
+     */
+    void setValidationCache(QSharedPointer<ValidationCache> cache);
+
+    /*!
+     *  Get the cache for the validation results.
+     *
+     *      @return The used cache, or null if the results are not cached.
+     */
+    QSharedPointer<ValidationCache> getValidationCache() const;
+
     /*!
      *  Get the field validator.
      *
@@ -125,6 +140,15 @@ public:
 
 private:
 
+    /*!
+     *  Validates the given register without using the cache.
+     *
+     *      @param [in] selectedRegister    The register to validate.
+     *
+     *      @return True, if the register is valid IP-XACT, otherwise false.
+     */
+    bool validateRegister(QSharedPointer<Register> selectedRegister) const;
+
 	// Disable copying.
 	RegisterValidator(RegisterValidator const& rhs);
 	RegisterValidator& operator=(RegisterValidator const& rhs);
@@ -195,6 +219,9 @@ private:
     //! The validator used for fields.
     QSharedPointer<FieldValidator> fieldValidator_;
 
+    //! The cache for the validation results, if any.
+    QSharedPointer<ValidationCache> validationCache_;
+
 };
 
 #endif // REGISTERVALIDATOR_H
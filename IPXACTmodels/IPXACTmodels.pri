@@ -71,6 +71,7 @@ HEADERS += ./generaldeclarations.h \
     ./common/VendorExtension.h \
     ./common/VLNV.h \
     ./common/CommonItemsReader.h \
+    ./common/CommonItemsStreamReader.h \
     ./common/CommonItemsWriter.h \
     ./common/DocumentReader.h \
     ./common/DocumentWriter.h \
@@ -90,6 +91,7 @@ HEADERS += ./generaldeclarations.h \
     ./common/validators/ParameterValidator.h \
     ./common/validators/ProtocolValidator.h \
     ./common/validators/TimingConstraintValidator.h \
+    ./common/validators/ValidationCache.h \
     ./common/validators/ValueFormatter.h \
     ./common/validators/namevalidator.h \
     ./common/validators/NMTokenValidator.h \
@@ -219,10 +221,12 @@ HEADERS += ./generaldeclarations.h \
     ./Component/MemoryMapBaseReader.h \
     ./Component/MemoryMapBaseWriter.h \
     ./Component/MemoryMapReader.h \
+    ./Component/MemoryMapStreamReader.h \
     ./Component/MemoryMapWriter.h \
     ./Component/OtherClockDriverReader.h \
     ./Component/OtherClockDriverWriter.h \
     ./Component/PortReader.h \
+    ./Component/PortStreamReader.h \
     ./Component/PortWriter.h \
     ./Component/RegisterReader.h \
     ./Component/RegisterWriter.h \
@@ -305,6 +309,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./common/CellSpecification.cpp \
     ./common/ClockUnit.cpp \
     ./common/CommonItemsReader.cpp \
+    ./common/CommonItemsStreamReader.cpp \
     ./common/CommonItemsWriter.cpp \
     ./common/ConfigurableElementValue.cpp \
     ./common/ConfigurableVLNVReference.cpp \
@@ -348,6 +353,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./common/validators/ParameterValidator.cpp \
     ./common/validators/ProtocolValidator.cpp \
     ./common/validators/TimingConstraintValidator.cpp \
+    ./common/validators/ValidationCache.cpp \
     ./common/validators/ValueFormatter.cpp \
     ./BusDefinition/BusDefinition.cpp \
     ./BusDefinition/BusDefinitionReader.cpp \
@@ -451,6 +457,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./Component/MemoryMapBaseReader.cpp \
     ./Component/MemoryMapBaseWriter.cpp \
     ./Component/MemoryMapReader.cpp \
+    ./Component/MemoryMapStreamReader.cpp \
     ./Component/MemoryMapWriter.cpp \
     ./Component/MemoryRemap.cpp \
     ./Component/MirroredSlaveInterface.cpp \
@@ -462,6 +469,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./Component/Port.cpp \
     ./Component/PortMap.cpp \
     ./Component/PortReader.cpp \
+    ./Component/PortStreamReader.cpp \
     ./Component/PortWriter.cpp \
     ./Component/Register.cpp \
     ./Component/RegisterBase.cpp \
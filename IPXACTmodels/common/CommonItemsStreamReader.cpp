@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// File: CommonItemsStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Base class for readers creating IP-XACT items directly from an XML stream.
+//-----------------------------------------------------------------------------
+
+#include "CommonItemsStreamReader.h"
+
+#include <IPXACTmodels/common/NameGroup.h>
+
+namespace
+{
+    //! Approximate memory used by the model object, shared pointer and container entry of an element.
+    const qint64 ELEMENT_MODEL_SIZE = 128;
+
+    //! Approximate memory used by the string and container entry of an attribute or a text.
+    const qint64 VALUE_MODEL_SIZE = 32;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::CommonItemsStreamReader()
+//-----------------------------------------------------------------------------
+CommonItemsStreamReader::CommonItemsStreamReader():
+CommonItemsReader(),
+fragmentDocument_(),
+estimatedModelSize_(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::getEstimatedModelSize()
+//-----------------------------------------------------------------------------
+qint64 CommonItemsStreamReader::getEstimatedModelSize() const
+{
+    return estimatedModelSize_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::readNextChildElement()
+//-----------------------------------------------------------------------------
+bool CommonItemsStreamReader::readNextChildElement(QXmlStreamReader& reader)
+{
+    if (reader.readNextStartElement() == false)
+    {
+        return false;
+    }
+
+    estimatedModelSize_ += ELEMENT_MODEL_SIZE;
+    for (QXmlStreamAttribute const& attribute : reader.attributes())
+    {
+        estimatedModelSize_ += VALUE_MODEL_SIZE + attribute.value().size() * qint64(sizeof(QChar));
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::readElementText()
+//-----------------------------------------------------------------------------
+QString CommonItemsStreamReader::readElementText(QXmlStreamReader& reader)
+{
+    QString value;
+    QString collectedText;
+    bool valueFound = false;
+    int depth = 0;
+
+    while (reader.atEnd() == false)
+    {
+        QXmlStreamReader::TokenType token = reader.readNext();
+
+        if (depth == 0 && valueFound == false)
+        {
+            // The stream may deliver the text of a single node in several parts.
+            if (token == QXmlStreamReader::Characters && reader.isCDATA() == false)
+            {
+                collectedText.append(reader.text());
+                continue;
+            }
+
+            // Text containing only whitespace is not a node in the DOM.
+            if (isWhitespace(collectedText) == false)
+            {
+                value = collectedText;
+                valueFound = true;
+            }
+            else if (token == QXmlStreamReader::Characters || token == QXmlStreamReader::Comment)
+            {
+                value = reader.text().toString();
+                valueFound = true;
+            }
+            else if (token == QXmlStreamReader::ProcessingInstruction)
+            {
+                value = reader.processingInstructionData().toString();
+                valueFound = true;
+            }
+            else if (token == QXmlStreamReader::StartElement)
+            {
+                valueFound = true;
+            }
+
+            collectedText.clear();
+        }
+
+        if (token == QXmlStreamReader::StartElement)
+        {
+            ++depth;
+        }
+        else if (token == QXmlStreamReader::EndElement)
+        {
+            if (depth == 0)
+            {
+                break;
+            }
+
+            --depth;
+        }
+    }
+
+    if (value.isEmpty() == false)
+    {
+        estimatedModelSize_ += VALUE_MODEL_SIZE + value.size() * qint64(sizeof(QChar));
+    }
+
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::readDomElement()
+//-----------------------------------------------------------------------------
+QDomElement CommonItemsStreamReader::readDomElement(QXmlStreamReader& reader, QDomNode parent)
+{
+    QDomElement element = fragmentDocument_.createElement(reader.qualifiedName().toString());
+    for (QXmlStreamAttribute const& attribute : reader.attributes())
+    {
+        element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+    parent.appendChild(element);
+
+    QDomNode currentNode = element;
+    QString collectedText;
+
+    while (reader.atEnd() == false)
+    {
+        QXmlStreamReader::TokenType token = reader.readNext();
+
+        if (token == QXmlStreamReader::Characters && reader.isCDATA() == false)
+        {
+            collectedText.append(reader.text());
+            continue;
+        }
+
+        appendText(currentNode, collectedText);
+
+        if (token == QXmlStreamReader::StartElement)
+        {
+            estimatedModelSize_ += ELEMENT_MODEL_SIZE;
+
+            QDomElement childElement = fragmentDocument_.createElement(reader.qualifiedName().toString());
+            for (QXmlStreamAttribute const& attribute : reader.attributes())
+            {
+                childElement.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+                estimatedModelSize_ += VALUE_MODEL_SIZE + attribute.value().size() * qint64(sizeof(QChar));
+            }
+
+            currentNode.appendChild(childElement);
+            currentNode = childElement;
+        }
+        else if (token == QXmlStreamReader::EndElement)
+        {
+            if (currentNode == element)
+            {
+                break;
+            }
+
+            currentNode = currentNode.parentNode();
+        }
+        else if (token == QXmlStreamReader::Characters)
+        {
+            currentNode.appendChild(fragmentDocument_.createCDATASection(reader.text().toString()));
+        }
+        else if (token == QXmlStreamReader::Comment)
+        {
+            currentNode.appendChild(fragmentDocument_.createComment(reader.text().toString()));
+        }
+        else if (token == QXmlStreamReader::ProcessingInstruction)
+        {
+            currentNode.appendChild(fragmentDocument_.createProcessingInstruction(
+                reader.processingInstructionTarget().toString(), reader.processingInstructionData().toString()));
+        }
+    }
+
+    return element;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::createDelegatedElements()
+//-----------------------------------------------------------------------------
+QDomElement CommonItemsStreamReader::createDelegatedElements()
+{
+    return fragmentDocument_.createElement(QStringLiteral("delegatedElements"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::readNameGroupElement()
+//-----------------------------------------------------------------------------
+bool CommonItemsStreamReader::readNameGroupElement(QXmlStreamReader& reader, QSharedPointer<NameGroup> nameGroup)
+{
+    QStringRef elementName = reader.qualifiedName();
+
+    if (elementName == QLatin1String("ipxact:name"))
+    {
+        nameGroup->setName(readElementText(reader));
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:displayName"))
+    {
+        QString displayName = readElementText(reader);
+        if (!displayName.isEmpty())
+        {
+            nameGroup->setDisplayName(displayName);
+        }
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:description"))
+    {
+        QString description = readElementText(reader);
+        if (!description.isEmpty())
+        {
+            nameGroup->setDescription(description);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::isDelegatedElement()
+//-----------------------------------------------------------------------------
+bool CommonItemsStreamReader::isDelegatedElement(QXmlStreamReader const& reader) const
+{
+    QStringRef elementName = reader.qualifiedName();
+    return elementName == QLatin1String("ipxact:parameters") ||
+        elementName == QLatin1String("ipxact:vendorExtensions");
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::appendText()
+//-----------------------------------------------------------------------------
+void CommonItemsStreamReader::appendText(QDomNode parent, QString& text)
+{
+    if (isWhitespace(text) == false)
+    {
+        parent.appendChild(fragmentDocument_.createTextNode(text));
+        estimatedModelSize_ += VALUE_MODEL_SIZE + text.size() * qint64(sizeof(QChar));
+    }
+
+    text.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommonItemsStreamReader::isWhitespace()
+//-----------------------------------------------------------------------------
+bool CommonItemsStreamReader::isWhitespace(QString const& text)
+{
+    for (QChar const& character : text)
+    {
+        if (character != QLatin1Char(' ') && character != QLatin1Char('\t') &&
+            character != QLatin1Char('\n') && character != QLatin1Char('\r'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------------
+// File: CommonItemsStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Base class for readers creating IP-XACT items directly from an XML stream.
+//-----------------------------------------------------------------------------
+
+#ifndef COMMONITEMSSTREAMREADER_H
+#define COMMONITEMSSTREAMREADER_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <IPXACTmodels/common/CommonItemsReader.h>
+
+#include <QDomDocument>
+#include <QDomElement>
+#include <QSharedPointer>
+#include <QString>
+#include <QXmlStreamReader>
+
+class NameGroup;
+
+//-----------------------------------------------------------------------------
+//! Base class for readers creating IP-XACT items directly from an XML stream.
+//
+// The stream readers create the same items as the DOM readers for schema-valid documents. Elements that are
+// small and rarely used, e.g. parameters and vendor extensions, are read into a DOM fragment and given to the
+// DOM readers, so that the bulk of the document never exists as DOM.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT CommonItemsStreamReader : public CommonItemsReader
+{
+public:
+
+    //! The constructor.
+    CommonItemsStreamReader();
+
+    //! The destructor.
+    virtual ~CommonItemsStreamReader() = default;
+
+    //! No copying allowed.
+    CommonItemsStreamReader(CommonItemsStreamReader const& rhs) = delete;
+    CommonItemsStreamReader& operator=(CommonItemsStreamReader const& rhs) = delete;
+
+    /*!
+     *  Gets an estimate of the memory used by the items read so far.
+     *
+     *  The estimate is counted like in DocumentStreamReader from the elements, attributes and text.
+     *
+     *      @return The estimated size in bytes.
+     */
+    qint64 getEstimatedModelSize() const;
+
+protected:
+
+    /*!
+     *  Reads the next child element of the current element.
+     *
+     *      @param [in] reader  The stream positioned inside the current element.
+     *
+     *      @return True, if a child element was found, false at the end of the current element or on error.
+     */
+    bool readNextChildElement(QXmlStreamReader& reader);
+
+    /*!
+     *  Reads the text of the current element and moves to its end.
+     *
+     *  The text is the value of the first child node, like firstChild().nodeValue() in the DOM readers.
+     *
+     *      @param [in] reader  The stream positioned at the start of the element.
+     *
+     *      @return The text of the element.
+     */
+    QString readElementText(QXmlStreamReader& reader);
+
+    /*!
+     *  Reads the current element into a DOM element and moves to its end.
+     *
+     *      @param [in] reader  The stream positioned at the start of the element.
+     *      @param [in] parent  The node to append the created element to.
+     *
+     *      @return The created element.
+     */
+    QDomElement readDomElement(QXmlStreamReader& reader, QDomNode parent);
+
+    /*!
+     *  Creates an element for collecting the child elements given to the DOM readers.
+     *
+     *      @return The created element.
+     */
+    QDomElement createDelegatedElements();
+
+    /*!
+     *  Reads the current element, if it belongs to the name group.
+     *
+     *      @param [in] reader      The stream positioned at the start of the element.
+     *      @param [in] nameGroup   The item receiving the name group values.
+     *
+     *      @return True, if the element was read, otherwise false.
+     */
+    bool readNameGroupElement(QXmlStreamReader& reader, QSharedPointer<NameGroup> nameGroup);
+
+    /*!
+     *  Checks if the current element is read by the DOM readers.
+     *
+     *      @param [in] reader  The stream positioned at the start of the element.
+     *
+     *      @return True for parameters and vendor extensions, otherwise false.
+     */
+    bool isDelegatedElement(QXmlStreamReader const& reader) const;
+
+private:
+
+    /*!
+     *  Appends the collected text as a child of the given node.
+     *
+     *      @param [in] parent  The node receiving the text.
+     *      @param [in] text    The collected text. Text containing only whitespace is dropped.
+     */
+    void appendText(QDomNode parent, QString& text);
+
+    /*!
+     *  Checks if the given text contains only XML whitespace.
+     *
+     *      @param [in] text    The text to check.
+     *
+     *      @return True, if the text is whitespace, otherwise false.
+     */
+    static bool isWhitespace(QString const& text);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The document owning the DOM fragments.
+    QDomDocument fragmentDocument_;
+
+    //! The estimated size of the items read.
+    qint64 estimatedModelSize_;
+};
+
+#endif // COMMONITEMSSTREAMREADER_H
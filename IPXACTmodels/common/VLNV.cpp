@@ -11,6 +11,7 @@
 
 #include "VLNV.h"
 
+#include <QHash>
 #include <QString>
 #include <QStringBuilder>
 #include <QStringList>
@@ -358,3 +359,12 @@ QString VLNV::IPXactType2String(IPXactType const& type)
 {
     return types.key(type, QStringLiteral("invalid"));	
 }
+
+//-----------------------------------------------------------------------------
+// Function: qHash()
+//-----------------------------------------------------------------------------
+uint qHash(VLNV const& vlnv, uint seed)
+{
+    return qHash(vlnv.getVendor(), seed) ^ qHash(vlnv.getLibrary(), seed + 1) ^
+        qHash(vlnv.getName(), seed + 2) ^ qHash(vlnv.getVersion(), seed + 3);
+}
@@ -259,6 +259,15 @@ private:
 	IPXactType type_;
 };
 
+/*! Calculates the hash of a VLNV for hashed containers. The type is ignored like in the comparison.
+ *
+ *      @param [in] vlnv    The VLNV to hash.
+ *      @param [in] seed    The seed for the hash.
+ *
+ *      @return The hash value.
+ */
+IPXACTMODELS_EXPORT uint qHash(VLNV const& vlnv, uint seed = 0);
+
 // With this declaration, VLNV can be used as a QVariant.
 Q_DECLARE_METATYPE(VLNV);
 
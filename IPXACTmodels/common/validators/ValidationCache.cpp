@@ -0,0 +1,201 @@
+//-----------------------------------------------------------------------------
+// File: ValidationCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Stores the validation results of elements until the elements or their references change.
+//-----------------------------------------------------------------------------
+
+#include "ValidationCache.h"
+
+#include <editors/ComponentEditor/common/ExpressionParser.h>
+
+#include <QRegularExpression>
+#include <QStringList>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Expression parser that records the evaluated expressions in the validation cache.
+    //-----------------------------------------------------------------------------
+    class RecordingParser : public ExpressionParser
+    {
+    public:
+
+        RecordingParser(QSharedPointer<ExpressionParser> parser, ValidationCache* cache):
+            parser_(parser), cache_(cache) {}
+
+        virtual ~RecordingParser() = default;
+
+        virtual QString parseExpression(QString const& expression, bool* validExpression = nullptr) const override
+        {
+            cache_->recordExpression(expression);
+            return parser_->parseExpression(expression, validExpression);
+        }
+
+        virtual bool isPlainValue(QString const& expression) const override
+        {
+            return parser_->isPlainValue(expression);
+        }
+
+        virtual int baseForExpression(QString const& expression) const override
+        {
+            return parser_->baseForExpression(expression);
+        }
+
+    private:
+
+        //! The parser evaluating the expressions.
+        QSharedPointer<ExpressionParser> parser_;
+
+        //! The cache recording the expressions.
+        ValidationCache* cache_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::ValidationCache()
+//-----------------------------------------------------------------------------
+ValidationCache::ValidationCache(QSharedPointer<ExpressionParser> expressionParser):
+expressionParser_(expressionParser),
+recordingParser_(new RecordingParser(expressionParser, this)),
+results_(),
+containers_(),
+validationStack_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::getRecordingParser()
+//-----------------------------------------------------------------------------
+QSharedPointer<ExpressionParser> ValidationCache::getRecordingParser() const
+{
+    return recordingParser_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::validate()
+//-----------------------------------------------------------------------------
+bool ValidationCache::validate(QSharedPointer<const void> element, QString const& context,
+    std::function<bool()> const& validator)
+{
+    auto stored = results_.constFind(element.data());
+    if (stored != results_.cend() && isUpToDate(stored.value(), element, context))
+    {
+        addToContainer(element.data(), stored->references);
+        return stored->valid;
+    }
+
+    Frame frame;
+    frame.element = element.data();
+    validationStack_.append(frame);
+
+    bool const valid = validator();
+
+    Result result;
+    result.element = element.toWeakRef();
+    result.context = context;
+    result.valid = valid;
+    result.references = validationStack_.takeLast().references;
+
+    results_.insert(element.data(), result);
+    addToContainer(element.data(), result.references);
+
+    return valid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::recordExpression()
+//-----------------------------------------------------------------------------
+void ValidationCache::recordExpression(QString const& expression)
+{
+    if (validationStack_.isEmpty() || expressionParser_->isPlainValue(expression))
+    {
+        return;
+    }
+
+    static const QRegularExpression NON_ID_CHARACTERS(QStringLiteral("[^a-zA-Z0-9:_.]+"));
+
+    QHash<QString, QString>& references = validationStack_.last().references;
+    for (QString const& identifier : expression.split(NON_ID_CHARACTERS, QString::SkipEmptyParts))
+    {
+        if (identifier.at(0).isDigit() == false && references.contains(identifier) == false)
+        {
+            references.insert(identifier, expressionParser_->parseExpression(identifier));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::invalidate()
+//-----------------------------------------------------------------------------
+void ValidationCache::invalidate(void const* element)
+{
+    if (results_.contains(element) == false && containers_.contains(element) == false)
+    {
+        clear();
+        return;
+    }
+
+    // Addresses of deleted elements may be reused, so the walk is bounded in case the links form a loop.
+    void const* current = element;
+    for (int i = 0; current != nullptr && i <= containers_.size(); ++i)
+    {
+        results_.remove(current);
+        current = containers_.value(current, nullptr);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::clear()
+//-----------------------------------------------------------------------------
+void ValidationCache::clear()
+{
+    results_.clear();
+    containers_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::isUpToDate()
+//-----------------------------------------------------------------------------
+bool ValidationCache::isUpToDate(Result const& result, QSharedPointer<const void> const& element,
+    QString const& context) const
+{
+    if (result.element.toStrongRef().data() != element.data() || result.context != context)
+    {
+        return false;
+    }
+
+    for (auto reference = result.references.cbegin(); reference != result.references.cend(); ++reference)
+    {
+        if (expressionParser_->parseExpression(reference.key()) != reference.value())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ValidationCache::addToContainer()
+//-----------------------------------------------------------------------------
+void ValidationCache::addToContainer(void const* element, QHash<QString, QString> const& references)
+{
+    if (validationStack_.isEmpty())
+    {
+        return;
+    }
+
+    Frame& container = validationStack_.last();
+    containers_.insert(element, container.element);
+
+    for (auto reference = references.cbegin(); reference != references.cend(); ++reference)
+    {
+        container.references.insert(reference.key(), reference.value());
+    }
+}
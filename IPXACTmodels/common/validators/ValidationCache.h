@@ -0,0 +1,159 @@
+//-----------------------------------------------------------------------------
+// File: ValidationCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Stores the validation results of elements until the elements or their references change.
+//-----------------------------------------------------------------------------
+
+#ifndef VALIDATIONCACHE_H
+#define VALIDATIONCACHE_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include <QWeakPointer>
+
+#include <functional>
+
+class ExpressionParser;
+
+//-----------------------------------------------------------------------------
+//! Stores the validation results of elements until the elements or their references change.
+//
+// The expressions evaluated during the validation of an element are recorded through the parser returned by
+// getRecordingParser(). A stored result is used only if all the identifiers in those expressions still
+// evaluate to the same values. Results of elements validated while validating another element are linked
+// to the containing element, so invalidating an element also invalidates all the elements containing it.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT ValidationCache
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] expressionParser    The parser for evaluating the expressions of the elements.
+     */
+    explicit ValidationCache(QSharedPointer<ExpressionParser> expressionParser);
+
+    //! The destructor.
+    ~ValidationCache() = default;
+
+    /*!
+     *  Gets the parser the validators using the cache must evaluate their expressions with.
+     *
+     *      @return The recording parser. Valid as long as the cache exists.
+     */
+    QSharedPointer<ExpressionParser> getRecordingParser() const;
+
+    /*!
+     *  Gets the validity of an element, validating it only if there is no up-to-date result.
+     *
+     *      @param [in] element     The element to validate.
+     *      @param [in] context     Values outside the element the validity depends on, e.g. address unit bits.
+     *      @param [in] validator   Function validating the element.
+     *
+     *      @return True, if the element is valid, otherwise false.
+     */
+    bool validate(QSharedPointer<const void> element, QString const& context,
+        std::function<bool()> const& validator);
+
+    /*!
+     *  Records the identifiers of an evaluated expression for the elements under validation.
+     *
+     *      @param [in] expression  The evaluated expression.
+     */
+    void recordExpression(QString const& expression);
+
+    /*!
+     *  Removes the result of an element and of all the elements containing it.
+     *
+     *  If nothing is known about the element, all the results are removed.
+     *
+     *      @param [in] element     The changed element.
+     */
+    void invalidate(void const* element);
+
+    //! Removes all the results.
+    void clear();
+
+private:
+
+    // Disable copying.
+    ValidationCache(ValidationCache const& rhs);
+    ValidationCache& operator=(ValidationCache const& rhs);
+
+    //! Stored validation result of an element.
+    struct Result
+    {
+        //! The validated element, expired if the element has been deleted.
+        QWeakPointer<const void> element;
+
+        //! The context the element was validated in.
+        QString context;
+
+        //! The validity of the element.
+        bool valid = false;
+
+        //! The identifiers referenced during the validation and their values.
+        QHash<QString, QString> references;
+    };
+
+    //! An element under validation.
+    struct Frame
+    {
+        //! The element being validated.
+        void const* element;
+
+        //! The identifiers referenced so far and their values.
+        QHash<QString, QString> references;
+    };
+
+    /*!
+     *  Checks if the stored result of an element can be used.
+     *
+     *      @param [in] result      The stored result.
+     *      @param [in] element     The element to validate.
+     *      @param [in] context     The current context of the element.
+     *
+     *      @return True, if the result is up to date, otherwise false.
+     */
+    bool isUpToDate(Result const& result, QSharedPointer<const void> const& element,
+        QString const& context) const;
+
+    /*!
+     *  Adds the references of a validated element to the element containing it.
+     *
+     *      @param [in] element     The validated element.
+     *      @param [in] references  The references of the validated element.
+     */
+    void addToContainer(void const* element, QHash<QString, QString> const& references);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The parser for evaluating the recorded identifiers.
+    QSharedPointer<ExpressionParser> expressionParser_;
+
+    //! The parser recording the expressions evaluated by the validators.
+    QSharedPointer<ExpressionParser> recordingParser_;
+
+    //! The stored results by element.
+    QHash<void const*, Result> results_;
+
+    //! The containing element of each element validated as a part of another element.
+    QHash<void const*, void const*> containers_;
+
+    //! The elements under validation, innermost last.
+    QVector<Frame> validationStack_;
+};
+
+#endif // VALIDATIONCACHE_H
@@ -13,6 +13,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h \
     ./editors/ComponentEditor/referenceCounter/ReferenceCounter.h \
     ./common/KactusAPI.h \
+    ./common/ChecksummedFile.h \
     ./common/NameGenerationPolicy.h \
     ./common/Global.h \
     ./common/KactusColors.h \
@@ -233,7 +234,10 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./Plugins/common/SourceHighlightStyle.h \
     ./Plugins/common/LanguageHighlighter.h \
     ./library/DocumentFileAccess.h \
+    ./library/DocumentStreamReader.h \
     ./library/DocumentValidator.h \
+    ./library/LibraryBatchValidator.h \
+    ./library/LibraryDependencyGraph.h \
     ./library/LibraryInterface.h \
     ./library/LibraryItemSelectionFactory.h \
     ./library/LibraryUtils.h \
@@ -247,6 +251,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./library/LibraryTreeModel.h \
     ./library/LibraryTreeWidget.h \
     ./library/LibraryTreeView.h \
+    ./library/LibraryIndex.h \
     ./library/LibraryLoader.h \
     ./library/LibraryWidget.h \
     ./library/VLNVDialer/dialerwidget.h \
@@ -450,6 +455,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyGraphWidget.h \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyGraphView.h \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyInfoWidget.h \
+    ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.h \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.h \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyModel.h \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencySourceEditor.h \
@@ -903,6 +909,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
 SOURCES += ./VersionHelper.cpp \
     ./common/GenericEditProvider.cpp \
     ./common/KactusAPI.cpp \
+    ./common/ChecksummedFile.cpp \
     ./common/NameGenerationPolicy.cpp \
     ./common/TextEditProvider.cpp \
     ./common/utils.cpp \
@@ -1082,13 +1089,17 @@ SOURCES += ./VersionHelper.cpp \
     ./Plugins/common/LanguageHighlighter.cpp \
     ./Plugins/common/SourceHighlightStyle.cpp \
     ./library/DocumentFileAccess.cpp \
+    ./library/DocumentStreamReader.cpp \
     ./library/DocumentValidator.cpp \
+    ./library/LibraryBatchValidator.cpp \
+    ./library/LibraryDependencyGraph.cpp \
     ./library/ItemExporter.cpp \
     ./library/LibraryErrorModel.cpp \
     ./library/LibraryFilter.cpp \
     ./library/LibraryHandler.cpp \
     ./library/LibraryItem.cpp \
     ./library/LibraryItemSelectionFactory.cpp \
+    ./library/LibraryIndex.cpp \
     ./library/LibraryLoader.cpp \
     ./library/LibraryTreeFilter.cpp \
     ./library/LibraryTreeModel.cpp \
@@ -1189,6 +1200,7 @@ SOURCES += ./VersionHelper.cpp \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyGraphView.cpp \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyGraphWidget.cpp \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyInfoWidget.cpp \
+    ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.cpp \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.cpp \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyModel.cpp \
     ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencySortFilter.cpp \
@@ -609,7 +609,7 @@ void LinuxDeviceTreeGenerator::writeSingleAddressBlock(QTextStream& outputStream
     outputStream << endl;
     outputStream << prefix << "// Address block '" << blockName << "'" << endl;
 
-    quint64 blockAddress = blockItem->getAddress().toULongLong() + itemBaseAddress;
+    quint64 blockAddress = blockItem->getAddressValue() + itemBaseAddress;
     QString blockAddressString = QString::number(blockAddress, 16);
 
     outputStream << prefix << blockItem->getName() << "@" << blockAddressString << " {" <<  endl;
@@ -636,7 +636,7 @@ void LinuxDeviceTreeGenerator::writeSingleAddressBlock(QTextStream& outputStream
     General::Usage blockUsage = blockItem->getUsage();
     if (blockUsage == General::REGISTER)
     {
-        quint64 blockRange = blockItem->getRange().toULongLong();
+        quint64 blockRange = blockItem->getRangeValue();
         QString blockRangeString = QString::number(blockRange, 16);
 
         outputStream << prefix << "reg = <0x" << blockAddressString << " 0x" << blockRangeString << ">;" << endl;
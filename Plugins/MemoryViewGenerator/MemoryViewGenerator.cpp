@@ -74,16 +74,16 @@ void MemoryViewGenerator::writeFile(QString const& outputPath,
 
     QTextStream outputStream(&outputFile);
 
-    outputStream << "Identifier;Type;Address;Range (AUB);Width (bits);Size (bits);Offset (bits);" << endl;
+    outputStream << "Identifier;Type;Address;Range (AUB);Width (bits);Size (bits);Offset (bits);\n";
 
     foreach (QVector<QSharedPointer<const ConnectivityInterface> > path, masterRoutes)
     {        
-        int addressOffset = path.first()->getBaseAddress().toInt();
+        quint64 addressOffset = path.first()->getBaseAddress().toULongLong();
         foreach (QSharedPointer<const ConnectivityInterface> inter, path)
         {
             if (inter->getMode() == "mirroredSlave")
             {
-                addressOffset += inter->getRemapAddress().toInt();
+                addressOffset += inter->getRemapAddress().toULongLong();
             }
         }
 
@@ -101,14 +101,15 @@ void MemoryViewGenerator::writeFile(QString const& outputPath,
 //-----------------------------------------------------------------------------
 // Function: MemoryViewGenerator::writeItem()
 //-----------------------------------------------------------------------------
-void MemoryViewGenerator::writeItem(QSharedPointer<MemoryItem> item, int addressOffset, QTextStream& outputStream)
+void MemoryViewGenerator::writeItem(QSharedPointer<MemoryItem> item, quint64 addressOffset,
+    QTextStream& outputStream)
 {
     if (item)
     {
         outputStream << item->getIdentifier() << ";" << item->getType() << ";" <<
-            "0x" + QString::number(addressOffset + item->getAddress().toInt(), 16) << ";" << 
+            "0x" + QString::number(addressOffset + item->getAddressValue(), 16) << ";" << 
             item->getRange() << ";" << item->getWidth() << ";" << item->getSize() << ";" <<
-            item->getOffset() << ";" << endl;
+            item->getOffset() << ";\n";
 
         foreach (QSharedPointer<MemoryItem> child, item->getChildItems())
         {
@@ -80,7 +80,7 @@ private:
      *      @param [in] addressOffset   Offset for the memory item.
      *      @param [in] outputStream    The output to write the element into.
      */
-    void writeItem(QSharedPointer<MemoryItem> item, int addressOffset, QTextStream& outputStream);
+    void writeItem(QSharedPointer<MemoryItem> item, quint64 addressOffset, QTextStream& outputStream);
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -21,11 +21,14 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../editors/ComponentEditor/common/ParameterCache.h \
     ./MemoryViewGeneratorPlugin.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
     ../common/HDLParser/MetaInstance.h \
+    ../common/HDLParser/MetaInstanceCache.h \
+    ../common/HDLParser/MessageBuffer.h \
     ../../editors/ComponentEditor/common/ExpressionFormatter.h \
     ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../IPXACTmodels/utilities/Search.h
@@ -46,11 +49,14 @@ SOURCES += ../../editors/common/ComponentInstanceParameterFinder.cpp \
     ./MemoryViewGenerator.cpp \
     ./MemoryViewGeneratorPlugin.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
     ../common/HDLParser/MetaInstance.cpp \
+    ../common/HDLParser/MetaInstanceCache.cpp \
+    ../common/HDLParser/MessageBuffer.cpp \
     ../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
     ../../IPXACTmodels/utilities/ComponentSearch.cpp
 RESOURCES += MemoryViewGenerator.qrc
@@ -8,6 +8,8 @@ HEADERS += ./modelsimgenerator_global.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
     ../common/HDLParser/MetaInstance.h \
+    ../common/HDLParser/MetaInstanceCache.h \
+    ../common/HDLParser/MessageBuffer.h \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../editors/ComponentEditor/common/ExpressionFormatter.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
@@ -16,6 +18,7 @@ HEADERS += ./modelsimgenerator_global.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
     ../PluginSystem/GeneratorPlugin/IGeneratorPlugin.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../PluginSystem/GeneratorPlugin/MessagePasser.h \
@@ -33,6 +36,8 @@ SOURCES += ./ModelSimGeneratorPlugin.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
     ../common/HDLParser/MetaInstance.cpp \
+    ../common/HDLParser/MetaInstanceCache.cpp \
+    ../common/HDLParser/MessageBuffer.cpp \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
@@ -40,6 +45,7 @@ SOURCES += ./ModelSimGeneratorPlugin.cpp \
     ../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
     ../PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
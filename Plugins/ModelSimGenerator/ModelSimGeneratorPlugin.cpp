@@ -203,6 +203,7 @@ void ModelSimGeneratorPlugin::runGenerator(IPluginUtility* utility, QSharedPoint
     (utility->getLibraryInterface(), &factory, input, &settings_));
 
     configuration->getOutputControl()->setOutputPath(outputDirectory);
+    configuration->setFormatPreview(false);
 
     configuration->parseDocuments();
 
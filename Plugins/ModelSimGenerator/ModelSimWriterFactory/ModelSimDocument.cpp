@@ -32,6 +32,20 @@ void ModelSimDocument::write(QString const& outputDirectory)
     writer_->write(outputStream, outputDirectory);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ModelSimDocument::writeContent()
+//-----------------------------------------------------------------------------
+void ModelSimDocument::writeContent(QTextStream& outputStream, QString const& outputDirectory)
+{
+    if (contentFormatted_)
+    {
+        outputStream << fileContent_;
+        return;
+    }
+
+    writer_->write(outputStream, outputDirectory);
+}
+
 //-----------------------------------------------------------------------------
 // Function: ModelSimDocument::getImplementation()
 //-----------------------------------------------------------------------------
@@ -37,6 +37,14 @@ struct ModelSimDocument : public GenerationOutput
      *      @param [in] outputDirectory         The possible output directory.
      */
 	void write(QString const& outputDirectory);
+
+    /*!
+     *  Writes the content to the given stream, directly from the writer unless already formatted.
+     *
+     *      @param [in] outputStream            The stream to write to.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    void writeContent(QTextStream& outputStream, QString const& outputDirectory);
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
@@ -109,3 +109,11 @@ QString ModelSimWriterFactory::getGroupIdentifier() const
 {
     return QStringLiteral("simulation");
 }
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriterFactory::getGeneratorVersion()
+//-----------------------------------------------------------------------------
+QString ModelSimWriterFactory::getGeneratorVersion() const
+{
+    return generatorVersion_ + QLatin1Char('/') + kactusVersion_;
+}
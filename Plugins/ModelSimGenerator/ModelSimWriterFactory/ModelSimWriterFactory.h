@@ -80,6 +80,11 @@ public:
      */
     virtual QString getGroupIdentifier() const;
 
+    /*!
+     *  Returns the version identifying the generator and the Kactus2 build producing the outputs.
+     */
+    virtual QString getGeneratorVersion() const;
+
 private:
 
     //-----------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "GenerationControl.h"
+#include "GenerationManifest.h"
 
 #include <common/ui/MessageMediator.h>
 
@@ -19,9 +20,40 @@
 #include <IPXACTmodels/Design/Design.h>
 #include <IPXACTmodels/designConfiguration/DesignConfiguration.h>
 
+#include <QCryptographicHash>
+#include <QFile>
 #include <QFileInfo>
 #include <QRegularExpression>
 #include <QDateTime>
+#include <QTextStream>
+
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: formatOutputs()
+    //-----------------------------------------------------------------------------
+    void formatOutputs(QList<QSharedPointer<GenerationOutput> > outputs, QString const& outputPath)
+    {
+        // Each output formats only its own content, so the result does not depend on the completion order.
+        QtConcurrent::blockingMap(outputs, [&outputPath](QSharedPointer<GenerationOutput>& output)
+        {
+            output->formatContent(outputPath);
+        });
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: addHashField()
+    //-----------------------------------------------------------------------------
+    void addHashField(QCryptographicHash& hash, QString const& field)
+    {
+        hash.addData(field.toUtf8());
+        hash.addData("\0", 1);
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::GenerationControl()
@@ -29,7 +61,7 @@
 GenerationControl::GenerationControl(LibraryInterface* library,
     IWriterFactory* factory, GenerationTuple input, GenerationSettings* settings) :
 	library_(library), factory_(factory), input_(input), settings_(settings), isDesignGeneration_(input.design != 0),
-    outputControl_(new OutputControl)
+    formatPreview_(true), outputControl_(new OutputControl)
 {
     // Find views usable for the generation.
     QSharedPointer<QList<QSharedPointer<View> > > possibleViews;
@@ -100,27 +132,57 @@ bool GenerationControl::writeDocuments()
 
     bool fails = false;
 
-    // Go through each potential file.
-    foreach(QSharedPointer<GenerationOutput> output, *outputControl_->getOutputs())
+    // Form the paths from the determined output path plus determined file name.
+    QList<QSharedPointer<GenerationOutput> > outputs = *outputControl_->getOutputs();
+    QStringList filePaths;
+    QHash<QString, int> lastOutputForPath;
+    for (QSharedPointer<GenerationOutput> output : outputs)
+    {
+        filePaths.append(outputControl_->getOutputPath() + "/" + output->fileName_);
+        lastOutputForPath.insert(filePaths.last(), filePaths.size() - 1);
+    }
+
+    GenerationManifest manifest(outputControl_->getOutputPath());
+    manifest.load();
+
+    // Write the files concurrently. As in sequential writing, the last output wins if a path is repeated.
+    QHash<QString, QByteArray> documentHashes;
+    QHash<QString, QByteArray> inputHashes;
+    QHash<QString, QFuture<GenerationManifest::WriteResult> > writes;
+    for (auto path = lastOutputForPath.cbegin(); path != lastOutputForPath.cend(); ++path)
+    {
+        QSharedPointer<GenerationOutput> output = outputs.at(path.value());
+        inputHashes.insert(path.key(), inputHash(output, documentHashes));
+
+        writes.insert(path.key(), QtConcurrent::run(GenerationManifest::writeOutput, path.key(), output,
+            outputControl_->getOutputPath(), inputHashes.value(path.key()), manifest.getEntry(output->fileName_)));
+    }
+
+    // Report and add the files to the file set in the output order.
+    for (int i = 0; i < outputs.size(); ++i)
     {
-        // Form the path from the determined output path plus determined file name.
-        QString absFilePath = outputControl_->getOutputPath() + "/" + output->fileName_;
+        QString const& absFilePath = filePaths.at(i);
+        GenerationManifest::WriteResult const written = writes.value(absFilePath).result();
 
-        // Try to open the file.
-        QFile outputFile(absFilePath); 
-        if (!outputFile.open(QIODevice::WriteOnly))
+        if (written.status == GenerationManifest::WriteResult::FAILED)
         {
             input_.messages->showError(QObject::tr("Could not open output file for writing: %1").arg(absFilePath));
             fails = true;
             continue;
         }
 
-        // Put the content to the file and close it.
-        QTextStream outputStream(&outputFile);
-
-        outputStream << output->fileContent_;
+        if (lastOutputForPath.value(absFilePath) == i)
+        {
+            GenerationManifest::Entry entry;
+            entry.inputHash = inputHashes.value(absFilePath);
+            entry.contentHash = written.contentHash;
+            manifest.setEntry(outputs.at(i)->fileName_, entry);
 
-        outputFile.close();
+            if (written.status == GenerationManifest::WriteResult::UNCHANGED)
+            {
+                input_.messages->showMessage(QObject::tr("File %1 is up to date.").arg(absFilePath));
+            }
+        }
 
         if (viewSelection_->getSaveToFileset())
         {
@@ -135,6 +197,12 @@ bool GenerationControl::writeDocuments()
         }
     }
 
+    if (!manifest.save())
+    {
+        input_.messages->showMessage(QObject::tr("Could not write the generation manifest to %1.").arg(
+            outputControl_->getOutputPath()));
+    }
+
     // Return false if something fails.
     return !fails && saveChanges();
 }
@@ -222,27 +290,21 @@ void GenerationControl::initializeDocuments()
             return;
         }
 
-        // Write outputs.
-        input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
-            arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
-
         // Pass the topmost design.
         QList<QSharedPointer<GenerationOutput> > documents = factory_->prepareDesign(designs);
+        documents.removeAll(QSharedPointer<GenerationOutput>());
 
-        // Go through the parsed designs.
-        foreach(QSharedPointer<GenerationOutput> output, documents)
+        // Format the contents of the documents. Without preview, the contents are streamed when written.
+        if (formatPreview_)
         {
-            if (!output)
-            {
-                continue;
-            }
-
-            // Write the contents to a file.
-            output->write(outputControl_->getOutputPath());
+            input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
+                arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
 
-            // Append to the list of proposed outputs.
-            outputControl_->getOutputs()->append(output);
+            formatOutputs(documents, outputControl_->getOutputPath());
         }
+
+        // Append to the list of proposed outputs.
+        outputControl_->getOutputs()->append(documents);
     }
     else
     {
@@ -264,9 +326,12 @@ void GenerationControl::initializeDocuments()
         }
 
         // Write outputs.
-        input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
-            arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
-        output->write(outputControl_->getOutputPath());
+        if (formatPreview_)
+        {
+            input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
+                arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
+            output->formatContent(outputControl_->getOutputPath());
+        }
 
         // Append to the list of proposed outputs.
         outputControl_->getOutputs()->append(output);
@@ -305,10 +370,11 @@ void GenerationControl::reInitializeDocuments(
                     matchingMeta->getTopInstance()->getModuleName());
                 output->fileName_ = matchingMetaOutput->fileName_;
 
-                output->write(outputControl_->getOutputPath());
                 newGenerations.append(output);
             }
         }
+
+        formatOutputs(newGenerations, outputControl_->getOutputPath());
     }
     else
     {
@@ -328,7 +394,7 @@ void GenerationControl::reInitializeDocuments(
                 if (output)
                 {
                     output->fileName_ = selection->fileName_;
-                    output->write(outputControl_->getOutputPath());
+                    output->formatContent(outputControl_->getOutputPath());
                     newGenerations.append(output);
                 }
             }
@@ -342,6 +408,67 @@ void GenerationControl::reInitializeDocuments(
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::inputHash()
+//-----------------------------------------------------------------------------
+QByteArray GenerationControl::inputHash(QSharedPointer<GenerationOutput> output,
+    QHash<QString, QByteArray>& documentHashes) const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    addHashField(hash, factory_->getLanguage());
+    addHashField(hash, factory_->getGeneratorVersion());
+    addHashField(hash, settings_->generateInterfaces_ ? QStringLiteral("1") : QStringLiteral("0"));
+    addHashField(hash, output->fileName_);
+    addHashField(hash, output->vlnv_);
+
+    QSharedPointer<MetaComponent> metaComponent = output->metaComponent_;
+    if (output->metaDesign_)
+    {
+        metaComponent = output->metaDesign_->getTopInstance();
+    }
+
+    if (!metaComponent)
+    {
+        // Without the parsed component, there is nothing to compare the inputs with.
+        return QByteArray();
+    }
+
+    addHashField(hash, metaComponent->getModuleName());
+    if (metaComponent->getActiveView())
+    {
+        addHashField(hash, metaComponent->getActiveView()->name());
+    }
+
+    // The resolved values include the values propagated from the upper levels of the hierarchy.
+    QSharedPointer<QMap<QString, QSharedPointer<Parameter> > > parameters = metaComponent->getMetaParameters();
+    for (auto parameter = parameters->cbegin(); parameter != parameters->cend(); ++parameter)
+    {
+        addHashField(hash, parameter.key());
+        addHashField(hash, parameter.value()->getValue());
+    }
+
+    // The documents the component depends on, including its designs and configurations.
+    QList<VLNV> documents;
+    library_->getNeededVLNVs(metaComponent->getComponent()->getVlnv(), documents);
+    std::sort(documents.begin(), documents.end());
+
+    for (VLNV const& document : documents)
+    {
+        QString const path = library_->getPath(document);
+        if (!documentHashes.contains(path))
+        {
+            QFile documentFile(path);
+            documentHashes.insert(path, documentFile.open(QIODevice::ReadOnly) ?
+                GenerationManifest::hash(documentFile.readAll()) : QByteArray());
+        }
+
+        addHashField(hash, document.toString());
+        addHashField(hash, QString::fromLatin1(documentHashes.value(path)));
+    }
+
+    return hash.result().toHex();
+}
+
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::getMatchingMetaDesign()
 //-----------------------------------------------------------------------------
@@ -360,6 +487,14 @@ QSharedPointer<GenerationOutput> GenerationControl::getMatchingMetaDesignOutput(
     return QSharedPointer<GenerationOutput>();
 }
 
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::setFormatPreview()
+//-----------------------------------------------------------------------------
+void GenerationControl::setFormatPreview(bool formatPreview)
+{
+    formatPreview_ = formatPreview;
+}
+
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::getViewSelection()
 //-----------------------------------------------------------------------------
@@ -555,7 +690,7 @@ QSharedPointer<GenerationOutput> GenerationControl::setupRenamedSelection(int co
             input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
                 arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
 
-            output->write(outputControl_->getOutputPath());
+            output->formatContent(outputControl_->getOutputPath());
 
             selection = output;
             generationOutputs->replace(fileIndex, selection);
@@ -17,6 +17,9 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h>
 
+#include <QByteArray>
+#include <QHash>
+
 class LibraryInterface;
 
 struct GenerationSettings
@@ -69,6 +72,14 @@ public:
      *  Parses the documents so that we know what will be generated.
      */
     void parseDocuments();
+
+    /*!
+     *  Sets whether the contents are formatted for preview when parsing the documents. Contents not formatted
+     *  for preview are streamed directly to the files when writing the documents.
+     *
+     *      @param [in] formatPreview   True to format the contents for preview, otherwise false.
+     */
+    void setFormatPreview(bool formatPreview);
 	
     /*!
      *  Gets the view selection data.
@@ -147,6 +158,16 @@ private:
      */
     QSharedPointer<GenerationOutput> getMatchingMetaDesignOutput(QSharedPointer<GenerationOutput> output) const;
 
+    /*!
+     *  Calculates a hash of everything the content of the given output is generated from.
+     *
+     *      @param [in] output              The generation output.
+     *      @param [in/out] documentHashes  The hashes of the already read library documents by path.
+     *
+     *      @return The hash of the inputs. Empty, if the inputs cannot be determined.
+     */
+    QByteArray inputHash(QSharedPointer<GenerationOutput> output, QHash<QString, QByteArray>& documentHashes) const;
+
     /*!
      *  Returns the default output path.     
      */
@@ -183,6 +204,8 @@ private:
     GenerationSettings* settings_;
     //! True, if the generation target is deemed to be a design. False, if it is a component.
     bool isDesignGeneration_;
+    //! True, if the contents are formatted for preview when parsing the documents.
+    bool formatPreview_;
     //! The file output configuration.
     QSharedPointer<OutputControl> outputControl_;
     //! The view selection configuration.
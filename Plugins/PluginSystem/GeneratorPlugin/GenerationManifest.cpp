@@ -0,0 +1,223 @@
+//-----------------------------------------------------------------------------
+// File: GenerationManifest.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Record of the inputs and contents of the files written by a generator in an output directory.
+//-----------------------------------------------------------------------------
+
+#include "GenerationManifest.h"
+#include "OutputControl.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTextStream>
+
+namespace
+{
+    //! The name of the manifest file in the output directory.
+    const QString MANIFEST_FILE_NAME = QStringLiteral(".kactus2_generation_manifest.json");
+
+    //! The format version of the manifest file.
+    const int MANIFEST_VERSION = 1;
+
+    //-----------------------------------------------------------------------------
+    //! Passes the written data to another device while hashing it.
+    //-----------------------------------------------------------------------------
+    class HashingDevice : public QIODevice
+    {
+    public:
+
+        explicit HashingDevice(QIODevice* target): target_(target), hash_(QCryptographicHash::Sha1) {}
+
+        //! Returns the hash of the data written so far.
+        QByteArray result() const { return hash_.result().toHex(); }
+
+    protected:
+
+        qint64 readData(char* /*data*/, qint64 /*maxSize*/) override { return -1; }
+
+        qint64 writeData(char const* data, qint64 length) override
+        {
+            hash_.addData(data, static_cast<int>(length));
+            return target_->write(data, length);
+        }
+
+    private:
+
+        //! The device receiving the data.
+        QIODevice* target_;
+
+        //! The hash of the written data.
+        QCryptographicHash hash_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::GenerationManifest()
+//-----------------------------------------------------------------------------
+GenerationManifest::GenerationManifest(QString const& outputDirectory):
+outputDirectory_(outputDirectory),
+entries_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::load()
+//-----------------------------------------------------------------------------
+void GenerationManifest::load()
+{
+    entries_.clear();
+
+    QFile manifestFile(manifestPath());
+    if (!manifestFile.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    QJsonObject const manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+    if (manifest.value(QStringLiteral("version")).toInt() != MANIFEST_VERSION)
+    {
+        return;
+    }
+
+    QJsonObject const files = manifest.value(QStringLiteral("files")).toObject();
+    for (auto file = files.constBegin(); file != files.constEnd(); ++file)
+    {
+        QJsonObject const recorded = file.value().toObject();
+
+        Entry entry;
+        entry.inputHash = recorded.value(QStringLiteral("inputs")).toString().toLatin1();
+        entry.contentHash = recorded.value(QStringLiteral("content")).toString().toLatin1();
+        entries_.insert(file.key(), entry);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::save()
+//-----------------------------------------------------------------------------
+bool GenerationManifest::save() const
+{
+    QJsonObject files;
+    for (auto entry = entries_.cbegin(); entry != entries_.cend(); ++entry)
+    {
+        QJsonObject recorded;
+        recorded.insert(QStringLiteral("inputs"), QString::fromLatin1(entry->inputHash));
+        recorded.insert(QStringLiteral("content"), QString::fromLatin1(entry->contentHash));
+        files.insert(entry.key(), recorded);
+    }
+
+    QJsonObject manifest;
+    manifest.insert(QStringLiteral("version"), MANIFEST_VERSION);
+    manifest.insert(QStringLiteral("files"), files);
+
+    QSaveFile manifestFile(manifestPath());
+    if (!manifestFile.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    manifestFile.write(QJsonDocument(manifest).toJson());
+    return manifestFile.commit();
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::getEntry()
+//-----------------------------------------------------------------------------
+GenerationManifest::Entry GenerationManifest::getEntry(QString const& fileName) const
+{
+    return entries_.value(fileName);
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::setEntry()
+//-----------------------------------------------------------------------------
+void GenerationManifest::setEntry(QString const& fileName, Entry const& entry)
+{
+    entries_.insert(fileName, entry);
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::hash()
+//-----------------------------------------------------------------------------
+QByteArray GenerationManifest::hash(QByteArray const& content)
+{
+    return QCryptographicHash::hash(content, QCryptographicHash::Sha1).toHex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::writeOutput()
+//-----------------------------------------------------------------------------
+GenerationManifest::WriteResult GenerationManifest::writeOutput(QString const& filePath,
+    QSharedPointer<GenerationOutput> output, QString const& outputDirectory, QByteArray const& inputHash,
+    Entry const& recorded)
+{
+    WriteResult result;
+
+    QByteArray existingHash;
+    QFile existingFile(filePath);
+    bool const exists = existingFile.open(QIODevice::ReadOnly);
+    if (exists)
+    {
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        hash.addData(&existingFile);
+        existingHash = hash.result().toHex();
+        existingFile.close();
+    }
+
+    // Unchanged inputs produce the same output, unless the file has been modified after it was written.
+    if (exists && !recorded.inputHash.isEmpty() && recorded.inputHash == inputHash &&
+        existingHash == recorded.contentHash)
+    {
+        result.status = WriteResult::UNCHANGED;
+        result.contentHash = recorded.contentHash;
+        return result;
+    }
+
+    // The content is streamed to a temporary file, which replaces the existing one only if they differ.
+    QSaveFile outputFile(filePath);
+    if (!outputFile.open(QIODevice::WriteOnly))
+    {
+        return result;
+    }
+
+    HashingDevice sink(&outputFile);
+    sink.open(QIODevice::WriteOnly);
+
+    QTextStream outputStream(&sink);
+    outputStream.setCodec("UTF-8");
+    output->writeContent(outputStream, outputDirectory);
+    outputStream.flush();
+
+    result.contentHash = sink.result();
+
+    // Rewriting identical content would only touch the modification time of the file.
+    if (exists && result.contentHash == existingHash)
+    {
+        outputFile.cancelWriting();
+        result.status = WriteResult::UNCHANGED;
+        return result;
+    }
+
+    if (outputFile.commit())
+    {
+        result.status = WriteResult::WRITTEN;
+    }
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationManifest::manifestPath()
+//-----------------------------------------------------------------------------
+QString GenerationManifest::manifestPath() const
+{
+    return outputDirectory_ + QLatin1Char('/') + MANIFEST_FILE_NAME;
+}
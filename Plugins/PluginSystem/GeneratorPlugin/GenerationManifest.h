@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------------
+// File: GenerationManifest.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Record of the inputs and contents of the files written by a generator in an output directory.
+//-----------------------------------------------------------------------------
+
+#ifndef GENERATIONMANIFEST_H
+#define GENERATIONMANIFEST_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+
+struct GenerationOutput;
+
+//-----------------------------------------------------------------------------
+//! Record of the inputs and contents of the files written by a generator in an output directory.
+//
+// The manifest is stored as a hidden file in the output directory. A generated file whose inputs and
+// content on disk match the recorded ones does not need to be written again.
+//-----------------------------------------------------------------------------
+class GenerationManifest
+{
+public:
+
+    //! The recorded generation of a single file.
+    struct Entry
+    {
+        QByteArray inputHash;       //!< Hash of everything the content was generated from.
+        QByteArray contentHash;     //!< Hash of the written file content.
+    };
+
+    //! The outcome of writing a single output file.
+    struct WriteResult
+    {
+        enum Status
+        {
+            WRITTEN,
+            UNCHANGED,
+            FAILED
+        };
+
+        Status status = FAILED;     //!< Whether the file was written, left as it was or could not be written.
+        QByteArray contentHash;     //!< Hash of the file content after the write.
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] outputDirectory     The directory containing the generated files.
+     */
+    explicit GenerationManifest(QString const& outputDirectory);
+
+    //! The destructor.
+    ~GenerationManifest() = default;
+
+    /*!
+     *  Reads the manifest of the output directory. A missing or broken manifest results in no entries.
+     */
+    void load();
+
+    /*!
+     *  Writes the manifest to the output directory.
+     *
+     *      @return True, if the manifest was written, otherwise false.
+     */
+    bool save() const;
+
+    /*!
+     *  Gets the recorded generation of a file.
+     *
+     *      @param [in] fileName    The name of the file in the output directory.
+     *
+     *      @return The recorded entry. Empty, if the file has not been recorded.
+     */
+    Entry getEntry(QString const& fileName) const;
+
+    /*!
+     *  Records the generation of a file.
+     *
+     *      @param [in] fileName    The name of the file in the output directory.
+     *      @param [in] entry       The generation of the file.
+     */
+    void setEntry(QString const& fileName, Entry const& entry);
+
+    /*!
+     *  Calculates the hash used for the file contents.
+     *
+     *      @param [in] content     The file content.
+     *
+     *      @return The hash of the content.
+     */
+    static QByteArray hash(QByteArray const& content);
+
+    /*!
+     *  Writes an output to the given file, unless the file is up to date.
+     *
+     *  The file is up to date, if its inputs match the recorded ones and it has not been modified after it
+     *  was written. Then the output is not formatted at all. Otherwise the output is written, but the file
+     *  is replaced only if the new content differs from it, so that an identical file keeps its modification
+     *  time. Safe to call concurrently for different files.
+     *
+     *      @param [in] filePath            The path to the output file.
+     *      @param [in] output              The output to write.
+     *      @param [in] outputDirectory     The directory of the output file.
+     *      @param [in] inputHash           Hash of everything the output is generated from.
+     *      @param [in] recorded            The recorded generation of the file.
+     *
+     *      @return The outcome of the write.
+     */
+    static WriteResult writeOutput(QString const& filePath, QSharedPointer<GenerationOutput> output,
+        QString const& outputDirectory, QByteArray const& inputHash, Entry const& recorded);
+
+private:
+
+    //! Returns the path of the manifest file.
+    QString manifestPath() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The directory containing the generated files.
+    QString outputDirectory_;
+
+    //! The recorded generations by file name.
+    QHash<QString, Entry> entries_;
+};
+
+#endif // GENERATIONMANIFEST_H
@@ -59,6 +59,11 @@ public:
      *  Returns the group identifier suitable for the produced files.
      */
     virtual QString getGroupIdentifier() const = 0;
+
+    /*!
+     *  Returns the version identifying the generator and the Kactus2 build producing the outputs.
+     */
+    virtual QString getGeneratorVersion() const = 0;
 };
 
 #endif // IWRITERFACTORY_H
@@ -16,6 +16,29 @@
 #include <IPXACTmodels/Component/FileSet.h>
 
 #include <QDir>
+#include <QTextStream>
+
+//-----------------------------------------------------------------------------
+// Function: GenerationOutput::formatContent()
+//-----------------------------------------------------------------------------
+void GenerationOutput::formatContent(QString const& outputDirectory)
+{
+    write(outputDirectory);
+    contentFormatted_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationOutput::writeContent()
+//-----------------------------------------------------------------------------
+void GenerationOutput::writeContent(QTextStream& outputStream, QString const& outputDirectory)
+{
+    if (!contentFormatted_)
+    {
+        formatContent(outputDirectory);
+    }
+
+    outputStream << fileContent_;
+}
 
 //-----------------------------------------------------------------------------
 // Function: OutputControl::OutputControl()
@@ -112,7 +135,7 @@ QSharedPointer<GenerationOutput> OutputControl::changeFileName(int index, QStrin
     }
 
     selection->fileName_ = newName;
-    selection->write(outputPath_);
+    selection->formatContent(outputPath_);
 
     return selection;
 }
\ No newline at end of file
@@ -20,6 +20,7 @@
 
 class MetaComponent;
 class MetaDesign;
+class QTextStream;
 
 struct GenerationOutput
 {
@@ -36,14 +37,33 @@ struct GenerationOutput
     //! The meta design of the output.
     QSharedPointer<MetaDesign> metaDesign_;
 
+    //! Flag for the content formatted into fileContent_.
+    bool contentFormatted_ = false;
+
     GenerationOutput() = default;
 
     virtual ~GenerationOutput() = default;
 
     /*!
-     *  Writes the content.
+     *  Writes the content. Outputs may be written concurrently, so only the output itself may be modified.
      */
 	virtual void write(QString const& outputDirectory) = 0;
+
+    /*!
+     *  Formats the content into fileContent_ e.g. for preview.
+     *
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    void formatContent(QString const& outputDirectory);
+
+    /*!
+     *  Writes the content to the given stream. Content already formatted is written as is, otherwise it
+     *  may be streamed without storing it in the output.
+     *
+     *      @param [in] outputStream            The stream to write to.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    virtual void writeContent(QTextStream& outputStream, QString const& outputDirectory);
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
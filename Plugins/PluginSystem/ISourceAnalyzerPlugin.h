@@ -73,6 +73,8 @@ public:
      *  Calculates a language-dependent hash for the analyzed file. Hash calculation here may ignore
 	 *  whitespace and comments.
      *
+     *  The analysis calls this function concurrently for different files from worker threads.
+     *
      *      @param [in] filename  The name of the file.
      *
      *      @return The hash value for the file.
@@ -104,6 +106,10 @@ public:
     /*!
      *  Retrieves all file dependencies the given file has.
 	 *
+     *  The analysis calls this function concurrently for different files from worker threads between
+     *  beginAnalysis() and endAnalysis(). The data prepared in beginAnalysis() may only be read here.
+     *  The component is a snapshot taken for the analysis, so it does not change until endAnalysis().
+	 *
      *      @param [in]  component      The component to which the dependency scan is being run.
      *      @param [in]  componentPath  The path to the directory where the component is located.
      *      @param [in]  filename       The name of the file to which the analysis is run.
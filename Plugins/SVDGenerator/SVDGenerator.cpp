@@ -315,7 +315,7 @@ void SVDGenerator::writeAddressBlocks(QXmlStreamWriter& writer,
 {
     for (auto blockItem : getAddressBlockItems(mapItem))
     {
-        quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
+        quint64 blockBaseAddress = blockItem->getAddressValue();
         if (blockBaseAddress >= mapBaseAddress)
         {
             blockBaseAddress = blockBaseAddress - mapBaseAddress;
@@ -371,7 +371,7 @@ void SVDGenerator::writeSingleAddressBlock(QXmlStreamWriter& writer, quint64 con
     writer.writeStartElement("addressBlock");
 
     QString addressOffsetInHexa = valueToHexa(offset);
-    QString rangeInHexa = valueToHexa(blockItem->getRange().toULongLong());
+    QString rangeInHexa = valueToHexa(blockItem->getRangeValue());
 
     writer.writeTextElement("offset", addressOffsetInHexa);
     writer.writeTextElement("size", rangeInHexa);
@@ -408,7 +408,7 @@ void SVDGenerator::writeRegisters(QXmlStreamWriter& writer, QSharedPointer<const
             continue;
         }
 
-        quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
+        quint64 blockBaseAddress = blockItem->getAddressValue();
         if (blockBaseAddress >= mapBaseAddress)
         {
             blockBaseAddress = blockBaseAddress - mapBaseAddress;
@@ -465,7 +465,7 @@ void SVDGenerator::writeRegister(QXmlStreamWriter& writer, QSharedPointer<Memory
     writer.writeTextElement("name", formatName(registerItem->getName()));
     writeOptionalElement(writer, "description", realRegister->description());
 
-    quint64 registerOffset = registerItem->getOffset().toULongLong();
+    quint64 registerOffset = registerItem->getOffsetValue();
     QString addressOffsetInHexa = valueToHexa(registerOffset);
     QString sizeString = registerItem->getSize();
 
@@ -593,10 +593,10 @@ void SVDGenerator::writeFields(QXmlStreamWriter& writer, QSharedPointer<Register
 //-----------------------------------------------------------------------------
 quint64 SVDGenerator::getFieldStart(QSharedPointer<MemoryItem> fieldItem, quint64 registerOffset)
 {
-    quint64 fieldAddress = fieldItem->getAddress().toInt();
-    quint64 fieldOffset = fieldItem->getOffset().toInt();
+    quint64 fieldAddress = fieldItem->getAddressValue();
+    quint64 fieldOffset = fieldItem->getOffsetValue();
 
-    int aub = fieldItem->getAUB().toInt();
+    quint64 aub = fieldItem->getAUBValue();
 
     fieldOffset = (fieldAddress - registerOffset) * aub + fieldOffset;
     return fieldOffset;
@@ -607,7 +607,7 @@ quint64 SVDGenerator::getFieldStart(QSharedPointer<MemoryItem> fieldItem, quint6
 //-----------------------------------------------------------------------------
 quint64 SVDGenerator::getFieldEnd(QSharedPointer<MemoryItem> fieldItem, quint64 fieldOffset)
 {
-    quint64 fieldWidth = fieldItem->getWidth().toInt();
+    quint64 fieldWidth = fieldItem->getWidthValue();
 
     if (fieldWidth > 0)
     {
@@ -11,11 +11,14 @@ HEADERS += ./SVDGenerator.h \
     ./SVDGeneratorPlugin.h \
     ./ConnectivityGraphUtilities.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
     ../common/HDLParser/MetaInstance.h \
+    ../common/HDLParser/MetaInstanceCache.h \
+    ../common/HDLParser/MessageBuffer.h \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../editors/ComponentEditor/common/ExpressionFormatter.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
@@ -44,11 +47,14 @@ SOURCES += ./ConnectivityGraphUtilities.cpp \
     ./SVDGenerator.cpp \
     ./SVDGeneratorPlugin.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
     ../common/HDLParser/MetaInstance.cpp \
+    ../common/HDLParser/MetaInstanceCache.cpp \
+    ../common/HDLParser/MessageBuffer.cpp \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
@@ -5,7 +5,7 @@
 TEMPLATE = lib
 TARGET = VerilogGeneratorPlugin
 
-QT += core xml widgets gui
+QT += core xml widgets gui concurrent
 CONFIG += c++11 release
 DEFINES += VERILOGGENERATORPLUGIN_LIB
 
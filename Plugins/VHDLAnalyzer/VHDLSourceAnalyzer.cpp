@@ -124,7 +124,7 @@ QList<FileDependencyDesc> VHDLSourceAnalyzer::getFileDependencies(
 //-----------------------------------------------------------------------------
 // Function: VHDLSourceAnalyzer::getSourceData()
 //-----------------------------------------------------------------------------
-QString VHDLSourceAnalyzer::getSourceData(QString const& filename)
+QString VHDLSourceAnalyzer::getSourceData(QString const& filename) const
 {
 	// Try to open the file
 	QFile file(filename);
@@ -229,7 +229,7 @@ void VHDLSourceAnalyzer::scanPackages(QString const& source, QString const& file
 // Function: VHDLSourceAnalyzer::scanEntityReferences()
 //-----------------------------------------------------------------------------
 void VHDLSourceAnalyzer::scanEntityReferences(QString const& source, QString const& filename,
-	 QList<FileDependencyDesc>& dependencies)
+	 QList<FileDependencyDesc>& dependencies) const
 {
 	static QRegularExpression entityExp(
 		"\\b(\\w+)\\s+\\:\\s+(ENTITY\\s+)?(\\w+\\.)?(\\w+)\\s+(GENERIC|PORT)\\s+MAP\\b",
@@ -249,7 +249,7 @@ void VHDLSourceAnalyzer::scanEntityReferences(QString const& source, QString con
 // Function: VHDLSourceAnalyzer::scanPackageReferences()
 //-----------------------------------------------------------------------------
 void VHDLSourceAnalyzer::scanPackageReferences(QString const& source, QString const& filename,
-                                               QList<FileDependencyDesc>& dependencies)
+                                               QList<FileDependencyDesc>& dependencies) const
 {
     static QRegularExpression packageRefExp("\\bUSE\\s+(\\w+)\\.(\\w+)\\.(\\w+)\\b",
 		QRegularExpression::CaseInsensitiveOption);
@@ -273,16 +273,18 @@ void VHDLSourceAnalyzer::scanPackageReferences(QString const& source, QString co
 // Function: VHDLSourceAnalyzer::addDependency()
 //-----------------------------------------------------------------------------
 void VHDLSourceAnalyzer::addEntityDependency(QString const& componentName, QString const& filename,
-                                             QList<FileDependencyDesc>& dependencies)
+                                             QList<FileDependencyDesc>& dependencies) const
 {
 	const QString description("Component instantiation for entity %1");
   
     QString lowCase = componentName.toLower();
 
-    if (cachedEntities_.contains(lowCase))
+    // The definitions are shared by the worker threads, so they are only accessed through const lookups.
+    auto cachedEntity = cachedEntities_.constFind(lowCase);
+    if (cachedEntity != cachedEntities_.cend())
     {
         // Add all existing entities to the return value list.
-        for (auto const& cachedFile : cachedEntities_[lowCase])
+        for (auto const& cachedFile : cachedEntity.value())
         {
 			FileDependencyDesc dependency;
 			dependency.description = description.arg(componentName);
@@ -305,15 +307,16 @@ void VHDLSourceAnalyzer::addEntityDependency(QString const& componentName, QStri
 // Function: VHDLSourceAnalyzer::addPackageDependency()
 //-----------------------------------------------------------------------------
 void VHDLSourceAnalyzer::addPackageDependency(QString const& packageName, QString const& filename,
-                                              QList<FileDependencyDesc> &dependencies)
+                                              QList<FileDependencyDesc> &dependencies) const
 {
 	const QString description = "Reference to package %1";
   
     QString lowCase = packageName.toLower();
-    if (cachedPackages_.contains(lowCase))
+    auto cachedPackage = cachedPackages_.constFind(lowCase);
+    if (cachedPackage != cachedPackages_.cend())
     {
         // Add all existing entities to the return value list.
-        for (auto const& cachedFile : cachedPackages_[lowCase])
+        for (auto const& cachedFile : cachedPackage.value())
         {
 			FileDependencyDesc dependency;
 			dependency.description = description.arg(packageName);
@@ -336,7 +339,7 @@ void VHDLSourceAnalyzer::addPackageDependency(QString const& packageName, QStrin
 // Function: VHDLSourceAnalyzer::addUniqueDependency()
 //-----------------------------------------------------------------------------
 void VHDLSourceAnalyzer::addUniqueDependency(FileDependencyDesc const& dependency,
-	QList<FileDependencyDesc>& dependencies)
+	QList<FileDependencyDesc>& dependencies) const
 {
 	// Discard if this is a duplicate.
 	if (dependencies.contains(dependency))
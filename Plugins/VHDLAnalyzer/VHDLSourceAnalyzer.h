@@ -140,7 +140,7 @@ private:
      *
      *      @return The meaningful source data of the file, with comments and empty lines removed.
      */
-    QString getSourceData(QString const& filename);
+    QString getSourceData(QString const& filename) const;
 
     /*!
      *
@@ -175,7 +175,7 @@ private:
      *      @param [out] dependencies  The list of dependencies.
      */
     void scanEntityReferences(QString const& source, QString const& filename,
-                              QList<FileDependencyDesc>& dependencies);
+                              QList<FileDependencyDesc>& dependencies) const;
 
 
     /*!
@@ -186,7 +186,7 @@ private:
      *      @param [out] dependencies  The list of dependencies.
      */
     void scanPackageReferences(QString const& source, QString const& filename,
-                               QList<FileDependencyDesc>& dependencies);
+                               QList<FileDependencyDesc>& dependencies) const;
 
     /*!
      *  Adds a new entity dependency to the list of dependencies.
@@ -196,7 +196,7 @@ private:
      *      @param [out] dependencies  The list of dependencies.
      */
     void addEntityDependency(QString const& componentName, QString const& filename,
-                             QList<FileDependencyDesc> &dependencies);
+                             QList<FileDependencyDesc> &dependencies) const;
 
     /*!
      *  Adds a new package dependency to the list of dependencies.
@@ -206,14 +206,14 @@ private:
      *      @param [out] dependencies  The list of dependencies.
      */
     void addPackageDependency(QString const& packageName, QString const& filename,
-                              QList<FileDependencyDesc> &dependencies);
+                              QList<FileDependencyDesc> &dependencies) const;
 	/*!
 	 *  Adds a new dependency to the list of dependencies, if it is unique i.e. not in the list already.
 	 *
 	 *      @param [in] dependency		The dependency to add.
 	 *      @param [out] dependencies	The list of dependencies.
 	 */
-	void addUniqueDependency(FileDependencyDesc const& dependency, QList<FileDependencyDesc>& dependencies);
+	void addUniqueDependency(FileDependencyDesc const& dependency, QList<FileDependencyDesc>& dependencies) const;
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -222,10 +222,10 @@ private:
     //! The supported file types.
     QStringList fileTypes_ = QStringList("vhdlSource");
 
-    //! The container used for caching scanned entities.
+    //! The container used for caching scanned entities. Only read between beginAnalysis() and endAnalysis().
     QMap<QString, QStringList> cachedEntities_;
 
-    //! The container used for caching scanned packages.
+    //! The container used for caching scanned packages. Only read between beginAnalysis() and endAnalysis().
     QMap<QString, QStringList> cachedPackages_;
 };
 
@@ -248,6 +248,7 @@ void VerilogGeneratorPlugin::runGenerator(IPluginUtility* utility,
     GenerationControl configuration(utility->getLibraryInterface(), &factory, input, &settings_);
     configuration.getOutputControl()->setOutputPath(outputDirectory);
     configuration.getViewSelection()->setSaveToFileset(false);
+    configuration.setFormatPreview(false);
 
     configuration.parseDocuments();
     if (configuration.writeDocuments())
@@ -39,6 +39,7 @@ HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ./VerilogWriterFactory/VerilogWriterFactory.h \
     ./VerilogAssignmentWriter/VerilogAssignmentWriter.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../PluginSystem/GeneratorPlugin/MessagePasser.h \
@@ -49,7 +50,9 @@ HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../common/HDLParser/HDLParserCommon.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
-    ../common/HDLParser/MetaInstance.h
+    ../common/HDLParser/MetaInstance.h \
+    ../common/HDLParser/MetaInstanceCache.h \
+    ../common/HDLParser/MessageBuffer.h
 SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ../common/HDLParser/HDLCommandLineParser.cpp \
     ../common/LanguageHighlighter.cpp \
@@ -80,6 +83,7 @@ SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ./VerilogWriterFactory/VerilogWriterFactory.cpp \
     ./VerilogAssignmentWriter/VerilogAssignmentWriter.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
     ../PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
@@ -89,5 +93,7 @@ SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelectionWidget.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
-    ../common/HDLParser/MetaInstance.cpp
+    ../common/HDLParser/MetaInstance.cpp \
+    ../common/HDLParser/MetaInstanceCache.cpp \
+    ../common/HDLParser/MessageBuffer.cpp
 RESOURCES += VerilogGenerator.qrc
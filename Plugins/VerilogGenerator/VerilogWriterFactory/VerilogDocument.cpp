@@ -34,6 +34,21 @@ void VerilogDocument::write(QString const& /*outputDirectory*/)
     topWriter_->write(outputStream);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogDocument::writeContent()
+//-----------------------------------------------------------------------------
+void VerilogDocument::writeContent(QTextStream& outputStream, QString const& /*outputDirectory*/)
+{
+    if (contentFormatted_)
+    {
+        outputStream << fileContent_;
+        return;
+    }
+
+    headerWriter_->write(outputStream, fileName_, QDateTime::currentDateTime());
+    topWriter_->write(outputStream);
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogDocument::getImplementation()
 //-----------------------------------------------------------------------------
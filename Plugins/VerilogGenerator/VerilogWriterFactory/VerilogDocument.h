@@ -75,6 +75,15 @@ struct VerilogDocument : public GenerationOutput
      *      @param [in] outputDirectory         The possible output directory.
      */
 	virtual void write(QString const& outputDirectory) override;
+
+    /*!
+     *  Writes the content to the given stream. Unless the content has been formatted, the module
+     *  is streamed directly from the writers.
+     *
+     *      @param [in] outputStream            The stream to write to.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    virtual void writeContent(QTextStream& outputStream, QString const& outputDirectory) override;
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
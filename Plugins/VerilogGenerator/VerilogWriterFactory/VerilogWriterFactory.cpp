@@ -125,6 +125,14 @@ QString VerilogWriterFactory::getGroupIdentifier() const
     return QStringLiteral("generatedFiles");
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogWriterFactory::getGeneratorVersion()
+//-----------------------------------------------------------------------------
+QString VerilogWriterFactory::getGeneratorVersion() const
+{
+    return generatorVersion_ + QLatin1Char('/') + kactusVersion_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogWriterFactory::readImplementation()
 //-----------------------------------------------------------------------------
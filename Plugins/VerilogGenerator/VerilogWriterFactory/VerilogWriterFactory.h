@@ -78,6 +78,11 @@ public:
      */
     virtual QString getGroupIdentifier() const override final;
 
+    /*!
+     *  Returns the version identifying the generator and the Kactus2 build producing the outputs.
+     */
+    virtual QString getGeneratorVersion() const override final;
+
 private:
 
     // Disable copying.
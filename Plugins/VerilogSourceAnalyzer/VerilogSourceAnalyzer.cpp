@@ -116,9 +116,12 @@ QString VerilogSourceAnalyzer::calculateHash(QString const& filename)
 //-----------------------------------------------------------------------------
 // Function: VerilogSourceAnalyzer::beginAnalysis()
 //-----------------------------------------------------------------------------
-void VerilogSourceAnalyzer::beginAnalysis(Component const* /*component*/, QString const& /*componentPath*/)
+void VerilogSourceAnalyzer::beginAnalysis(Component const* component, QString const& componentPath)
 {
-    // Nothing to do.
+    // The file sets are scanned once, since the files are analyzed concurrently with the same items.
+    analyzedComponent_ = component;
+    analyzedComponentPath_ = componentPath;
+    itemsInFilesets_ = findItemsInFilesets(component, componentPath);
 }
 
 //-----------------------------------------------------------------------------
@@ -126,7 +129,9 @@ void VerilogSourceAnalyzer::beginAnalysis(Component const* /*component*/, QStrin
 //-----------------------------------------------------------------------------
 void VerilogSourceAnalyzer::endAnalysis(Component const* /*component*/, QString const& /*componentPath*/)
 {
-	// Nothing to do.
+    analyzedComponent_ = nullptr;
+    analyzedComponentPath_.clear();
+    itemsInFilesets_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -135,7 +140,15 @@ void VerilogSourceAnalyzer::endAnalysis(Component const* /*component*/, QString
 QList<FileDependencyDesc> VerilogSourceAnalyzer::getFileDependencies(Component const* component, 
     QString const& componentPath, QString const& filename)
 {
-	QMap<QString, QString> itemsInFilesets = findItemsInFilesets(component, componentPath);
+	QMap<QString, QString> itemsInFilesets;
+    if (component == analyzedComponent_ && componentPath == analyzedComponentPath_)
+    {
+        itemsInFilesets = itemsInFilesets_;
+    }
+    else
+    {
+        itemsInFilesets = findItemsInFilesets(component, componentPath);
+    }
 	
 	QString sourceAbsolutePath = findAbsolutePathFor(filename, componentPath);
 	QFileInfo sourceFileInfo(sourceAbsolutePath);
@@ -222,6 +222,18 @@ private:
 		QFileInfo const& sourceFileInfo,
 		QMap<QString, QString> const& itemsInFilesets) const;
 
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The component of the running analysis.
+    Component const* analyzedComponent_ = nullptr;
+
+    //! The path of the component of the running analysis.
+    QString analyzedComponentPath_;
+
+    //! The items in the file sets of the running analysis. Only read by getFileDependencies().
+    QMap<QString, QString> itemsInFilesets_;
 };
 
 #endif // VERILOGSOURCEANALYZER_H
@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------
+// File: MessageBuffer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Collects messages so that they can be passed on later in a deterministic order.
+//-----------------------------------------------------------------------------
+
+#include "MessageBuffer.h"
+
+//-----------------------------------------------------------------------------
+// Function: MessageBuffer::showMessage()
+//-----------------------------------------------------------------------------
+void MessageBuffer::showMessage(QString const& message) const
+{
+    messages_.append({ NOTICE, message });
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageBuffer::showError()
+//-----------------------------------------------------------------------------
+void MessageBuffer::showError(QString const& error) const
+{
+    messages_.append({ ERROR_MESSAGE, error });
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageBuffer::showFailure()
+//-----------------------------------------------------------------------------
+void MessageBuffer::showFailure(QString const& error) const
+{
+    messages_.append({ FAILURE, error });
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageBuffer::showStatusMessage()
+//-----------------------------------------------------------------------------
+void MessageBuffer::showStatusMessage(QString const& status) const
+{
+    messages_.append({ STATUS, status });
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageBuffer::replay()
+//-----------------------------------------------------------------------------
+void MessageBuffer::replay(MessageMediator const* target) const
+{
+    for (StoredMessage const& message : messages_)
+    {
+        if (message.type == NOTICE)
+        {
+            target->showMessage(message.text);
+        }
+        else if (message.type == ERROR_MESSAGE)
+        {
+            target->showError(message.text);
+        }
+        else if (message.type == FAILURE)
+        {
+            target->showFailure(message.text);
+        }
+        else
+        {
+            target->showStatusMessage(message.text);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageBuffer::clear()
+//-----------------------------------------------------------------------------
+void MessageBuffer::clear()
+{
+    messages_.clear();
+}
@@ -0,0 +1,86 @@
+//-----------------------------------------------------------------------------
+// File: MessageBuffer.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Collects messages so that they can be passed on later in a deterministic order.
+//-----------------------------------------------------------------------------
+
+#ifndef MESSAGEBUFFER_H
+#define MESSAGEBUFFER_H
+
+#include <common/ui/MessageMediator.h>
+
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Collects messages so that they can be passed on later in a deterministic order.
+//
+// Used for the parts of the HDL parsing that are run concurrently. The buffer itself is not synchronized,
+// so it may be written by one thread at a time only.
+//-----------------------------------------------------------------------------
+class MessageBuffer : public MessageMediator
+{
+public:
+
+    //! The constructor.
+    MessageBuffer() = default;
+
+    //! The destructor.
+    virtual ~MessageBuffer() = default;
+
+    //! Stores the given message.
+    virtual void showMessage(QString const& message) const;
+
+    //! Stores the given error.
+    virtual void showError(QString const& error) const;
+
+    //! Stores the given failure message.
+    virtual void showFailure(QString const& error) const;
+
+    //! Stores the given status.
+    virtual void showStatusMessage(QString const& status) const;
+
+    /*!
+     *  Passes the stored messages to another mediator in the order they were stored.
+     *
+     *      @param [in] target  The mediator to pass the messages to.
+     */
+    void replay(MessageMediator const* target) const;
+
+    /*!
+     *  Removes the stored messages.
+     */
+    void clear();
+
+private:
+
+    //! The kinds of the stored messages.
+    enum MessageType
+    {
+        NOTICE,
+        ERROR_MESSAGE,
+        FAILURE,
+        STATUS
+    };
+
+    //! A stored message.
+    struct StoredMessage
+    {
+        MessageType type;   //!< The kind of the message.
+        QString text;       //!< The message text.
+    };
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The stored messages in the order they were shown.
+    mutable QVector<StoredMessage> messages_;
+};
+
+#endif // MESSAGEBUFFER_H
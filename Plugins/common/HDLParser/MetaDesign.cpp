@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "MetaDesign.h"
+#include "MetaInstanceCache.h"
 
 #include <common/ui/MessageMediator.h>
 
@@ -28,6 +29,8 @@
 
 #include <QVector>
 
+#include <QtConcurrent>
+
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::MetaDesign()
 //-----------------------------------------------------------------------------
@@ -36,9 +39,11 @@ MetaDesign::MetaDesign(LibraryInterface* library,
     QSharedPointer<Design const> design,
     QSharedPointer<DesignInstantiation const> designInstantiation,
     QSharedPointer<DesignConfiguration const> designConf,
-    QSharedPointer<MetaInstance> topInstance) :
+    QSharedPointer<MetaInstance> topInstance,
+    QSharedPointer<MetaInstanceCache> instanceCache) :
 library_(library),
 messages_(messages),
+parseMessages_(),
 design_(design),
 designInstantiation_(designInstantiation),
 designConf_(designConf), 
@@ -46,7 +51,9 @@ topInstance_(topInstance),
 parameters_(new QList<QSharedPointer<Parameter> >()),
 instances_(new QMap<QString,QSharedPointer<MetaInstance> >),
 interconnections_(new QList<QSharedPointer<MetaInterconnection> >),
-adHocWires_(new QList<QSharedPointer<MetaWire> >)
+adHocWires_(new QList<QSharedPointer<MetaWire> >),
+instanceCache_(instanceCache),
+subDesigns_()
 {
 
 }
@@ -55,7 +62,7 @@ adHocWires_(new QList<QSharedPointer<MetaWire> >)
 // Function: MetaDesign::parseHierarchy()
 //-----------------------------------------------------------------------------
 QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface* library, GenerationTuple input,
-    QSharedPointer<View> topComponentView)
+    QSharedPointer<View> topComponentView, bool parseConcurrently)
 {
     QSharedPointer<ComponentInstance> componentInstance(nullptr);
     QSharedPointer<QList<QSharedPointer<Parameter> > > topList(new QList<QSharedPointer<Parameter> >);
@@ -83,9 +90,12 @@ QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface*
         }
     }
 
+    // The instances of the whole hierarchy share the components and the parsed ports and interfaces.
+    QSharedPointer<MetaInstanceCache> instanceCache(new MetaInstanceCache(library));
+
     // Create the design associated with the top component.
     QSharedPointer<MetaDesign> topMostDesign(new MetaDesign(library, input.messages, input.design,
-        designInstantiation, input.designConfiguration, topMostInstance));
+        designInstantiation, input.designConfiguration, topMostInstance, instanceCache));
 
     // Each module name, except the topmost instance, is associated with the count of the same name.
     QMap<QString, int> names;
@@ -93,40 +103,78 @@ QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface*
     QList<QSharedPointer<MetaDesign> > parsedDesigns;
     int subDesignCount = 0;
     const int MAXIMUM_SUBDESIGNS = 1000;
-    
-    QVector<QSharedPointer<MetaDesign> > designsToParse({ topMostDesign });
-    while (!designsToParse.isEmpty())
+
+    // A sub-design is parsed only after its parent design has parsed the instance it is instantiated by.
+    // The designs of one hierarchy level are independent, so a level is parsed concurrently.
+    // The instances, module names and library documents are resolved in order and the messages are reported
+    // in the order of the designs, so the result does not depend on the threads.
+    QList<QSharedPointer<MetaDesign> > currentLevel({ topMostDesign });
+    while (!currentLevel.isEmpty())
     {
-         QSharedPointer<MetaDesign> currentDesign = designsToParse.takeFirst();
-         currentDesign->findInstances();
-
-         subDesignCount += currentDesign->subDesigns_.count();
-         if (subDesignCount > MAXIMUM_SUBDESIGNS)
-         {
-             input.messages->showError(
-                 QObject::tr("Exceeded maximum number of designs in one hierarchy: %1.").arg(MAXIMUM_SUBDESIGNS));
-             return parsedDesigns;
-         }
-
-         for (QSharedPointer<MetaDesign> subDesign : currentDesign->subDesigns_)
-         {
-             designsToParse.append(subDesign);
-
-             QString name = subDesign->getTopInstance()->getModuleName();
-             
-             int count = names.value(name, 0);
-             names.insert(name, count + 1);
-
-             subDesign->getTopInstance()->setModuleName(name + QLatin1Char('_') + QString::number(count));
-         }
-
-         currentDesign->parseDesign();
-         parsedDesigns.append(currentDesign);
+        QList<QSharedPointer<MetaDesign> > nextLevel;
+        for (int i = 0; i < currentLevel.size(); ++i)
+        {
+            QSharedPointer<MetaDesign> currentDesign = currentLevel.at(i);
+            currentDesign->findInstances();
+
+            subDesignCount += currentDesign->subDesigns_.count();
+            if (subDesignCount > MAXIMUM_SUBDESIGNS)
+            {
+                input.messages->showError(QObject::tr("Exceeded maximum number of designs in one hierarchy: %1.")
+                    .arg(MAXIMUM_SUBDESIGNS));
+
+                // Return the designs preceding the failing one, as they would have been parsed already.
+                currentLevel = currentLevel.mid(0, i);
+                parseDesigns(currentLevel, parseConcurrently);
+                return parsedDesigns + currentLevel;
+            }
+
+            for (QSharedPointer<MetaDesign> subDesign : currentDesign->subDesigns_)
+            {
+                nextLevel.append(subDesign);
+
+                QString name = subDesign->getTopInstance()->getModuleName();
+
+                int count = names.value(name, 0);
+                names.insert(name, count + 1);
+
+                subDesign->getTopInstance()->setModuleName(name + QLatin1Char('_') + QString::number(count));
+            }
+        }
+
+        parseDesigns(currentLevel, parseConcurrently);
+        parsedDesigns.append(currentLevel);
+
+        currentLevel = nextLevel;
     }
 
     return parsedDesigns;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MetaDesign::parseDesigns()
+//-----------------------------------------------------------------------------
+void MetaDesign::parseDesigns(QList<QSharedPointer<MetaDesign> > designs, bool concurrently)
+{
+    if (concurrently)
+    {
+        QtConcurrent::blockingMap(designs, [](QSharedPointer<MetaDesign>& design) { design->parseDesign(); });
+    }
+    else
+    {
+        for (QSharedPointer<MetaDesign> design : designs)
+        {
+            design->parseDesign();
+        }
+    }
+
+    for (QSharedPointer<MetaDesign> design : designs)
+    {
+        design->parseMessages_.replay(design->messages_);
+        design->parseMessages_.clear();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::parseDesign()
 //-----------------------------------------------------------------------------
@@ -200,7 +248,7 @@ void MetaDesign::findInstances()
     for (QSharedPointer<ComponentInstance> instance : *design_->getComponentInstances())
     {
         VLNV instanceVLNV = design_->getHWComponentVLNV(instance->getInstanceName());
-        QSharedPointer<Component> component = library_->getModel<Component>(instanceVLNV);
+        QSharedPointer<Component> component = instanceCache_->getComponent(instanceVLNV);
 
         if (!component)
         {
@@ -232,8 +280,12 @@ void MetaDesign::findInstances()
             }
         }
 
-        QSharedPointer<MetaInstance> mInstance(new MetaInstance(instance, library_, messages_, component,
-            activeView));
+        // The documents are read here, so that the concurrent parsing does not access the library.
+        instanceCache_->readAbstractionDefinitions(component);
+
+        // The instances are parsed along with the design, so they report to the same messages.
+        QSharedPointer<MetaInstance> mInstance(new MetaInstance(instance, library_, &parseMessages_, component,
+            activeView, instanceCache_));
         instances_->insert(instance->getInstanceName(), mInstance);
         findHierarchy(mInstance);
     }
@@ -346,7 +398,7 @@ void MetaDesign::parseInterconnections()
                 instances_->value(connectionInterface->getComponentReference());
             if (!mInstance)
             {
-                messages_->showError(QObject::tr("Design %1: Instance %2 referred by interconnection %3"
+                parseMessages_.showError(QObject::tr("Design %1: Instance %2 referred by interconnection %3"
                     " does not exist.").arg(design_->getVlnv().toString(),
                     connectionInterface->getComponentReference(), connection->name()));
                 continue;
@@ -356,7 +408,7 @@ void MetaDesign::parseInterconnections()
                 connectionInterface->getBusReference());
             if (!mInterface)
             {
-                messages_->showError(QObject::tr("Design %1: Bus interface %2 referred by interconnection %3"
+                parseMessages_.showError(QObject::tr("Design %1: Bus interface %2 referred by interconnection %3"
                     " does not exist within component %4.")
                     .arg(design_->getVlnv().toString(), connectionInterface->getBusReference(),
                     connection->name(), mInstance->getComponent()->getVlnv().toString()));
@@ -375,7 +427,7 @@ void MetaDesign::parseInterconnections()
 
             if (!mInterface)
             {
-                messages_->showError(QObject::tr("Design %1: Bus interface %2 referred by interconnection %3"
+                parseMessages_.showError(QObject::tr("Design %1: Bus interface %2 referred by interconnection %3"
                     " does not exist within component %4.").arg(design_->getVlnv().toString(),
                         hierInterface->getBusReference(), connection->name(),
                     topInstance_->getComponent()->getVlnv().toString()));
@@ -390,7 +442,7 @@ void MetaDesign::parseInterconnections()
         // If not enough interfaces are in the interconnect, drop it.
         if (foundInterInterfaces.size() + foundHierInterfaces.size() < 2)
         {
-            messages_->showError(
+            parseMessages_.showError(
                 QObject::tr("Design %1: No bus interfaces were found for interconnection %2.").arg(
                     design_->getVlnv().toString(), connection->name()));
             continue;
@@ -586,7 +638,7 @@ void MetaDesign::parseAdHocs()
         // If not enough ports are in the connection, drop it.
         if (foundPorts.size() < 1)
         {
-            messages_->showError(QObject::tr("Design %1: No ports were found for ad-hoc connection %2.").arg(
+            parseMessages_.showError(QObject::tr("Design %1: No ports were found for ad-hoc connection %2.").arg(
                 design_->getVlnv().toString(), connection->name()));
             continue;
         }
@@ -653,7 +705,7 @@ void MetaDesign::parseAdHocAssignmentForPort(QSharedPointer<MetaPort> mPort,
     {
         if (defaultValue.isEmpty() )
         {
-            messages_->showError(
+            parseMessages_.showError(
                 QObject::tr("Design %1: Ad-hoc connection %2 needs either more ports or a tie-off.").arg(
                     design_->getVlnv().toString(), connection->name()));
             return;
@@ -726,7 +778,7 @@ void MetaDesign::findHierarchicalPortsInAdHoc(QSharedPointer<AdHocConnection> co
 
         if (!mPort)
         {
-            messages_->showError(QObject::tr("Design %1: Port %2 referred by ad-hoc connection %3"
+            parseMessages_.showError(QObject::tr("Design %1: Port %2 referred by ad-hoc connection %3"
                 " does not exist within component %4.")
                 .arg(design_->getVlnv().toString(),
                 portRef->getPortRef(),
@@ -753,7 +805,7 @@ void MetaDesign::findPortsInAdHoc(QSharedPointer<AdHocConnection> connection,
         QSharedPointer<MetaInstance> mInstance = instances_->value(portRef->getComponentRef());
         if (!mInstance)
         {
-            messages_->showError(
+            parseMessages_.showError(
                 QObject::tr("Design %1: Instance %2 referred by ad-hoc connection %3 does not exist.")
                 .arg(design_->getVlnv().toString(), portRef->getComponentRef(), connection->name()));
             continue;
@@ -763,7 +815,7 @@ void MetaDesign::findPortsInAdHoc(QSharedPointer<AdHocConnection> connection,
         QSharedPointer<MetaPort> mPort = mInstance->getPorts()->value(portRef->getPortRef());
         if (!mPort)
         {
-            messages_->showError(QObject::tr("Design %1: Port %2 referred by ad-hoc connection %3 does"
+            parseMessages_.showError(QObject::tr("Design %1: Port %2 referred by ad-hoc connection %3 does"
                 " not exist within component %4.")
                 .arg(design_->getVlnv().toString(), portRef->getPortRef(), connection->name(),
                 mInstance->getComponent()->getVlnv().toString()));
@@ -922,7 +974,7 @@ void MetaDesign::findHierarchy(QSharedPointer<MetaInstance> mInstance)
     {
         // If a sub design exists, it must be also parsed.
         QSharedPointer<MetaDesign> subMetaDesign(new MetaDesign(library_, messages_, subDesign, 
-            designInstantiation, subDesignConfiguration, mInstance));
+            designInstantiation, subDesignConfiguration, mInstance, instanceCache_));
         subDesigns_.append(subMetaDesign);
     }
 }
@@ -13,6 +13,7 @@
 #define METADESIGN_H
 
 #include "MetaInstance.h"
+#include "MessageBuffer.h"
 
 class Design;
 class DesignConfiguration;
@@ -20,6 +21,7 @@ class AdHocConnection;
 class MessageMediator;
 class PartSelect;
 class PortAbstraction;
+class MetaInstanceCache;
 
 //-----------------------------------------------------------------------------
 // An instantiated design with all its parameters, instances, and interconnections parsed.
@@ -35,13 +37,15 @@ public:
      *      @param [in] design              The design to parse.
      *      @param [in] designConf          The design configuration to parse.
      *      @param [in] topInstance         The parsed meta instance of the top component.
+     *      @param [in] instanceCache       The parsing results shared within the hierarchy.
      */
     MetaDesign(LibraryInterface* library,
         MessageMediator* messages,
         QSharedPointer<Design const> design,
         QSharedPointer<DesignInstantiation const> designInstantiation,
         QSharedPointer<DesignConfiguration const> designConf,
-        QSharedPointer<MetaInstance> topInstance);
+        QSharedPointer<MetaInstance> topInstance,
+        QSharedPointer<MetaInstanceCache> instanceCache);
 
     //! The destructor.
     ~MetaDesign() = default;
@@ -56,10 +60,13 @@ public:
      *      @param [in] library                 The library which is expected to contain the parsed documents.
      *      @param [in] input		            The starting point for hierarchy parsing.
      *      @param [in] topComponentView        The active view of the component in input.
+     *      @param [in] parseConcurrently       If true, the designs of a hierarchy level are parsed concurrently.
+     *                                          The result and the messages are the same either way.
      */
     static QList<QSharedPointer<MetaDesign> > parseHierarchy(LibraryInterface* library,
         GenerationTuple input,
-        QSharedPointer<View> topComponentView);
+        QSharedPointer<View> topComponentView,
+        bool parseConcurrently = true);
     
     /*!
      *  Returns the meta instance of the top component. Must exists even if is the topmost in hierarchy.
@@ -93,6 +100,14 @@ private:
      */
     void parseDesign();
 
+    /*!
+     *  Parses independent designs and reports their messages in the order of the designs.
+     *
+     *      @param [in] designs         The designs to parse. None of them may be a sub-design of another.
+     *      @param [in] concurrently    If true, the designs are parsed concurrently.
+     */
+    static void parseDesigns(QList<QSharedPointer<MetaDesign> > designs, bool concurrently);
+
     /*!
      *  Parses the design parameters. Also applies them to the meta parameters.
      */
@@ -267,6 +282,9 @@ private:
     //! The messages.
     MessageMediator* messages_;
 
+    //! The messages of parsing the design and its instances, reported once the hierarchy level is parsed.
+    MessageBuffer parseMessages_;
+
     //! The design to parse.
     QSharedPointer<Design const> design_;
 
@@ -289,6 +307,9 @@ private:
     //! The parsed ad-hoc connections of the design_.
     QSharedPointer<QList<QSharedPointer<MetaWire> > > adHocWires_;
 
+    //! The parsing results shared within the hierarchy.
+    QSharedPointer<MetaInstanceCache> instanceCache_;
+
     //! The list of all parsed designs that are below the current top are in this list.
     QList<QSharedPointer<MetaDesign> > subDesigns_;
 };
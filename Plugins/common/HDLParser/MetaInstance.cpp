@@ -10,6 +10,8 @@
 //-----------------------------------------------------------------------------
 
 #include "MetaInstance.h"
+#include "MetaInstanceCache.h"
+#include "MessageBuffer.h"
 
 #include <common/ui/MessageMediator.h>
 
@@ -27,11 +29,13 @@ MetaInstance::MetaInstance(QSharedPointer<ComponentInstance> componentInstance,
     LibraryInterface* library,
     MessageMediator* messages,
     QSharedPointer<Component> component,
-    QSharedPointer<View> activeView) :
+    QSharedPointer<View> activeView,
+    QSharedPointer<MetaInstanceCache> cache) :
 MetaComponent(messages, component, activeView),
     componentInstance_(componentInstance),
     library_(library),
-    interfaces_(new QMap<QString,QSharedPointer<MetaInterface> >)
+    interfaces_(new QMap<QString,QSharedPointer<MetaInterface> >),
+    cache_(cache)
 {
 
 }
@@ -41,6 +45,22 @@ MetaComponent(messages, component, activeView),
 //-----------------------------------------------------------------------------
 void MetaInstance::parseInstance()
 {
+    // Instances with the same component, view and parameter values are parsed only once.
+    // The messages of the parsing are reported for each instance, as if it was parsed itself.
+    MessageBuffer parseMessages;
+
+    QString key;
+    if (cache_)
+    {
+        key = cacheKey();
+        if (cache_->findParsedInstance(key, *getPorts(), *interfaces_, parseMessages))
+        {
+            parseMessages.replay(messages_);
+            parseMetaParameters();
+            return;
+        }
+    }
+
     // Initialize the parameter parsing: Find parameters from both the instance and the top component.
     QSharedPointer<QList<QSharedPointer<Parameter> > > ilist(getParameters());
     QSharedPointer<ListParameterFinder> instanceFinder(new ListParameterFinder);
@@ -50,9 +70,16 @@ void MetaInstance::parseInstance()
     IPXactSystemVerilogParser instanceParser(instanceFinder);
 
     // Parse the interfaces and ports.
-    parseInterfaces();
+    parseInterfaces(&parseMessages);
     parsePorts(instanceParser);
-    parsePortAssignments(instanceParser);
+    parsePortAssignments(instanceParser, &parseMessages);
+
+    if (cache_)
+    {
+        cache_->addParsedInstance(key, *getPorts(), *interfaces_, parseMessages);
+    }
+
+    parseMessages.replay(messages_);
 
     parseMetaParameters(); 
 }
@@ -72,10 +99,29 @@ QString MetaInstance::parseExpression(IPXactSystemVerilogParser const& parser,
     return value;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MetaInstance::cacheKey()
+//-----------------------------------------------------------------------------
+QString MetaInstance::cacheKey()
+{
+    QStringList key;
+    key.append(getComponent()->getVlnv().toString());
+    key.append(getActiveView() ? getActiveView()->name() : QString());
+
+    // The ports and port maps are parsed using the instance parameters only.
+    for (QSharedPointer<Parameter> parameter : *getParameters())
+    {
+        key.append(parameter->name() + QLatin1Char(':') + parameter->getValueId() + QLatin1Char('=') +
+            parameter->getValue());
+    }
+
+    return key.join(QLatin1Char('\n'));
+}
+
 //-----------------------------------------------------------------------------
 // Function: MetaInstance::parseInterfaces()
 //-----------------------------------------------------------------------------
-void MetaInstance::parseInterfaces()
+void MetaInstance::parseInterfaces(MessageMediator const* messages)
 {
     foreach(QSharedPointer<BusInterface> busInterface, *getComponent()->getBusInterfaces())
     {
@@ -89,7 +135,7 @@ void MetaInstance::parseInterfaces()
         QSharedPointer<AbstractionType> absType = busInterface->getAbstractionContainingView(viewName);
         if (!absType)
         {
-            messages_->showError(
+            messages->showError(
                 QObject::tr("Component %1: Bus interface %2 does not have an abstraction type.")
                 .arg(getComponent()->getVlnv().toString(), busInterface->name()));
             continue;
@@ -99,17 +145,18 @@ void MetaInstance::parseInterfaces()
         QSharedPointer<ConfigurableVLNVReference> absRef = absType->getAbstractionRef();
         if (!absRef)
         {
-            messages_->showError(
+            messages->showError(
                 QObject::tr("Component %1: Abstraction type in bus interface %2 does not have abstraction reference.")
                 .arg(getComponent()->getVlnv().toString(), busInterface->name()));
             continue;
         }
 
-        // Find the abstraction definition from the library.
-        QSharedPointer<AbstractionDefinition> absDef = library_->getModel<AbstractionDefinition>(*absRef);
+        // Find the abstraction definition read from the library before the parsing.
+        QSharedPointer<AbstractionDefinition> absDef = cache_ ? cache_->getAbstractionDefinition(*absRef) :
+            library_->getModel<AbstractionDefinition>(*absRef);
         if (!absDef)
         {
-            messages_->showError(
+            messages->showError(
                 QObject::tr("Component %1: Abstraction definition for bus interface %2 was not found: %3")
                 .arg(getComponent()->getVlnv().toString(), busInterface->name(), absRef->toString()));
             continue;
@@ -164,7 +211,8 @@ void MetaInstance::parsePorts(IPXactSystemVerilogParser const& parser)
 //-----------------------------------------------------------------------------
 // Function: MetaInstance::parsePortAssignments()
 //-----------------------------------------------------------------------------
-void MetaInstance::parsePortAssignments(IPXactSystemVerilogParser const& parser)
+void MetaInstance::parsePortAssignments(IPXactSystemVerilogParser const& parser,
+    MessageMediator const* messages)
 {
     foreach (QSharedPointer<MetaInterface> mInterface, *interfaces_)
     {
@@ -184,7 +232,7 @@ void MetaInstance::parsePortAssignments(IPXactSystemVerilogParser const& parser)
 
             if (!portAbstraction)
             {
-                messages_->showError(QObject::tr("Component %1, Bus interface %2: Port abstraction"
+                messages->showError(QObject::tr("Component %1, Bus interface %2: Port abstraction"
                     " was not found for logical port %3 at abstraction definition %4.")
                     .arg(getComponent()->getVlnv().toString(),
                     mInterface->interface_->name(),
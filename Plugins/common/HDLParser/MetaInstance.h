@@ -18,6 +18,7 @@
 #include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
 
 class LibraryInterface;
+class MetaInstanceCache;
 class PortMap;
 class MessageMediator;
 
@@ -36,13 +37,15 @@ public:
      *      @param [in] messages            For message output.
      *      @param [in] component           The instantiated component.
      *      @param [in] activeView          The active view for the component. May be null.
+     *      @param [in] cache               The parsing results shared within the hierarchy. May be null.
 	 */
     MetaInstance(
         QSharedPointer<ComponentInstance> componentInstance,
         LibraryInterface* library,
         MessageMediator* messages,
         QSharedPointer<Component> component,
-        QSharedPointer<View> activeView);
+        QSharedPointer<View> activeView,
+        QSharedPointer<MetaInstanceCache> cache = QSharedPointer<MetaInstanceCache>());
 
 	//! The destructor.
     virtual ~MetaInstance() = default;
@@ -74,10 +77,19 @@ public:
 
 private:
     
+    /*!
+     *  Forms the key identifying the parsing results of the instance in the cache.
+     *
+     *      @return The component VLNV, active view and the resolved parameter values of the instance.
+     */
+    QString cacheKey();
+
     /*!
      *  Parse the interfaces of the component instance.
+     *
+     *      @param [in] messages        Receives the messages of the parsing.
      */
-    void parseInterfaces();
+    void parseInterfaces(MessageMediator const* messages);
     
     /*!
      *  Culls and parses the ports of the component.
@@ -90,8 +102,9 @@ private:
      *  Creates assignments for port maps.
      *
      *      @param [in] parser          Used to parse expressions.
+     *      @param [in] messages        Receives the messages of the parsing.
      */
-    void parsePortAssignments(IPXactSystemVerilogParser const& parser);
+    void parsePortAssignments(IPXactSystemVerilogParser const& parser, MessageMediator const* messages);
 
     /*!
      *  Finds the mapped logical port bounds for a port map.
@@ -127,6 +140,9 @@ private:
 
     //! The parsed interfaces of the instance, keyed with its name.
     QSharedPointer<QMap<QString, QSharedPointer<MetaInterface> > > interfaces_;
+
+    //! The parsing results shared within the hierarchy.
+    QSharedPointer<MetaInstanceCache> cache_;
 };
 
 #endif // METAINSTANCE_H
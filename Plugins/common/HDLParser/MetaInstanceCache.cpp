@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+// File: MetaInstanceCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Shares the documents and parsed ports and interfaces among the meta instances of a hierarchy.
+//-----------------------------------------------------------------------------
+
+#include "MetaInstanceCache.h"
+
+#include <library/LibraryInterface.h>
+
+#include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+
+#include <QMutexLocker>
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::MetaInstanceCache()
+//-----------------------------------------------------------------------------
+MetaInstanceCache::MetaInstanceCache(LibraryInterface* library):
+library_(library),
+mutex_(),
+components_(),
+abstractionDefinitions_(),
+parsedInstances_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::getComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> MetaInstanceCache::getComponent(VLNV const& vlnv)
+{
+    {
+        QMutexLocker locker(&mutex_);
+
+        auto cached = components_.constFind(vlnv);
+        if (cached != components_.cend())
+        {
+            return cached.value();
+        }
+    }
+
+    // The component is read without holding the lock, so other documents can be served meanwhile.
+    QSharedPointer<Component> component = library_->getModel<Component>(vlnv);
+
+    QMutexLocker locker(&mutex_);
+
+    // Another design may have read the same component meanwhile. Its copy is kept, so all share one instance.
+    auto cached = components_.constFind(vlnv);
+    if (cached != components_.cend())
+    {
+        return cached.value();
+    }
+
+    components_.insert(vlnv, component);
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::getAbstractionDefinition()
+//-----------------------------------------------------------------------------
+QSharedPointer<AbstractionDefinition> MetaInstanceCache::getAbstractionDefinition(VLNV const& vlnv)
+{
+    {
+        QMutexLocker locker(&mutex_);
+
+        auto cached = abstractionDefinitions_.constFind(vlnv);
+        if (cached != abstractionDefinitions_.cend())
+        {
+            return cached.value();
+        }
+    }
+
+    QSharedPointer<AbstractionDefinition> definition = library_->getModel<AbstractionDefinition>(vlnv);
+
+    QMutexLocker locker(&mutex_);
+
+    auto cached = abstractionDefinitions_.constFind(vlnv);
+    if (cached != abstractionDefinitions_.cend())
+    {
+        return cached.value();
+    }
+
+    abstractionDefinitions_.insert(vlnv, definition);
+    return definition;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::readAbstractionDefinitions()
+//-----------------------------------------------------------------------------
+void MetaInstanceCache::readAbstractionDefinitions(QSharedPointer<Component> component)
+{
+    // All the abstraction types are read, as the view of each instance is known only when it is parsed.
+    for (QSharedPointer<BusInterface> busInterface : *component->getBusInterfaces())
+    {
+        for (QSharedPointer<AbstractionType> abstractionType : *busInterface->getAbstractionTypes())
+        {
+            if (abstractionType->getAbstractionRef())
+            {
+                getAbstractionDefinition(*abstractionType->getAbstractionRef());
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::findParsedInstance()
+//-----------------------------------------------------------------------------
+bool MetaInstanceCache::findParsedInstance(QString const& key, QMap<QString, QSharedPointer<MetaPort> >& ports,
+    QMap<QString, QSharedPointer<MetaInterface> >& interfaces, MessageBuffer& messages) const
+{
+    QMutexLocker locker(&mutex_);
+
+    auto parsed = parsedInstances_.constFind(key);
+    if (parsed == parsedInstances_.cend())
+    {
+        return false;
+    }
+
+    copyParsed(parsed->ports, parsed->interfaces, ports, interfaces);
+    messages = parsed->messages;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::addParsedInstance()
+//-----------------------------------------------------------------------------
+void MetaInstanceCache::addParsedInstance(QString const& key, QMap<QString, QSharedPointer<MetaPort> > const& ports,
+    QMap<QString, QSharedPointer<MetaInterface> > const& interfaces, MessageBuffer const& messages)
+{
+    // The parsed objects belong to the instance, so the cache keeps its own copies.
+    ParsedInstance parsed;
+    copyParsed(ports, interfaces, parsed.ports, parsed.interfaces);
+    parsed.messages = messages;
+
+    QMutexLocker locker(&mutex_);
+    parsedInstances_.insert(key, parsed);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaInstanceCache::copyParsed()
+//-----------------------------------------------------------------------------
+void MetaInstanceCache::copyParsed(QMap<QString, QSharedPointer<MetaPort> > const& ports,
+    QMap<QString, QSharedPointer<MetaInterface> > const& interfaces,
+    QMap<QString, QSharedPointer<MetaPort> >& copiedPorts,
+    QMap<QString, QSharedPointer<MetaInterface> >& copiedInterfaces)
+{
+    QHash<MetaPort const*, QSharedPointer<MetaPort> > portCopies;
+
+    for (auto port = ports.cbegin(); port != ports.cend(); ++port)
+    {
+        QSharedPointer<MetaPort> portCopy(new MetaPort(*port.value()));
+
+        for (auto assignment = portCopy->upAssignments_.begin(); assignment != portCopy->upAssignments_.end();
+            ++assignment)
+        {
+            assignment.value() = QSharedPointer<MetaPortAssignment>(new MetaPortAssignment(*assignment.value()));
+        }
+
+        for (auto assignment = portCopy->downAssignments_.begin(); assignment != portCopy->downAssignments_.end();
+            ++assignment)
+        {
+            assignment.value() = QSharedPointer<MetaPortAssignment>(new MetaPortAssignment(*assignment.value()));
+        }
+
+        copiedPorts.insert(port.key(), portCopy);
+        portCopies.insert(port.value().data(), portCopy);
+    }
+
+    for (auto metaInterface = interfaces.cbegin(); metaInterface != interfaces.cend(); ++metaInterface)
+    {
+        QSharedPointer<MetaInterface> interfaceCopy(new MetaInterface(*metaInterface.value()));
+
+        for (auto port = interfaceCopy->ports_.begin(); port != interfaceCopy->ports_.end(); ++port)
+        {
+            port.value() = portCopies.value(port.value().data());
+        }
+
+        copiedInterfaces.insert(metaInterface.key(), interfaceCopy);
+    }
+}
@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------
+// File: MetaInstanceCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Shares the documents and parsed ports and interfaces among the meta instances of a hierarchy.
+//-----------------------------------------------------------------------------
+
+#ifndef METAINSTANCECACHE_H
+#define METAINSTANCECACHE_H
+
+#include <Plugins/common/HDLParser/HDLParserCommon.h>
+#include <Plugins/common/HDLParser/MessageBuffer.h>
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QString>
+
+class AbstractionDefinition;
+class Component;
+class LibraryInterface;
+
+//-----------------------------------------------------------------------------
+//! Shares the documents and parsed ports and interfaces among the meta instances of a hierarchy.
+//
+// Instances of the same component with the same active view and parameter values have identical ports and
+// interfaces, so they are parsed only once. Each instance gets its own copies, because the interconnections
+// of the design are attached to them. The messages of the parsing are stored as well, so every instance reports
+// the same messages regardless of which one was parsed first. The cache may be used by designs parsed
+// concurrently, but the documents should be read before, so that the concurrent parsing only finds them here.
+//-----------------------------------------------------------------------------
+class MetaInstanceCache
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] library     The library containing the documents of the hierarchy.
+     */
+    explicit MetaInstanceCache(LibraryInterface* library);
+
+    //! The destructor.
+    ~MetaInstanceCache() = default;
+
+    // Disable copying.
+    MetaInstanceCache(MetaInstanceCache const& rhs) = delete;
+    MetaInstanceCache& operator=(MetaInstanceCache const& rhs) = delete;
+
+    /*!
+     *  Gets a component shared by all the instances of the hierarchy. The component must not be modified.
+     *
+     *      @param [in] vlnv    The VLNV of the component.
+     *
+     *      @return The component, or null if it was not found.
+     */
+    QSharedPointer<Component> getComponent(VLNV const& vlnv);
+
+    /*!
+     *  Gets an abstraction definition shared by all the instances of the hierarchy.
+     *
+     *      @param [in] vlnv    The VLNV of the abstraction definition.
+     *
+     *      @return The abstraction definition, or null if it was not found.
+     */
+    QSharedPointer<AbstractionDefinition> getAbstractionDefinition(VLNV const& vlnv);
+
+    /*!
+     *  Reads the abstraction definitions referred by the bus interfaces of a component.
+     *
+     *      @param [in] component   The component whose abstraction definitions to read.
+     */
+    void readAbstractionDefinitions(QSharedPointer<Component> component);
+
+    /*!
+     *  Copies the ports and interfaces parsed earlier for an identical instance.
+     *
+     *      @param [in] key             The key identifying the component, view and parameter values.
+     *      @param [out] ports          The copied ports.
+     *      @param [out] interfaces     The copied interfaces.
+     *      @param [out] messages       The messages reported when the instance was parsed.
+     *
+     *      @return True, if the instance had been parsed, otherwise false.
+     */
+    bool findParsedInstance(QString const& key, QMap<QString, QSharedPointer<MetaPort> >& ports,
+        QMap<QString, QSharedPointer<MetaInterface> >& interfaces, MessageBuffer& messages) const;
+
+    /*!
+     *  Stores copies of the parsed ports and interfaces of an instance.
+     *
+     *      @param [in] key             The key identifying the component, view and parameter values.
+     *      @param [in] ports           The parsed ports.
+     *      @param [in] interfaces      The parsed interfaces.
+     *      @param [in] messages        The messages reported while parsing the instance.
+     */
+    void addParsedInstance(QString const& key, QMap<QString, QSharedPointer<MetaPort> > const& ports,
+        QMap<QString, QSharedPointer<MetaInterface> > const& interfaces, MessageBuffer const& messages);
+
+private:
+
+    //! The parsed ports and interfaces of an instance.
+    struct ParsedInstance
+    {
+        QMap<QString, QSharedPointer<MetaPort> > ports;             //!< The ports keyed with their names.
+        QMap<QString, QSharedPointer<MetaInterface> > interfaces;   //!< The interfaces keyed with their names.
+        MessageBuffer messages;                                     //!< The messages of the parsing.
+    };
+
+    /*!
+     *  Copies parsed ports and interfaces. The interfaces of the copy refer to the copied ports.
+     *
+     *      @param [in] ports               The ports to copy.
+     *      @param [in] interfaces          The interfaces to copy.
+     *      @param [out] copiedPorts        The copied ports.
+     *      @param [out] copiedInterfaces   The copied interfaces.
+     */
+    static void copyParsed(QMap<QString, QSharedPointer<MetaPort> > const& ports,
+        QMap<QString, QSharedPointer<MetaInterface> > const& interfaces,
+        QMap<QString, QSharedPointer<MetaPort> >& copiedPorts,
+        QMap<QString, QSharedPointer<MetaInterface> >& copiedInterfaces);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library containing the documents of the hierarchy.
+    LibraryInterface* library_;
+
+    //! Guards the cached data. The documents are read from the library without holding it.
+    mutable QMutex mutex_;
+
+    //! The components of the hierarchy by VLNV.
+    QHash<VLNV, QSharedPointer<Component> > components_;
+
+    //! The abstraction definitions of the hierarchy by VLNV.
+    QHash<VLNV, QSharedPointer<AbstractionDefinition> > abstractionDefinitions_;
+
+    //! The parsed instances by key.
+    QHash<QString, ParsedInstance> parsedInstances_;
+};
+
+#endif // METAINSTANCECACHE_H
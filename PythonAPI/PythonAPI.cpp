@@ -511,6 +511,8 @@ PortsInterface* PythonAPI::getPortsInterface() const
 //-----------------------------------------------------------------------------
 ParametersInterface* PythonAPI::getComponentParameterInterface() const
 {
+    // Scripts edit the component directly, so the parameter index must be rebuilt after the edits.
+    parameterFinder_->invalidateIndex();
     return componentParameterInterface_;
 }
 
@@ -579,6 +581,8 @@ MemoryMapInterface* PythonAPI::getMapInterface()
 //-----------------------------------------------------------------------------
 void PythonAPI::setBlocksForInterface(std::string const& mapName)
 {
+    parameterFinder_->invalidateIndex();
+
     AddressBlockInterface* blockInterface = mapInterface_->getAddressBlockInterface();
 
     QString mapNameQT = QString::fromStdString(mapName);
@@ -598,6 +602,8 @@ void PythonAPI::setBlocksForInterface(std::string const& mapName)
 //-----------------------------------------------------------------------------
 void PythonAPI::setRegistersForInterface(std::string const& mapName, std::string const& blockName)
 {
+    parameterFinder_->invalidateIndex();
+
     RegisterInterface* interfacePointer = mapInterface_->getAddressBlockInterface()->getSubInterface();
 
     QString mapNameQT = QString::fromStdString(mapName);
@@ -630,6 +636,8 @@ void PythonAPI::setRegistersForInterface(std::string const& mapName, std::string
 void PythonAPI::setFieldsForInterface(std::string const& mapName, std::string const& blockName,
     std::string const& registerName)
 {
+    parameterFinder_->invalidateIndex();
+
     FieldInterface* interfacePointer =
         mapInterface_->getAddressBlockInterface()->getSubInterface()->getSubInterface();
 
@@ -670,6 +678,8 @@ void PythonAPI::setFieldsForInterface(std::string const& mapName, std::string co
 void PythonAPI::setResetsForInterface(std::string const& mapName, std::string const& blockName,
     std::string const& registerName, std::string const& fieldName)
 {
+    parameterFinder_->invalidateIndex();
+
     ResetInterface* interfacePointer =
         mapInterface_->getAddressBlockInterface()->getSubInterface()->getSubInterface()->getSubInterface();
 
@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------------
+// File: ChecksummedFile.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Reading and writing of binary cache files protected by a format version and a checksum.
+//-----------------------------------------------------------------------------
+
+#include "ChecksummedFile.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+//-----------------------------------------------------------------------------
+// Function: ChecksummedFile::cacheFilePath()
+//-----------------------------------------------------------------------------
+QString ChecksummedFile::cacheFilePath(QString const& directory, QString const& key, QString const& suffix)
+{
+    QByteArray keyHash = QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex();
+
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1Char('/') + directory +
+        QLatin1Char('/') + QString::fromLatin1(keyHash) + suffix;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ChecksummedFile::read()
+//-----------------------------------------------------------------------------
+bool ChecksummedFile::read(QString const& filePath, quint32 magic, quint32 version, QByteArray& payload)
+{
+    QFile file(filePath);
+    if (file.open(QIODevice::ReadOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 storedMagic = 0;
+    quint32 storedVersion = 0;
+    QByteArray storedPayload;
+    QByteArray checksum;
+    stream >> storedMagic >> storedVersion >> storedPayload >> checksum;
+
+    if (stream.status() != QDataStream::Ok || storedMagic != magic || storedVersion != version ||
+        QCryptographicHash::hash(storedPayload, QCryptographicHash::Sha1) != checksum)
+    {
+        return false;
+    }
+
+    payload = storedPayload;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ChecksummedFile::write()
+//-----------------------------------------------------------------------------
+bool ChecksummedFile::write(QString const& filePath, quint32 magic, quint32 version, QByteArray const& payload)
+{
+    if (QDir().mkpath(QFileInfo(filePath).absolutePath()) == false)
+    {
+        return false;
+    }
+
+    QSaveFile file(filePath);
+    if (file.open(QIODevice::WriteOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << magic << version << payload << QCryptographicHash::hash(payload, QCryptographicHash::Sha1);
+
+    return stream.status() == QDataStream::Ok && file.commit();
+}
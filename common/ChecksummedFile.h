@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------
+// File: ChecksummedFile.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Reading and writing of binary cache files protected by a format version and a checksum.
+//-----------------------------------------------------------------------------
+
+#ifndef CHECKSUMMEDFILE_H
+#define CHECKSUMMEDFILE_H
+
+#include <QByteArray>
+#include <QString>
+
+//-----------------------------------------------------------------------------
+// Binary cache files consist of an identifier, a format version, the payload and its SHA-1 checksum.
+//-----------------------------------------------------------------------------
+namespace ChecksummedFile
+{
+    /*!
+     *  Gets the path to a cache file in the user cache directory.
+     *
+     *      @param [in] directory   The subdirectory of the cache files.
+     *      @param [in] key         Identifier of the cached content, hashed into the file name.
+     *      @param [in] suffix      The suffix of the file.
+     *
+     *      @return Path to the cache file.
+     */
+    QString cacheFilePath(QString const& directory, QString const& key, QString const& suffix);
+
+    /*!
+     *  Reads the payload from the given file.
+     *
+     *      @param [in]  filePath   Path to the file.
+     *      @param [in]  magic      The identifier the file must begin with.
+     *      @param [in]  version    The format version the file must have.
+     *      @param [out] payload    The payload read from the file.
+     *
+     *      @return True, if the file exists, has the given identifier and version and the checksum matches.
+     */
+    bool read(QString const& filePath, quint32 magic, quint32 version, QByteArray& payload);
+
+    /*!
+     *  Writes the payload to the given file.
+     *
+     *  The file is written through a temporary file so that an interrupted write never leaves a partial file
+     *  behind. Missing directories are created.
+     *
+     *      @param [in] filePath    Path to the file.
+     *      @param [in] magic       The identifier to begin the file with.
+     *      @param [in] version     The format version of the file.
+     *      @param [in] payload     The payload to write.
+     *
+     *      @return True, if the file was written, otherwise false.
+     */
+    bool write(QString const& filePath, quint32 magic, quint32 version, QByteArray const& payload);
+}
+
+#endif // CHECKSUMMEDFILE_H
@@ -18,7 +18,7 @@
 //-----------------------------------------------------------------------------
 // Function: ConsoleMediator::ConsoleMediator()
 //-----------------------------------------------------------------------------
-ConsoleMediator::ConsoleMediator()
+ConsoleMediator::ConsoleMediator(FILE* messageStream): messageStream_(messageStream)
 {
 
 }
@@ -36,8 +36,8 @@ ConsoleMediator::~ConsoleMediator()
 //-----------------------------------------------------------------------------
 void ConsoleMediator::showMessage(QString const& message) const
 {
-    static QTextStream out(stdout); 
-    out << message << endl;  
+    QTextStream out(messageStream_);
+    out << message << endl;
 }
 
 //-----------------------------------------------------------------------------
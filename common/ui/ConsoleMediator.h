@@ -13,6 +13,8 @@
 #define CONSOLEMEDIATOR_H
 
 #include "MessageMediator.h"
+
+#include <cstdio>
 //-----------------------------------------------------------------------------
 //! Console output for user messages.
 //-----------------------------------------------------------------------------
@@ -20,8 +22,12 @@ class ConsoleMediator: public MessageMediator
 {
 public:
 
-    //! The constructor.
-    explicit ConsoleMediator();
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] messageStream   The stream for messages and status messages. Errors go to stderr.
+     */
+    explicit ConsoleMediator(FILE* messageStream = stdout);
 
     //! The destructor.
     virtual ~ConsoleMediator();
@@ -43,6 +49,9 @@ private:
     // Disable copying.
     ConsoleMediator(ConsoleMediator const& rhs);
     ConsoleMediator& operator=(ConsoleMediator const& rhs);
+
+    //! The stream for messages and status messages.
+    FILE* messageStream_;
 };
 
 #endif // CONSOLEMEDIATOR_H
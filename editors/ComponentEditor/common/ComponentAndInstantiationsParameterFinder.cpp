@@ -52,28 +52,14 @@ int ComponentAndInstantiationsParameterFinder::getNumberOfParameters() const
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentAndInstantiationsParameterFinder::searchParameter()
+// Function: ComponentAndInstantiationsParameterFinder::allParameters()
 //-----------------------------------------------------------------------------
-QSharedPointer<Parameter> ComponentAndInstantiationsParameterFinder::searchParameter(QString const& parameterId)
-    const
+QList<QSharedPointer<Parameter> > ComponentAndInstantiationsParameterFinder::allParameters() const
 {
-    QSharedPointer<Parameter> parameter = ComponentParameterFinder::searchParameter(parameterId);
-    if (parameter)
-    {
-        return parameter;
-    }
-    else
-    {
-        for (auto instantiationParameter : allInstantiationsParameters())
-        {
-            if (instantiationParameter->getValueId() == parameterId)
-            {
-                return instantiationParameter;
-            }
-        }
-    }
+    QList<QSharedPointer<Parameter> > parameters = ComponentParameterFinder::allParameters();
+    parameters.append(allInstantiationsParameters());
 
-    return QSharedPointer<Parameter>();
+    return parameters;
 }
 
 //-----------------------------------------------------------------------------
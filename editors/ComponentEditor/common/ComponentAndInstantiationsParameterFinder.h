@@ -62,16 +62,14 @@ public:
      */
     QList<QSharedPointer<Parameter> > allInstantiationsParameters() const;
 
-private:
+protected:
 
-	/*!
-	 *  Get the selected parameter.
-     *
-     *      @param [in] parameterId     ID of the selected parameter.
+    /*!
+     *  Get all the parameters available for the search in search order.
      *
-     *      @return The selected parameter.
+     *      @return The component parameters followed by the instantiation parameters.
      */
-	virtual QSharedPointer<Parameter> searchParameter(QString const& parameterId) const override final;
+    virtual QList<QSharedPointer<Parameter> > allParameters() const override;
 };
 
 #endif // COMPONENTPARAMETERFINDER_H
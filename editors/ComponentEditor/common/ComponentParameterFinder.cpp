@@ -27,7 +27,10 @@
 // Function: ComponentParameterFinder::ComponentParameterFinder()
 //-----------------------------------------------------------------------------
 ComponentParameterFinder::ComponentParameterFinder(QSharedPointer<Component const> component) :
-component_(component)
+component_(component),
+parameterIndex_(),
+indexValid_(false),
+checkedValues_()
 {
 }
 
@@ -167,73 +170,132 @@ void ComponentParameterFinder::registerParameterModel(QAbstractItemModel const*
 void ComponentParameterFinder::setComponent(QSharedPointer<Component const> component)
 {
     component_ = component;
+    invalidateIndex();
 }
 
 //-----------------------------------------------------------------------------
-// Function: ComponentParameterFinder::searchParameter()
+// Function: ComponentParameterFinder::invalidateIndex()
 //-----------------------------------------------------------------------------
-QSharedPointer<Parameter> ComponentParameterFinder::searchParameter(QString const& parameterId) const
+void ComponentParameterFinder::invalidateIndex()
+{
+    parameterIndex_.clear();
+    indexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::findChangedParameterIds()
+//-----------------------------------------------------------------------------
+QStringList ComponentParameterFinder::findChangedParameterIds()
 {
-    if (component_)
+    QHash<QString, QString> currentValues;
+    if (component_.isNull() == false)
     {
-        foreach (QSharedPointer<Parameter> parameter, *component_->getParameters())
+        for (QSharedPointer<Parameter> const& parameter : allParameters())
         {
-            if (parameter->getValueId() == parameterId)
+            QString const id = parameter->getValueId();
+            if (id.isEmpty() == false && currentValues.contains(id) == false)
             {
-                return parameter;
+                currentValues.insert(id, parameter->getValue());
             }
         }
+    }
 
-        foreach (QSharedPointer<Parameter> busInterfaceParameter, allBusInterfaceParameters())
+    QStringList changedIds;
+    for (auto current = currentValues.cbegin(); current != currentValues.cend(); ++current)
+    {
+        auto checked = checkedValues_.constFind(current.key());
+        if (checked == checkedValues_.constEnd() || checked.value() != current.value())
         {
-            if (busInterfaceParameter->getValueId() == parameterId)
-            {
-                return busInterfaceParameter;
-            }
+            changedIds.append(current.key());
         }
+    }
 
-        foreach (QSharedPointer<Parameter> cpuParameter, allCpuParameters())
+    for (auto checked = checkedValues_.cbegin(); checked != checkedValues_.cend(); ++checked)
+    {
+        if (currentValues.contains(checked.key()) == false)
         {
-            if (cpuParameter->getValueId() == parameterId)
-            {
-                return cpuParameter;
-            }
+            changedIds.append(checked.key());
         }
+    }
 
-        foreach (QSharedPointer<Parameter> generatorParameter, allGeneratorParameters())
-        {
-            if (generatorParameter->getValueId() == parameterId)
-            {
-                return generatorParameter;
-            }
-        }
+    checkedValues_.swap(currentValues);
+    return changedIds;
+}
 
-        foreach (QSharedPointer<Parameter> addressSpaceParameter, allAddressSpaceParameters())
-        {
-            if (addressSpaceParameter->getValueId() == parameterId)
-            {
-                return addressSpaceParameter;
-            }
-        }
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::searchParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> ComponentParameterFinder::searchParameter(QString const& parameterId) const
+{
+    if (component_.isNull())
+    {
+        return QSharedPointer<Parameter>();
+    }
 
-        foreach (QSharedPointer<Parameter> registerParameter, allRegisterParameters())
-        {
-            if (registerParameter->getValueId() == parameterId)
-            {
-                return registerParameter;
-            }
-        }
+    // A parameter whose ID has changed after indexing is not returned for its old ID.
+    QSharedPointer<Parameter> parameter = getParameterIndex().value(parameterId);
+    if (parameter && parameter->getValueId() == parameterId)
+    {
+        return parameter;
+    }
 
-        for (auto indirectInterfaceParameter : allIndirectInterfacesParameters())
+    return QSharedPointer<Parameter>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::getParameterIndex()
+//-----------------------------------------------------------------------------
+QHash<QString, QSharedPointer<Parameter> > const& ComponentParameterFinder::getParameterIndex() const
+{
+    if (indexValid_ == false)
+    {
+        rebuildIndex();
+    }
+
+    return parameterIndex_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::rebuildIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterFinder::rebuildIndex() const
+{
+    parameterIndex_.clear();
+    indexValid_ = true;
+
+    if (component_.isNull())
+    {
+        return;
+    }
+
+    // Index in the search order so that the first parameter with a duplicate ID is found, as in a full search.
+    QList<QSharedPointer<Parameter> > const parameters = allParameters();
+
+    parameterIndex_.reserve(parameters.size());
+    for (QSharedPointer<Parameter> const& parameter : parameters)
+    {
+        QString const id = parameter->getValueId();
+        if (id.isEmpty() == false && parameterIndex_.contains(id) == false)
         {
-            if (indirectInterfaceParameter->getValueId() == parameterId)
-            {
-                return indirectInterfaceParameter;
-            }
+            parameterIndex_.insert(id, parameter);
         }
-    }    
+    }
+}
 
-    return QSharedPointer<Parameter>();
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::allParameters()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<Parameter> > ComponentParameterFinder::allParameters() const
+{
+    QList<QSharedPointer<Parameter> > parameters = *component_->getParameters();
+    parameters.append(allBusInterfaceParameters());
+    parameters.append(allCpuParameters());
+    parameters.append(allGeneratorParameters());
+    parameters.append(allAddressSpaceParameters());
+    parameters.append(allRegisterParameters());
+    parameters.append(allIndirectInterfacesParameters());
+
+    return parameters;
 }
 
 //-----------------------------------------------------------------------------
@@ -14,6 +14,9 @@
 
 #include "ParameterFinder.h"
 
+#include <QHash>
+#include <QString>
+
 class AbstractParameterModel;
 class Component;
 
@@ -105,6 +108,22 @@ public:
      */
     virtual void setComponent(QSharedPointer<Component const> component);
 
+    /*!
+     *  Invalidates the index of the parameters. The index is rebuilt on the next lookup.
+     *
+     *  The index must be invalidated when parameters are added, removed or replaced or their IDs change.
+     *  ParameterCache does this for the changes made through the registered parameter models.
+     */
+    void invalidateIndex();
+
+    /*!
+     *  Finds the IDs of the parameters that have been added, removed or whose value has changed since the
+     *  previous call.
+     *
+     *      @return The IDs of the changed parameters. On the first call, all the parameter IDs.
+     */
+    QStringList findChangedParameterIds();
+
     /*!
      *  Returns all the parameters in component address spaces.
      */
@@ -155,7 +174,26 @@ protected:
      */
     QSharedPointer<const Component> getComponent() const;
 
+    /*!
+     *  Get the parameters of the component indexed by their IDs.
+     *
+     *      @return The parameters by ID. Parameters without ID are not included.
+     */
+    QHash<QString, QSharedPointer<Parameter> > const& getParameterIndex() const;
+
+    /*!
+     *  Get all the parameters available for the search in search order.
+     *
+     *      @return The parameters to search from.
+     */
+    virtual QList<QSharedPointer<Parameter> > allParameters() const;
+
 private:
+
+    /*!
+     *  Builds the index of all the parameters in the component.
+     */
+    void rebuildIndex() const;
     
     /*!
      *  Returns number of parameters in bus interfaces.
@@ -173,6 +211,15 @@ private:
 
     //! The parameters are searched from this component.
     QSharedPointer<Component const> component_;
+
+    //! The parameters of the component by ID.
+    mutable QHash<QString, QSharedPointer<Parameter> > parameterIndex_;
+
+    //! Flag for up-to-date parameter index.
+    mutable bool indexValid_;
+
+    //! The parameter values by ID at the previous change check.
+    QHash<QString, QString> checkedValues_;
 };
 
 #endif // COMPONENTPARAMETERFINDER_H
@@ -17,16 +17,41 @@
 // Function: IPXactSystemVerilogParser::IPXactSystemVerilogParser()
 //-----------------------------------------------------------------------------
 IPXactSystemVerilogParser::IPXactSystemVerilogParser(QSharedPointer<ParameterFinder> finder):
-SystemVerilogExpressionParser(), finder_(finder), symbolStack_()
+SystemVerilogExpressionParser(), finder_(finder), symbolStack_(), symbolValues_(), dependents_(),
+    keepSymbolValues_(false), evaluationDepth_(0)
 {
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::parseExpression()
+//-----------------------------------------------------------------------------
+QString IPXactSystemVerilogParser::parseExpression(QString const& expression, bool* validExpression) const
+{
+    // Without change notifications the parameters may have changed between top-level evaluations.
+    if (evaluationDepth_ == 0 && keepSymbolValues_ == false)
+    {
+        clearSymbolValues();
+    }
+
+    evaluationDepth_++;
+    QString value = SystemVerilogExpressionParser::parseExpression(expression, validExpression);
+    evaluationDepth_--;
+
+    return value;
+}
+
 //-----------------------------------------------------------------------------
 // Function: IPXactSystemVerilogParser::isSymbol()
 //-----------------------------------------------------------------------------
 bool IPXactSystemVerilogParser::isSymbol(QString const& expression) const
 {
+    // Record the lookup so that adding or removing the referenced parameter invalidates the evaluated value.
+    if (symbolStack_.isEmpty() == false)
+    {
+        symbolStack_.last().references.append(expression);
+    }
+
     return finder_->hasId(expression);
 }
 
@@ -35,28 +60,137 @@ bool IPXactSystemVerilogParser::isSymbol(QString const& expression) const
 //-----------------------------------------------------------------------------
 QString IPXactSystemVerilogParser::findSymbolValue(QString const& expression) const
 {
-    // Check for ring references.
-    if (symbolStack_.contains(expression))
+    // Check for ring references. All the symbols in the ring evaluate to invalid.
+    for (SymbolFrame const& frame : symbolStack_)
     {
-        symbolStack_.clear();
-        return QStringLiteral("x");
+        if (frame.symbol == expression)
+        {
+            // The values under evaluation depend on where the ring was entered, so none of them are memoized.
+            for (SymbolFrame& evaluatedFrame : symbolStack_)
+            {
+                evaluatedFrame.ringCut = true;
+            }
+
+            return QStringLiteral("x");
+        }
     }
 
-    symbolStack_.append(expression);
+    if (evaluationDepth_ == 0 && keepSymbolValues_ == false)
+    {
+        clearSymbolValues();
+    }
+
+    auto symbolValue = symbolValues_.constFind(expression);
+    if (symbolValue != symbolValues_.constEnd())
+    {
+        return symbolValue->value;
+    }
+
+    SymbolFrame frame;
+    frame.symbol = expression;
+    symbolStack_.append(frame);
+
+    evaluationDepth_++;
     QString value = parseExpression(finder_->valueForId(expression));
-    if (symbolStack_.isEmpty() == false)
+    evaluationDepth_--;
+
+    SymbolFrame const evaluatedFrame = symbolStack_.takeLast();
+    if (evaluatedFrame.ringCut == false)
     {
-        symbolStack_.removeLast();
+        SymbolValue& newValue = symbolValues_[expression];
+        newValue.value = value;
+        newValue.references = evaluatedFrame.references;
+
+        for (QString const& reference : evaluatedFrame.references)
+        {
+            dependents_[reference].insert(expression);
+        }
     }
-    
 
     return value;
 }
 
 //-----------------------------------------------------------------------------
-// Function: IPXactSystemVerilogParser::findSymbolValue()
+// Function: IPXactSystemVerilogParser::getBaseForSymbol()
 //-----------------------------------------------------------------------------
 int IPXactSystemVerilogParser::getBaseForSymbol(QString const& symbol) const
 {
     return baseForExpression(finder_->valueForId(symbol));
 }
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::setKeepSymbolValues()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::setKeepSymbolValues(bool keepValues)
+{
+    keepSymbolValues_ = keepValues;
+    invalidateAll();
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::invalidateSymbols()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::invalidateSymbols(QStringList const& symbols)
+{
+    QVector<QString> invalidatedSymbols = symbols.toVector();
+
+    while (invalidatedSymbols.isEmpty() == false)
+    {
+        QString const symbol = invalidatedSymbols.takeLast();
+
+        removeSymbolValue(symbol);
+
+        // Values evaluated from the symbol are invalid whether the symbol itself was evaluated or not.
+        for (QString const& dependent : dependents_.take(symbol))
+        {
+            if (symbolValues_.contains(dependent))
+            {
+                invalidatedSymbols.append(dependent);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::invalidateAll()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::invalidateAll()
+{
+    clearSymbolValues();
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::removeSymbolValue()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::removeSymbolValue(QString const& symbol)
+{
+    auto symbolValue = symbolValues_.find(symbol);
+    if (symbolValue == symbolValues_.end())
+    {
+        return;
+    }
+
+    for (QString const& reference : symbolValue->references)
+    {
+        auto referenceDependents = dependents_.find(reference);
+        if (referenceDependents != dependents_.end())
+        {
+            referenceDependents->remove(symbol);
+            if (referenceDependents->isEmpty())
+            {
+                dependents_.erase(referenceDependents);
+            }
+        }
+    }
+
+    symbolValues_.erase(symbolValue);
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::clearSymbolValues()
+//-----------------------------------------------------------------------------
+void IPXactSystemVerilogParser::clearSymbolValues() const
+{
+    symbolValues_.clear();
+    dependents_.clear();
+}
@@ -14,8 +14,11 @@
 
 #include "SystemVerilogExpressionParser.h"
 
+#include <QHash>
+#include <QSet>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
 #include <QVector>
 
 class ParameterFinder;
@@ -41,6 +44,16 @@ public:
     IPXactSystemVerilogParser(IPXactSystemVerilogParser const& rhs) = delete;
     IPXactSystemVerilogParser& operator=(IPXactSystemVerilogParser const& rhs) = delete;
 
+    /*!
+     *  Parses an expression to decimal number.
+     *
+     *      @param [in]  expression         The expression to parse.
+     *      @param [out] validExpression    Set to true, if the parsing was successful, otherwise false.
+     *
+     *      @return The decimal value of the evaluated expression.
+     */
+    virtual QString parseExpression(QString const& expression, bool* validExpression = nullptr) const override;
+
     /*!
      *  Checks if the given expression is a symbol e.g. reference.
      *
@@ -68,8 +81,65 @@ public:
      */
     virtual int getBaseForSymbol(QString const& symbol) const override final;
 
+    /*!
+     *  Sets whether the evaluated symbol values are kept between evaluations.
+     *
+     *  By default the values are only reused within a single evaluation. Kept values must be invalidated
+     *  with invalidateSymbols() whenever parameters are added, removed or changed.
+     *
+     *      @param [in] keepValues  True to keep the values between evaluations, otherwise false.
+     */
+    void setKeepSymbolValues(bool keepValues);
+
+    /*!
+     *  Invalidates the values of the given symbols and all the symbols depending on them.
+     *
+     *      @param [in] symbols     The IDs of the added, removed or changed parameters.
+     */
+    void invalidateSymbols(QStringList const& symbols);
+
+    /*!
+     *  Invalidates all the evaluated symbol values.
+     */
+    void invalidateAll();
+
 private:
 
+    //! The memoized value of a symbol.
+    struct SymbolValue
+    {
+        //! The evaluated value.
+        QString value;
+
+        //! The identifiers looked up in the value expression, including the ones that were not symbols.
+        QVector<QString> references;
+    };
+
+    //! A symbol under evaluation.
+    struct SymbolFrame
+    {
+        //! The symbol being evaluated.
+        QString symbol;
+
+        //! The identifiers looked up during the evaluation.
+        QVector<QString> references;
+
+        //! Set when a reference ring was cut during the evaluation.
+        bool ringCut = false;
+    };
+
+    /*!
+     *  Removes the value of a symbol and its edges in the dependency graph.
+     *
+     *      @param [in] symbol  The symbol whose value to remove.
+     */
+    void removeSymbolValue(QString const& symbol);
+
+    /*!
+     *  Removes all the symbol values and the dependency graph.
+     */
+    void clearSymbolValues() const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -77,8 +147,20 @@ private:
     //! The finder for parameters available in the SystemVerilog expressions.
     QSharedPointer<ParameterFinder> finder_;
 
-    //! Stack for tracking already evaluated symbols to check for loops in references.
-    mutable QVector<QString> symbolStack_;
+    //! Stack of the symbols under evaluation to check for loops in references.
+    mutable QVector<SymbolFrame> symbolStack_;
+
+    //! The memoized symbol values by symbol.
+    mutable QHash<QString, SymbolValue> symbolValues_;
+
+    //! The memoized symbols by the identifiers their values were evaluated from.
+    mutable QHash<QString, QSet<QString> > dependents_;
+
+    //! Flag for keeping the symbol values between evaluations.
+    bool keepSymbolValues_;
+
+    //! Depth of the nested expression evaluations.
+    mutable int evaluationDepth_;
 };
 
 #endif // IPXACTSYSTEMVERILOGPARSER_H
@@ -19,9 +19,9 @@
 // Function: ParameterCache::ParameterCache()
 //-----------------------------------------------------------------------------
 ParameterCache::ParameterCache(QSharedPointer<const Component> component) : QObject(0),
-ComponentParameterFinder(component), availableParameters_()
+ComponentParameterFinder(component)
 {
-    resetCache();
+
 }
 
 //-----------------------------------------------------------------------------
@@ -37,7 +37,7 @@ ParameterCache::~ParameterCache()
 //-----------------------------------------------------------------------------
 bool ParameterCache::hasId(QString const& id) const
 {
-    return availableParameters_.contains(id);
+    return searchParameter(id).isNull() == false;
 }
 
 //-----------------------------------------------------------------------------
@@ -45,7 +45,7 @@ bool ParameterCache::hasId(QString const& id) const
 //-----------------------------------------------------------------------------
 QStringList ParameterCache::getAllParameterIds() const
 {
-    return availableParameters_.keys();
+    return getParameterIndex().keys();
 }
 
 //-----------------------------------------------------------------------------
@@ -53,7 +53,7 @@ QStringList ParameterCache::getAllParameterIds() const
 //-----------------------------------------------------------------------------
 QSharedPointer<Parameter> ParameterCache::getParameterWithID(QString const& parameterId) const
 {
-	return availableParameters_.value(parameterId);
+	return searchParameter(parameterId);
 }
 
 //-----------------------------------------------------------------------------
@@ -61,7 +61,7 @@ QSharedPointer<Parameter> ParameterCache::getParameterWithID(QString const& para
 //-----------------------------------------------------------------------------
 int ParameterCache::getNumberOfParameters() const
 {
-	return availableParameters_.count();
+	return getParameterIndex().count();
 }
 
 //-----------------------------------------------------------------------------
@@ -84,6 +84,12 @@ void ParameterCache::registerParameterModel(QAbstractItemModel const* model)
     connect(model, SIGNAL(modelReset()), this, SLOT(resetCache()), Qt::UniqueConnection);
     connect(model, SIGNAL(rowsRemoved(QModelIndex const&, int, int)), this, SLOT(resetCache()), Qt::UniqueConnection);
     connect(model, SIGNAL(rowsInserted(QModelIndex const&, int, int)), this, SLOT(resetCache()), Qt::UniqueConnection);
+    connect(model, SIGNAL(rowsMoved(QModelIndex const&, int, int, QModelIndex const&, int)),
+        this, SLOT(resetCache()), Qt::UniqueConnection);
+
+    // Edits may change the ID of a parameter or replace it.
+    connect(model, SIGNAL(dataChanged(QModelIndex const&, QModelIndex const&, QVector<int> const&)),
+        this, SLOT(resetCache()), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -91,9 +97,5 @@ void ParameterCache::registerParameterModel(QAbstractItemModel const* model)
 //-----------------------------------------------------------------------------
 void ParameterCache::resetCache()
 {
-    availableParameters_.clear();
-    foreach(QString const& id, ComponentParameterFinder::getAllParameterIds())
-    {
-        availableParameters_.insert(id, ComponentParameterFinder::getParameterWithID(id));
-    }
+    ComponentParameterFinder::invalidateIndex();
 }
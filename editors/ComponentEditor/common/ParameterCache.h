@@ -15,8 +15,6 @@
 #include "ParameterFinder.h"
 #include "ComponentParameterFinder.h"
 
-#include <QHash>
-
 class Component;
 class Parameter;
 
@@ -86,6 +84,9 @@ public:
 
 private slots:
 
+    /*!
+     *  Invalidates the cached parameters after a change in a registered model.
+     */
     void resetCache(); 
 
 private:
@@ -94,14 +95,6 @@ private:
     ParameterCache(const ParameterCache& other);
 	//! No assignment
     ParameterCache& operator=(const ParameterCache& other);
-
-    //-----------------------------------------------------------------------------
-    // Data.
-    //-----------------------------------------------------------------------------
-
-    //! Parameters available in the cache. Key is the parameterID.
-	QHash<QString, QSharedPointer<Parameter> > availableParameters_;
-
 };
 
 #endif // PARAMETERCACHE_H
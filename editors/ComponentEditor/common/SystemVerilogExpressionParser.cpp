@@ -13,7 +13,9 @@
 #include "SystemVerilogSyntax.h"
 
 #include <QRegularExpression>
+#include <QHash>
 #include <QMap>
+#include <QReadWriteLock>
 #include <QStringBuilder>
 #include <QStringList>
 #include <QVector>
@@ -43,6 +45,9 @@ namespace
     const QString CLOSE_ARRAY_STRING("}");
 
     const QRegularExpression ANY_OPERATOR(BINARY_OPERATOR.pattern() % "|" % UNARY_OPERATOR.pattern());
+
+    //! The maximum number of compiled expressions kept in memory.
+    const int MAX_COMPILED_EXPRESSIONS = 10000;
 }
 
 //-----------------------------------------------------------------------------
@@ -58,7 +63,20 @@ SystemVerilogExpressionParser::SystemVerilogExpressionParser()
 //-----------------------------------------------------------------------------
 QString SystemVerilogExpressionParser::parseExpression(QString const& expression, bool* validExpression) const
 {
-    return solveRPN(convertToRPN(expression), validExpression);
+    QSharedPointer<CompiledExpression const> compiled = compile(expression);
+
+    // Expressions without references always have the same value.
+    if (compiled->isConstant)
+    {
+        if (validExpression != nullptr)
+        {
+            *validExpression = compiled->isValid;
+        }
+
+        return compiled->value;
+    }
+
+    return solveCompiled(*compiled, validExpression);
 }
 
 //-----------------------------------------------------------------------------
@@ -84,21 +102,108 @@ int SystemVerilogExpressionParser::baseForExpression(QString const& expression)
 {
     int greatestBase = 0;
     
-    for (QString const& token : convertToRPN(expression))
+    for (CompiledToken const& token : compile(expression)->tokens)
     {
-        if (isLiteral(token))
+        if (token.type == TokenType::Constant)
         {
-            greatestBase = qMax(greatestBase, getBaseForNumber(token));
+            greatestBase = qMax(greatestBase, token.base);
         }
-        else if (isSymbol(token))
+        else if (token.type == TokenType::Identifier && isSymbol(token.text))
         {
-            greatestBase = qMax(greatestBase, getBaseForSymbol(token));
+            greatestBase = qMax(greatestBase, getBaseForSymbol(token.text));
         }
     }
 
     return greatestBase;
 }
 
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::compile()
+//-----------------------------------------------------------------------------
+QSharedPointer<SystemVerilogExpressionParser::CompiledExpression const> SystemVerilogExpressionParser::compile(
+    QString const& expression) const
+{
+    // The compiled form depends only on the expression text, so it is shared by all parser instances.
+    static QHash<QString, QSharedPointer<CompiledExpression const> > compiledExpressions;
+    static QReadWriteLock cacheLock;
+
+    {
+        QReadLocker readLock(&cacheLock);
+        auto cached = compiledExpressions.constFind(expression);
+        if (cached != compiledExpressions.cend())
+        {
+            return cached.value();
+        }
+    }
+
+    QSharedPointer<CompiledExpression> compiled(new CompiledExpression());
+    for (QString const& token : convertToRPN(expression))
+    {
+        CompiledToken compiledToken;
+        compiledToken.text = token;
+
+        if (isBinaryOperator(token))
+        {
+            compiledToken.type = TokenType::BinaryOperator;
+        }
+        else if (isUnaryOperator(token))
+        {
+            compiledToken.type = TokenType::UnaryOperator;
+        }
+        else if (token.compare(OPEN_ARRAY_STRING) == 0)
+        {
+            compiledToken.type = TokenType::OpenArray;
+        }
+        else if (token.compare(CLOSE_ARRAY_STRING) == 0)
+        {
+            compiledToken.type = TokenType::CloseArray;
+        }
+        else if (token.compare(QLatin1String("true"), Qt::CaseInsensitive) == 0)
+        {
+            compiledToken.type = TokenType::Constant;
+            compiledToken.value = QStringLiteral("1");
+        }
+        else if (token.compare(QLatin1String("false"), Qt::CaseInsensitive) == 0)
+        {
+            compiledToken.type = TokenType::Constant;
+            compiledToken.value = QStringLiteral("0");
+        }
+        else if (isStringLiteral(token))
+        {
+            compiledToken.type = TokenType::StringLiteral;
+        }
+        else if (isLiteral(token))
+        {
+            compiledToken.type = TokenType::Constant;
+            compiledToken.value = parseConstant(token);
+            compiledToken.base = getBaseForNumber(token);
+        }
+        else
+        {
+            // Whether the identifier is a symbol depends on the parser, so it is resolved on evaluation.
+            compiledToken.type = TokenType::Identifier;
+            compiledToken.value = parseConstant(token);
+            compiled->isConstant = false;
+        }
+
+        compiled->tokens.append(compiledToken);
+    }
+
+    if (compiled->isConstant)
+    {
+        compiled->value = solveCompiled(*compiled, &compiled->isValid);
+    }
+
+    QWriteLocker writeLock(&cacheLock);
+    if (compiledExpressions.size() >= MAX_COMPILED_EXPRESSIONS)
+    {
+        compiledExpressions.clear();
+    }
+
+    compiledExpressions.insert(expression, compiled);
+    return compiled;
+}
+
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::convertToRPN()
 //-----------------------------------------------------------------------------
@@ -232,16 +337,16 @@ QVector<QString> SystemVerilogExpressionParser::convertToRPN(QString const& expr
 }
 
 //-----------------------------------------------------------------------------
-// Function: SystemVerilogExpressionParser::solveRPN()
+// Function: SystemVerilogExpressionParser::solveCompiled()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveRPN(QVector<QString> rpn, bool* validExpression) const
+QString SystemVerilogExpressionParser::solveCompiled(CompiledExpression const& compiled, bool* validExpression) const
 {
     QStringList resultStack;
     bool isWellFormed = true;
     
-    for (QString const& token : rpn)
+    for (CompiledToken const& token : compiled.tokens)
     {
-        if (isBinaryOperator(token))
+        if (token.type == TokenType::BinaryOperator)
         {
             if (resultStack.size() < 2)
             {
@@ -249,9 +354,11 @@ QString SystemVerilogExpressionParser::solveRPN(QVector<QString> rpn, bool* vali
                 break;
             }
 
-            resultStack.append(solveBinary(token, resultStack.takeLast(), resultStack.takeLast()));
+            QString rightTerm = resultStack.takeLast();
+            QString leftTerm = resultStack.takeLast();
+            resultStack.append(solveBinary(token.text, leftTerm, rightTerm));
         }
-        else if (isUnaryOperator(token))
+        else if (token.type == TokenType::UnaryOperator)
         {
             if (resultStack.isEmpty())
             {
@@ -259,13 +366,13 @@ QString SystemVerilogExpressionParser::solveRPN(QVector<QString> rpn, bool* vali
                 break;
             }
 
-            resultStack.append(solveUnary(token, resultStack.takeLast()));
+            resultStack.append(solveUnary(token.text, resultStack.takeLast()));
         }
-        else if (token.compare(OPEN_ARRAY_STRING) == 0)
+        else if (token.type == TokenType::OpenArray || token.type == TokenType::StringLiteral)
         {
-            resultStack.append(token);
+            resultStack.append(token.text);
         }
-        else if (token.compare(CLOSE_ARRAY_STRING) == 0)
+        else if (token.type == TokenType::CloseArray)
         {
             QStringList items;
             while (resultStack.size() > 0 && resultStack.last().compare(OPEN_ARRAY_STRING) != 0)
@@ -279,28 +386,16 @@ QString SystemVerilogExpressionParser::solveRPN(QVector<QString> rpn, bool* vali
                 break;
             }
 
-            QString arrayItem(resultStack.takeLast() % items.join(QLatin1Char(',')) % token);
+            QString arrayItem(resultStack.takeLast() % items.join(QLatin1Char(',')) % token.text);
             resultStack.append(arrayItem);
         }
-        else if (token.compare(QLatin1String("true"), Qt::CaseInsensitive) == 0)
-        {
-            resultStack.append(QStringLiteral("1"));
-        }
-        else if (token.compare(QLatin1String("false"), Qt::CaseInsensitive) == 0)
-        {
-            resultStack.append(QStringLiteral("0"));
-        }
-        else if (isStringLiteral(token))
-        {
-            resultStack.append(token);
-        }
-        else if (isSymbol(token))
+        else if (token.type == TokenType::Identifier && isSymbol(token.text))
         {
-            resultStack.append(findSymbolValue(token));
+            resultStack.append(findSymbolValue(token.text));
         }
         else
         {
-            QString constant = parseConstant(token);            
+            QString const& constant = token.value;
             resultStack.append(constant);           
             
             if (constant == QLatin1String("x"))
@@ -16,6 +16,8 @@
 
 #include <QString>
 #include <QMap>
+#include <QSharedPointer>
+#include <QVector>
 
 //-----------------------------------------------------------------------------
 //! Parser for SystemVerilog expressions.
@@ -120,25 +122,64 @@ protected:
 
 private:
 
+    //! The token types in a compiled expression.
+    enum class TokenType
+    {
+        BinaryOperator,
+        UnaryOperator,
+        OpenArray,
+        CloseArray,
+        StringLiteral,
+        Constant,
+        Identifier
+    };
+
+    //! A single pre-classified token of a compiled expression.
+    struct CompiledToken
+    {
+        TokenType type;     //!< The type of the token.
+        QString text;       //!< The token as written in the expression.
+        QString value;      //!< The decimal value of a constant, or the value if the identifier is not a symbol.
+        int base = 0;       //!< The base of a constant.
+    };
+
+    //! An expression tokenized into RPN once and shared by all the parsers.
+    struct CompiledExpression
+    {
+        QVector<CompiledToken> tokens;  //!< The tokens in RPN order.
+        bool isConstant = true;         //!< Flag for expressions without possible symbol references.
+        QString value;                  //!< The value of a constant expression.
+        bool isValid = false;           //!< Flag for valid constant expression.
+    };
+
     /*!
-     *  Converts the given expression to Reverse Polish Notation (RPN) format.
-     *  RPN is used to ensure the operations are calculated in the correct precedence order.
+     *  Gets the compiled form of the given expression, compiling it on first use.
      *
-     *      @param [in] expression   The expression to convert.
+     *      @param [in] expression   The expression to compile.
      *
-     *      @return The conversion result.
+     *      @return The compiled expression.
      */
-    QVector<QString> convertToRPN(QString const& expression) const;
+    QSharedPointer<CompiledExpression const> compile(QString const& expression) const;
 
     /*!
-     *  Solves the given RPN expression.
+     *  Solves the given compiled expression.
      *
-     *      @param [in]     rpn                The expression to solve.
+     *      @param [in]     compiled           The expression to solve.
      *      @param [out]    validExpression    Set to true, if the parsing was successful, otherwise false.
      *
      *      @return The solved result.
      */
-    QString solveRPN(QVector<QString> rpn, bool* validExpression) const;
+    QString solveCompiled(CompiledExpression const& compiled, bool* validExpression) const;
+
+    /*!
+     *  Converts the given expression to Reverse Polish Notation (RPN) format.
+     *  RPN is used to ensure the operations are calculated in the correct precedence order.
+     *
+     *      @param [in] expression   The expression to convert.
+     *
+     *      @return The conversion result.
+     */
+    QVector<QString> convertToRPN(QString const& expression) const;
 
     /*!
      *  Checks if the given expression is a string.
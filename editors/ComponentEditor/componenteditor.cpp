@@ -96,6 +96,10 @@ parameterReferenceWindow_()
     fullParameterFinder_ = QSharedPointer<ComponentAndInstantiationsParameterFinder>(
         new ComponentAndInstantiationsParameterFinder(component));
 
+    // The evaluated parameter values are kept until the parameters they depend on change.
+    parameterFinder_->findChangedParameterIds();
+    expressionParser_->setKeepSymbolValues(true);
+
     referenceCounter_ = QSharedPointer<ComponentParameterReferenceCounter>(
         new ComponentParameterReferenceCounter(fullParameterFinder_, component_));
 
@@ -163,6 +167,12 @@ parameterReferenceWindow_()
 	connect(&navigationModel_, SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&)),
 		    this, SIGNAL(contentChanged()), Qt::UniqueConnection);
     connect(&navigationModel_, SIGNAL(contentChanged()), this, SIGNAL(contentChanged()), Qt::UniqueConnection);
+
+    // Edits may add, remove or rename parameters, so the parameter indexes must be rebuilt.
+    connect(&navigationModel_, SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&)),
+        this, SLOT(onComponentContentChanged()), Qt::UniqueConnection);
+    connect(&navigationModel_, SIGNAL(contentChanged()), this, SLOT(onComponentContentChanged()),
+        Qt::UniqueConnection);
     connect(&navigationModel_, SIGNAL(helpUrlRequested(QString const&)),
             this, SIGNAL(helpUrlRequested(QString const&)), Qt::UniqueConnection);
 	connect(&navigationModel_, SIGNAL(errorMessage(const QString&)),
@@ -249,6 +259,9 @@ void ComponentEditor::refresh()
     parameterFinder_->setComponent(comp);
     fullParameterFinder_->setComponent(comp);
 
+    parameterFinder_->findChangedParameterIds();
+    expressionParser_->invalidateAll();
+
 	// open the general editor.
 	onItemActivated(proxy_.index(0, 0, QModelIndex()));
 
@@ -428,6 +441,17 @@ void ComponentEditor::onErrorDialog(const QString& message)
     QMessageBox::warning(this, tr("Component editor"), message);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditor::onComponentContentChanged()
+//-----------------------------------------------------------------------------
+void ComponentEditor::onComponentContentChanged()
+{
+    parameterFinder_->invalidateIndex();
+    fullParameterFinder_->invalidateIndex();
+
+    expressionParser_->invalidateSymbols(parameterFinder_->findChangedParameterIds());
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditor::onItemActivated()
 //-----------------------------------------------------------------------------
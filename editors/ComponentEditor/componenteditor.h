@@ -31,7 +31,7 @@
 class LibraryInterface;
 class PluginManager;
 class Component;
-class ExpressionParser;
+class IPXactSystemVerilogParser;
 class ParameterFinder;
 class ExpressionFormatter;
 class ParameterReferenceTreeWindow;
@@ -183,6 +183,12 @@ private slots:
 	*/
 	void onErrorDialog(const QString& message);
 
+    /*!
+     *  Invalidates the parameter indexes and the values depending on the changed parameters when the
+     *  component has been edited.
+     */
+    void onComponentContentChanged();
+
 signals:
     /*!
      *  Opens the specific C source file of the given component.
@@ -285,7 +291,7 @@ private:
     QSharedPointer<ExpressionFormatter> expressionFormatter_;
 
     //! The used expression parser.
-    QSharedPointer<ExpressionParser> expressionParser_;
+    QSharedPointer<IPXactSystemVerilogParser> expressionParser_;
 
     //! The used component validator.
     ComponentValidator validator_;
@@ -0,0 +1,198 @@
+//-----------------------------------------------------------------------------
+// File: FileAnalysisCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Persistent cache of the source analyzer results of a component's files.
+//-----------------------------------------------------------------------------
+
+#include "FileAnalysisCache.h"
+
+#include <common/ChecksummedFile.h>
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QSet>
+
+namespace
+{
+    //! Identifier written in the beginning of every cache file.
+    const quint32 CACHE_MAGIC = 0x4B324641;
+
+    //! Format version of the cache file. Increase whenever the stored content changes.
+    const quint32 CACHE_VERSION = 2;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::load()
+//-----------------------------------------------------------------------------
+bool FileAnalysisCache::load(QString const& componentKey)
+{
+    componentKey_ = componentKey;
+    entries_.clear();
+
+    QByteArray payload;
+    if (ChecksummedFile::read(cacheFilePath(componentKey), CACHE_MAGIC, CACHE_VERSION, payload) == false)
+    {
+        return false;
+    }
+
+    QDataStream payloadStream(payload);
+    payloadStream.setVersion(QDataStream::Qt_5_0);
+
+    QString storedKey;
+    quint32 entryCount = 0;
+    payloadStream >> storedKey >> entryCount;
+
+    if (storedKey != componentKey)
+    {
+        return false;
+    }
+
+    QHash<QString, Entry> loadedEntries;
+    for (quint32 i = 0; i < entryCount && payloadStream.status() == QDataStream::Ok; ++i)
+    {
+        QString path;
+        Entry entry;
+        quint32 dependencyCount = 0;
+        payloadStream >> path >> entry.size >> entry.lastModified >> entry.analyzer >> entry.hash >>
+            entry.dependenciesKnown >> dependencyCount;
+
+        for (quint32 j = 0; j < dependencyCount && payloadStream.status() == QDataStream::Ok; ++j)
+        {
+            FileDependencyDesc dependency;
+            payloadStream >> dependency.filename >> dependency.description;
+            entry.dependencies.append(dependency);
+        }
+
+        loadedEntries.insert(path, entry);
+    }
+
+    if (payloadStream.status() != QDataStream::Ok)
+    {
+        return false;
+    }
+
+    entries_ = loadedEntries;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::save()
+//-----------------------------------------------------------------------------
+bool FileAnalysisCache::save() const
+{
+    if (componentKey_.isEmpty())
+    {
+        return false;
+    }
+
+    QByteArray payload;
+    QDataStream payloadStream(&payload, QIODevice::WriteOnly);
+    payloadStream.setVersion(QDataStream::Qt_5_0);
+
+    payloadStream << componentKey_ << static_cast<quint32>(entries_.size());
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it)
+    {
+        Entry const& entry = it.value();
+        payloadStream << it.key() << entry.size << entry.lastModified << entry.analyzer << entry.hash <<
+            entry.dependenciesKnown << static_cast<quint32>(entry.dependencies.size());
+
+        for (FileDependencyDesc const& dependency : entry.dependencies)
+        {
+            payloadStream << dependency.filename << dependency.description;
+        }
+    }
+
+    return ChecksummedFile::write(cacheFilePath(componentKey_), CACHE_MAGIC, CACHE_VERSION, payload);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::clear()
+//-----------------------------------------------------------------------------
+void FileAnalysisCache::clear()
+{
+    entries_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::invalidateDependenciesIfChanged()
+//-----------------------------------------------------------------------------
+bool FileAnalysisCache::invalidateDependenciesIfChanged(QMap<QString, QString> const& analyzedFiles)
+{
+    // The analyzers whose set of input files has been modified, added to or removed from.
+    QSet<QString> changedAnalyzers;
+    for (auto it = analyzedFiles.cbegin(); it != analyzedFiles.cend(); ++it)
+    {
+        if (findUpToDateEntry(QFileInfo(it.key()), it.value()) == nullptr)
+        {
+            changedAnalyzers.insert(it.value());
+
+            auto cached = entries_.constFind(it.key());
+            if (cached != entries_.cend())
+            {
+                changedAnalyzers.insert(cached->analyzer);
+            }
+        }
+    }
+
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it)
+    {
+        if (analyzedFiles.contains(it.key()) == false)
+        {
+            changedAnalyzers.insert(it->analyzer);
+        }
+    }
+
+    // The dependencies found in a file depend on the definitions in the other files of the same analyzer.
+    // The hashes of the unchanged files remain valid.
+    bool dependenciesDropped = false;
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        if (it->dependenciesKnown && changedAnalyzers.contains(it->analyzer))
+        {
+            it->dependenciesKnown = false;
+            it->dependencies.clear();
+            dependenciesDropped = true;
+        }
+    }
+
+    return dependenciesDropped;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::findUpToDateEntry()
+//-----------------------------------------------------------------------------
+FileAnalysisCache::Entry const* FileAnalysisCache::findUpToDateEntry(QFileInfo const& fileInfo,
+    QString const& analyzer) const
+{
+    auto it = entries_.constFind(fileInfo.absoluteFilePath());
+    if (it == entries_.cend() || it->analyzer != analyzer || it->size != fileInfo.size() ||
+        it->lastModified != fileInfo.lastModified().toMSecsSinceEpoch())
+    {
+        return nullptr;
+    }
+
+    return &it.value();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::insert()
+//-----------------------------------------------------------------------------
+void FileAnalysisCache::insert(QString const& path, Entry const& entry)
+{
+    entries_.insert(path, entry);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileAnalysisCache::cacheFilePath()
+//-----------------------------------------------------------------------------
+QString FileAnalysisCache::cacheFilePath(QString const& componentKey)
+{
+    return ChecksummedFile::cacheFilePath(QStringLiteral("dependencyAnalysis"), componentKey,
+        QStringLiteral(".cache"));
+}
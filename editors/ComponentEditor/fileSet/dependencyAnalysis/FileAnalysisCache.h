@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// File: FileAnalysisCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Persistent cache of the source analyzer results of a component's files.
+//-----------------------------------------------------------------------------
+
+#ifndef FILEANALYSISCACHE_H
+#define FILEANALYSISCACHE_H
+
+#include <Plugins/PluginSystem/ISourceAnalyzerPlugin.h>
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+
+class QFileInfo;
+
+//-----------------------------------------------------------------------------
+//! Persistent cache of the source analyzer results of a component's files.
+//
+// The cache is stored separately for each component in the user cache directory. A file whose size and
+// modification time match the cached values does not need to be hashed again. An analyzer may resolve the
+// dependencies of a file from the other files it analyzes, so the dependencies of a file are reused only while
+// none of the files of the same analyzer have changed.
+//-----------------------------------------------------------------------------
+class FileAnalysisCache
+{
+public:
+
+    //! Cached analysis results of a single file.
+    struct Entry
+    {
+        qint64 size = -1;                           //!< The file size in bytes.
+        qint64 lastModified = 0;                    //!< The modification time in ms since epoch.
+        QString analyzer;                           //!< Name and version of the analyzer, empty if none.
+        QString hash;                               //!< The hash calculated for the file.
+        bool dependenciesKnown = false;             //!< Flag for dependencies scanned from the file.
+        QList<FileDependencyDesc> dependencies;     //!< The dependencies found in the file.
+    };
+
+    //! The constructor.
+    FileAnalysisCache() = default;
+
+    //! The destructor.
+    ~FileAnalysisCache() = default;
+
+    /*! Loads the stored cache of the given component.
+     *
+     *  A missing, outdated or corrupted cache is discarded and all the files will be analyzed.
+     *
+     *      @param [in] componentKey    Identifier of the analyzed component.
+     *
+     *      @return True, if the cache was loaded, otherwise false.
+     */
+    bool load(QString const& componentKey);
+
+    /*! Stores the cache of the component it was loaded for.
+     *
+     *      @return True, if the cache was stored, otherwise false.
+     */
+    bool save() const;
+
+    //! Removes all entries from the cache.
+    void clear();
+
+    /*! Drops the cached dependencies of the files whose analyzer has changed input files.
+     *
+     *  A file has changed, if it is not cached, or its size, modification time or analyzer differs. A cached
+     *  file no longer analyzed has changed for its cached analyzer. The dependencies of the files of other
+     *  analyzers are kept.
+     *
+     *      @param [in] analyzedFiles   The analyzer identities by the absolute paths of the analyzed files.
+     *
+     *      @return True, if any dependencies were dropped, otherwise false.
+     */
+    bool invalidateDependenciesIfChanged(QMap<QString, QString> const& analyzedFiles);
+
+    /*! Finds the entry for the given file, if the file has not changed since it was analyzed.
+     *
+     *      @param [in] fileInfo    The current information of the file.
+     *      @param [in] analyzer    Name and version of the analyzer plugin used for the file.
+     *
+     *      @return Pointer to the entry or nullptr, if the file is not cached or has changed.
+     */
+    Entry const* findUpToDateEntry(QFileInfo const& fileInfo, QString const& analyzer) const;
+
+    /*! Adds or replaces the entry for the given file.
+     *
+     *      @param [in] path    The absolute path to the file.
+     *      @param [in] entry   The entry to store.
+     */
+    void insert(QString const& path, Entry const& entry);
+
+private:
+
+    /*! Gets the path to the cache file of the given component.
+     *
+     *      @param [in] componentKey    Identifier of the component.
+     *
+     *      @return Path to the cache file.
+     */
+    static QString cacheFilePath(QString const& componentKey);
+
+    //! Identifier of the component the cache was loaded for.
+    QString componentKey_;
+
+    //! The cached entries by absolute file path.
+    QHash<QString, Entry> entries_;
+};
+
+#endif // FILEANALYSISCACHE_H
@@ -17,6 +17,8 @@
 
 #include <QFileInfo>
 
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 // Function: FileDependencyItem::FileDependencyItem()
 //-----------------------------------------------------------------------------
@@ -28,7 +30,10 @@ FileDependencyItem::FileDependencyItem()
       path_(),
       references_(),
       fileRefs_(),
-      children_()
+      children_(),
+      folderIndex_(),
+      fileIndex_(),
+      externalFileIndex_()
 {
 }
 
@@ -170,17 +175,13 @@ FileDependencyItem* FileDependencyItem::addFile(QSharedPointer<Component> compon
     QList<QSharedPointer<File> > const& fileRefs)
 {
     FileDependencyItem* item = new FileDependencyItem(component, path, fileRefs, this);
-    
-    for (int i = 0; i < children_.size(); ++i)
-    {
-        if (children_.at(i)->getPath() > path)
-        {
-            children_.insert(i, item);
-            return item;
-        }
-    }
 
-    children_.append(item);
+    // Children are kept sorted by their path.
+    auto position = std::upper_bound(children_.begin(), children_.end(), path,
+        [](QString const& itemPath, FileDependencyItem const* child) { return itemPath < child->path_; });
+    children_.insert(position, item);
+
+    getRoot()->indexItem(item);
     return item;
 }
 
@@ -191,17 +192,12 @@ FileDependencyItem* FileDependencyItem::addFolder(QSharedPointer<Component> comp
 {        
     FileDependencyItem* item = new FileDependencyItem(component, path, this);
 
-    const int childCount = getChildCount();
-    for (int i = 0; i < childCount; i++)
-    {
-        if (getChild(i)->getPath() > path)
-        {
-            children_.insert(i, item);
-            return item;
-        }
-    }
+    // Children are kept sorted by their path.
+    auto position = std::upper_bound(children_.begin(), children_.end(), path,
+        [](QString const& itemPath, FileDependencyItem const* child) { return itemPath < child->path_; });
+    children_.insert(position, item);
 
-    children_.append(item);
+    getRoot()->indexItem(item);
     return item;
 }
 
@@ -315,6 +311,8 @@ void FileDependencyItem::insertItem(FileDependencyItem* item)
     children_.append(item);
     item->parent_ = this;
     item->path_ = path_ + "/" + item->path_;
+
+    getRoot()->indexItem(item);
 }
 
 //-----------------------------------------------------------------------------
@@ -324,11 +322,65 @@ void FileDependencyItem::removeItem(FileDependencyItem* item)
 {
     Q_ASSERT(item->parent_ != 0);
 
+    getRoot()->unindexItem(item);
+
     children_.removeOne(item);
     item->parent_ = 0;
     item->path_ = item->path_.mid(item->path_.indexOf('$', 1) + 2);
 }
 
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::findFolder()
+//-----------------------------------------------------------------------------
+FileDependencyItem* FileDependencyItem::findFolder(QString const& path) const
+{
+    return folderIndex_.value(path, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::findFile()
+//-----------------------------------------------------------------------------
+FileDependencyItem* FileDependencyItem::findFile(QString const& path, QString const& folderPath) const
+{
+    // Of folders with the same path, the first one in the tree is searched first.
+    FileDependencyItem const* firstFolder = folderIndex_.value(folderPath, 0);
+
+    // The matches are iterated from the latest indexed, so the earliest one in a folder is found last.
+    FileDependencyItem* found = 0;
+    for (auto it = fileIndex_.constFind(path); it != fileIndex_.cend() && it.key() == path; ++it)
+    {
+        FileDependencyItem const* folderItem = it.value()->parent_;
+        if (folderItem->parent_ == this && folderItem->path_ == folderPath &&
+            (found == 0 || folderItem == firstFolder || found->parent_ != firstFolder))
+        {
+            found = it.value();
+        }
+    }
+
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::findExternalFile()
+//-----------------------------------------------------------------------------
+FileDependencyItem* FileDependencyItem::findExternalFile(QString const& path) const
+{
+    QString const key = externalFileKey(path);
+
+    // Prefer the first match in the tree order to keep the result independent of the hashing.
+    FileDependencyItem* found = 0;
+    for (auto it = externalFileIndex_.constFind(key); it != externalFileIndex_.cend() && it.key() == key; ++it)
+    {
+        FileDependencyItem* fileItem = it.value();
+        if (fileItem->path_.endsWith(path) && (found == 0 || fileItem->path_ < found->path_))
+        {
+            found = fileItem;
+        }
+    }
+
+    return found;
+}
+
 //-----------------------------------------------------------------------------
 // Function: FileDependencyItem::hasMultipleFileSets()
 //-----------------------------------------------------------------------------
@@ -528,3 +580,82 @@ QList<QSharedPointer<FileSet> > FileDependencyItem::getAllChildFileSets() const
 
     return fileSets;
 }
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::getRoot()
+//-----------------------------------------------------------------------------
+FileDependencyItem* FileDependencyItem::getRoot()
+{
+    FileDependencyItem* root = this;
+    while (root->parent_ != 0)
+    {
+        root = root->parent_;
+    }
+
+    return root;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::indexItem()
+//-----------------------------------------------------------------------------
+void FileDependencyItem::indexItem(FileDependencyItem* item)
+{
+    if (item->type_ == ITEM_TYPE_FILE)
+    {
+        fileIndex_.insert(item->path_, item);
+
+        if (item->isExternal())
+        {
+            externalFileIndex_.insert(externalFileKey(item->path_), item);
+        }
+    }
+    else if (item->parent_ == this && folderIndex_.contains(item->path_) == false)
+    {
+        folderIndex_.insert(item->path_, item);
+    }
+
+    foreach (FileDependencyItem* child, item->children_)
+    {
+        indexItem(child);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::unindexItem()
+//-----------------------------------------------------------------------------
+void FileDependencyItem::unindexItem(FileDependencyItem* item)
+{
+    foreach (FileDependencyItem* child, item->children_)
+    {
+        unindexItem(child);
+    }
+
+    if (item->type_ == ITEM_TYPE_FILE)
+    {
+        fileIndex_.remove(item->path_, item);
+        externalFileIndex_.remove(externalFileKey(item->path_), item);
+    }
+    else if (folderIndex_.value(item->path_, 0) == item)
+    {
+        folderIndex_.remove(item->path_);
+
+        // Another folder with the same path takes the place of the removed one.
+        foreach (FileDependencyItem* folderItem, children_)
+        {
+            if (folderItem != item && folderItem->path_ == item->path_)
+            {
+                folderIndex_.insert(folderItem->path_, folderItem);
+                break;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyItem::externalFileKey()
+//-----------------------------------------------------------------------------
+QString FileDependencyItem::externalFileKey(QString const& path)
+{
+    int separatorIndex = qMax(path.lastIndexOf(QLatin1Char('/')), path.lastIndexOf(QLatin1Char('\\')));
+    return path.mid(separatorIndex + 1);
+}
@@ -17,6 +17,7 @@
 #include <QObject>
 #include <QString>
 #include <QList>
+#include <QHash>
 #include <QSharedPointer>
 
 class File;
@@ -209,6 +210,40 @@ public:
      */
     bool isExternal() const;
 
+    /*!
+     *  Searches the tree for a top-level folder item with the given path.
+     *
+     *      @param [in] path The path of the folder.
+     *
+     *      @return The found folder item or null if not found.
+     *
+     *      @remarks Only relevant to the root item.
+     */
+    FileDependencyItem* findFolder(QString const& path) const;
+
+    /*!
+     *  Searches the tree for a file item with the given path within the given top-level folder.
+     *
+     *      @param [in] path        The path of the file.
+     *      @param [in] folderPath  The path of the folder containing the file.
+     *
+     *      @return The found file item or null if not found. Of several matches, the first one in the tree.
+     *
+     *      @remarks Only relevant to the root item.
+     */
+    FileDependencyItem* findFile(QString const& path, QString const& folderPath) const;
+
+    /*!
+     *  Searches the tree for an external file item whose path ends with the given path.
+     *
+     *      @param [in] path The path to match, compared against whole file names.
+     *
+     *      @return The found file item or null if not found.
+     *
+     *      @remarks Only relevant to the root item.
+     */
+    FileDependencyItem* findExternalFile(QString const& path) const;
+
 private:
     // Disable copying.
     FileDependencyItem(FileDependencyItem const& rhs);
@@ -244,6 +279,32 @@ private:
      */
     QList<QSharedPointer<FileSet> > getAllChildFileSets() const;
 
+    /*!
+     *  Returns the topmost item of the tree containing this item.
+     */
+    FileDependencyItem* getRoot();
+
+    /*!
+     *  Adds the given item and its children to the path lookup of the tree root.
+     *
+     *      @param [in] item The item to add.
+     */
+    void indexItem(FileDependencyItem* item);
+
+    /*!
+     *  Removes the given item and its children from the path lookup of the tree root.
+     *
+     *      @param [in] item The item to remove.
+     */
+    void unindexItem(FileDependencyItem* item);
+
+    /*!
+     *  Returns the key used for the given path in the external file lookup.
+     *
+     *      @param [in] path The file path.
+     */
+    static QString externalFileKey(QString const& path);
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -272,6 +333,14 @@ private:
     //! The child items.
     QList<FileDependencyItem*> children_;
 
+    //! Top-level folders of the tree by path. Only used in the root item.
+    QHash<QString, FileDependencyItem*> folderIndex_;
+
+    //! Files of the tree by path. Only used in the root item.
+    QMultiHash<QString, FileDependencyItem*> fileIndex_;
+
+    //! Files in the external folders of the tree by file name. Only used in the root item.
+    QMultiHash<QString, FileDependencyItem*> externalFileIndex_;
 };
 
 #endif // FILEDEPENDENCYITEM_H
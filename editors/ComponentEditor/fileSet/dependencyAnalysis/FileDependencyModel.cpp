@@ -27,18 +27,26 @@
 #include <QDir>
 #include <QCryptographicHash>
 
+#include <QtConcurrent>
+
 //-----------------------------------------------------------------------------
 // Function: FileDependencyModel::FileDependencyModel()
 //-----------------------------------------------------------------------------
 FileDependencyModel::FileDependencyModel(QSharedPointer<Component> component, QString const& basePath):
 component_(component),
+    analyzedComponent_(),
     basePath_(basePath),
     root_(new FileDependencyItem()),
     timer_(0),
-    curFolderIndex_(0),
-    curFileIndex_(0),
+    analysisWatcher_(0),
+    analyzedItems_(),
+    appliedResultCount_(0),
+    analysisCache_(),
+    analyzedEntries_(),
     progressValue_(0),
-    dependencies_()
+    dependencies_(),
+    dependencyIndex_(),
+    fileDependencyIndex_()
 {
     connect(this, SIGNAL(dependencyAdded(FileDependency*)),
         this, SIGNAL(dependenciesChanged()), Qt::UniqueConnection);
@@ -53,6 +61,10 @@ component_(component),
 //-----------------------------------------------------------------------------
 FileDependencyModel::~FileDependencyModel()
 {
+    // Wait for a running analysis without notifying the views being destroyed.
+    blockSignals(true);
+    stopAnalysis();
+
     delete root_;
 }
 
@@ -379,14 +391,14 @@ Qt::ItemFlags FileDependencyModel::flags(QModelIndex const& index) const
 void FileDependencyModel::startAnalysis()
 {
     // Reset state variables.
-    curFolderIndex_ = 0;
-    curFileIndex_ = 0;
+    appliedResultCount_ = 0;
     progressValue_ = 0;
     emit analysisProgressChanged(progressValue_ + 1);
 
-    // Start the analysis timer.
+    // Start the analysis once the pending changes to the model have been processed.
     timer_ = new QTimer(this);
-    connect(timer_, SIGNAL(timeout()), this, SLOT(performAnalysisStep()));
+    timer_->setSingleShot(true);
+    connect(timer_, SIGNAL(timeout()), this, SLOT(runAnalysis()));
     timer_->start();
 }
 
@@ -401,15 +413,31 @@ void FileDependencyModel::stopAnalysis()
         delete timer_;
         timer_ = 0;
 
+        // The plugins must not be in use when their analysis ends.
+        if (analysisWatcher_ != 0)
+        {
+            analysisWatcher_->disconnect(this);
+            analysisWatcher_->cancel();
+            analysisWatcher_->waitForFinished();
+            analysisWatcher_->deleteLater();
+            analysisWatcher_ = 0;
+
+            saveAnalysisCache();
+        }
+
+        analyzedItems_.clear();
+
         // Reset the progress.
         emit analysisProgressChanged(0);
 
         // End analysis for each plugin.
         foreach (ISourceAnalyzerPlugin* plugin, usedPlugins_)
         {
-            plugin->endAnalysis(component_.data(), basePath_);
+            plugin->endAnalysis(analyzedComponent_.data(), basePath_);
         }
 
+        analyzedComponent_.clear();
+
         emit dependenciesReset();
     }
 }
@@ -427,12 +455,20 @@ FileDependencyItem* FileDependencyModel::addFolder(QString const& path)
 //-----------------------------------------------------------------------------
 void FileDependencyModel::beginReset()
 {
+    // The analyzed items are deleted in the reset.
+    if (analysisWatcher_ != 0)
+    {
+        stopAnalysis();
+    }
+
     beginResetModel();
 
     delete root_;
     root_ = new FileDependencyItem();
 
     dependencies_.clear();
+    dependencyIndex_.clear();
+    fileDependencyIndex_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -480,6 +516,7 @@ void FileDependencyModel::endReset()
         }
 
         dependencies_.append(copy);
+        indexDependency(copy.data());
     }
 
     endResetModel();
@@ -488,72 +525,173 @@ void FileDependencyModel::endReset()
 }
 
 //-----------------------------------------------------------------------------
-// Function: FileDependencyModel::performAnalysisStep()
+// Function: FileDependencyModel::runAnalysis()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::runAnalysis()
+{
+    resolvePlugins();
+
+    // The plugins read the component in the worker threads while the editors may modify it.
+    analyzedComponent_ = component_->clone().staticCast<Component>();
+
+    // Begin analysis for each plugin.
+    foreach (ISourceAnalyzerPlugin* plugin, usedPlugins_)
+    {
+        plugin->beginAnalysis(analyzedComponent_.data(), basePath_);
+    }
+
+    progressValue_++;
+    emit analysisProgressChanged(progressValue_ + 1);
+
+    analysisCache_.load(component_->getVlnv().toString() + QLatin1Char('|') +
+        QDir(basePath_).absolutePath());
+    analyzedEntries_.clear();
+
+    QList<FileAnalysisJob> jobs;
+    QMap<QString, QString> analyzedFiles;
+    analyzedItems_.clear();
+
+    for (int i = 0; i < root_->getChildCount(); ++i)
+    {
+        FileDependencyItem* folderItem = root_->getChild(i);
+        if (folderItem->getType() != FileDependencyItem::ITEM_TYPE_FOLDER)
+        {
+            continue;
+        }
+
+        for (int j = 0; j < folderItem->getChildCount(); ++j)
+        {
+            FileDependencyItem* fileItem = folderItem->getChild(j);
+
+            FileAnalysisJob job;
+            job.absolutePath = General::getAbsolutePath(basePath_, fileItem->getPath());
+            job.lastHash = fileItem->getLastHash();
+            job.plugin = findAnalyzer(fileItem);
+            job.component = analyzedComponent_.data();
+            job.basePath = basePath_;
+            job.cache = &analysisCache_;
+
+            // A new version of the analyzer may find different dependencies.
+            if (job.plugin != 0)
+            {
+                job.analyzerName = job.plugin->getName() + QLatin1Char('/') + job.plugin->getVersion();
+            }
+
+            analyzedFiles.insert(job.absolutePath, job.analyzerName);
+            jobs.append(job);
+            analyzedItems_.append(fileItem);
+        }
+    }
+
+    analysisCache_.invalidateDependenciesIfChanged(analyzedFiles);
+
+    analysisWatcher_ = new QFutureWatcher<FileAnalysisResult>(this);
+    connect(analysisWatcher_, SIGNAL(resultsReadyAt(int, int)),
+        this, SLOT(onAnalysisResultsReady()), Qt::UniqueConnection);
+    connect(analysisWatcher_, SIGNAL(finished()), this, SLOT(onAnalysisFinished()), Qt::UniqueConnection);
+
+    analysisWatcher_->setFuture(QtConcurrent::mapped(jobs, FileAnalyzer()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::onAnalysisResultsReady()
 //-----------------------------------------------------------------------------
-void FileDependencyModel::performAnalysisStep()
+void FileDependencyModel::onAnalysisResultsReady()
 {
-    // Safe-check whether the analysis has already ended.
-    if (progressValue_ == getTotalStepCount())
+    if (analysisWatcher_ == 0)
     {
         return;
     }
 
-    // On first step begin analysis for each resolved plugin.
-    if (progressValue_ == 0)
+    // The results may become ready in any order, but they are applied in the order of the files.
+    QFuture<FileAnalysisResult> analysis = analysisWatcher_->future();
+    QList<FileDependencyItem*> changedFolders;
+
+    while (appliedResultCount_ < analyzedItems_.size() && analysis.isResultReadyAt(appliedResultCount_))
     {
-        resolvePlugins();
+        FileDependencyItem* fileItem = analyzedItems_.at(appliedResultCount_);
+        FileAnalysisResult const result = analysis.resultAt(appliedResultCount_);
+        applyAnalysisResult(fileItem, result);
 
-        // Begin analysis for each plugin.
-        foreach (ISourceAnalyzerPlugin* plugin, usedPlugins_)
+        if (result.cacheEntry.size >= 0)
+        {
+            analyzedEntries_.insert(General::getAbsolutePath(basePath_, fileItem->getPath()), result.cacheEntry);
+        }
+
+        if (changedFolders.contains(fileItem->getParent()) == false)
         {
-            plugin->beginAnalysis(component_.data(), basePath_);
+            changedFolders.append(fileItem->getParent());
         }
 
+        appliedResultCount_++;
         progressValue_++;
     }
-    // Otherwise scan one file on each step.
-    else
+
+    if (changedFolders.isEmpty() == false)
     {
-        // Run the dependency analysis for the current file.
-        if (curFileIndex_ < root_->getChild(curFolderIndex_)->getChildCount())
-        {
-            FileDependencyItem* fileItem = root_->getChild(curFolderIndex_)->getChild(curFileIndex_);
-            analyze(fileItem);
+        updateFolderStatus(changedFolders);
 
-            curFileIndex_++;
-            progressValue_++;
+        // The progress is reset instead when the last result has been applied.
+        if (appliedResultCount_ < analyzedItems_.size())
+        {
+            emit analysisProgressChanged(progressValue_ + 1);
         }
+    }
+}
 
-        // Check if all files in the current folder have been analyzed.
-        while (curFileIndex_ == root_->getChild(curFolderIndex_)->getChildCount())
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::onAnalysisFinished()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::onAnalysisFinished()
+{
+    onAnalysisResultsReady();
+
+    // Folders without any files are updated as well.
+    QList<FileDependencyItem*> folderItems;
+    for (int i = 0; i < root_->getChildCount(); ++i)
+    {
+        if (root_->getChild(i)->getType() == FileDependencyItem::ITEM_TYPE_FOLDER)
         {
-            // Update the status of the folder and continue to the next folder.
-            FileDependencyItem* folderItem = root_->getChild(curFolderIndex_);
-            folderItem->updateStatus();
+            folderItems.append(root_->getChild(i));
+        }
+    }
 
-            emit dataChanged(getItemIndex(folderItem, 0), getItemIndex(folderItem, 
-                FileDependencyColumns::DEPENDENCIES));
+    updateFolderStatus(folderItems);
 
-            curFolderIndex_++;
-            curFileIndex_ = 0;
+    stopAnalysis();
+}
 
-            if (curFolderIndex_ == root_->getChildCount() ||
-                root_->getChild(curFolderIndex_)->getType() != FileDependencyItem::ITEM_TYPE_FOLDER)
-            {
-                break;
-            }
-        }
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::saveAnalysisCache()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::saveAnalysisCache()
+{
+    // After a complete analysis, the files no longer in the component are dropped from the cache.
+    if (appliedResultCount_ == analyzedItems_.size())
+    {
+        analysisCache_.clear();
     }
 
-    // Stop the timer when there are no more folders.
-    if (progressValue_ == getTotalStepCount())
+    for (auto it = analyzedEntries_.cbegin(); it != analyzedEntries_.cend(); ++it)
     {
-        stopAnalysis();
+        analysisCache_.insert(it.key(), it.value());
     }
-    else
+
+    analysisCache_.save();
+    analyzedEntries_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::updateFolderStatus()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::updateFolderStatus(QList<FileDependencyItem*> const& folderItems)
+{
+    foreach (FileDependencyItem* folderItem, folderItems)
     {
-        // Otherwise notify progress of the next file.
-        emit analysisProgressChanged(progressValue_ + 1);
+        folderItem->updateStatus();
+
+        emit dataChanged(getItemIndex(folderItem, 0), getItemIndex(folderItem,
+            FileDependencyColumns::DEPENDENCIES));
     }
 }
 
@@ -622,165 +760,218 @@ void FileDependencyModel::resolvePlugins()
 }
 
 //-----------------------------------------------------------------------------
-// Function: FileDependencyModel::analyze()
+// Function: FileDependencyModel::findAnalyzer()
 //-----------------------------------------------------------------------------
-void FileDependencyModel::analyze(FileDependencyItem* fileItem)
+ISourceAnalyzerPlugin* FileDependencyModel::findAnalyzer(FileDependencyItem* fileItem) const
 {
     Q_ASSERT(fileItem != 0);
 
     // Retrieve the corresponding plugin based on the file type.
-    ISourceAnalyzerPlugin* plugin = 0;
-    
     foreach (QString const& fileType, fileItem->getFileTypes())
     {
-        plugin = analyzerPluginMap_.value(fileType);
+        ISourceAnalyzerPlugin* plugin = analyzerPluginMap_.value(fileType);
         if (plugin != 0)
         {
-            break;
+            return plugin;
         }
     }
 
-    // Check the file for modifications by calculating its hash and comparing to the saved value.
-    QString absPath = General::getAbsolutePath(basePath_, fileItem->getPath());
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::FileAnalyzer::operator()()
+//-----------------------------------------------------------------------------
+FileDependencyModel::FileAnalysisResult FileDependencyModel::FileAnalyzer::operator()(
+    FileAnalysisJob const& job) const
+{
+    FileAnalysisResult result;
+
+    // Unchanged files are taken from the cache without reading them.
+    QFileInfo fileInfo(job.absolutePath);
+    FileAnalysisCache::Entry const* cachedEntry = job.cache->findUpToDateEntry(fileInfo, job.analyzerName);
+
+    FileAnalysisCache::Entry entry;
+    if (cachedEntry != nullptr)
+    {
+        entry = *cachedEntry;
+    }
+    else
+    {
+        entry.size = fileInfo.exists() ? fileInfo.size() : -1;
+        entry.lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
+        entry.analyzer = job.analyzerName;
+
+        // If a corresponding plugin was found, let it calculate the hash.
+        if (job.plugin != 0)
+        {
+            entry.hash = job.plugin->calculateHash(job.absolutePath);
+        }
+        else
+        {
+            // Calculate SHA-1 from the whole file.
+            entry.hash = calculateMd5forFile(job.absolutePath);
+        }
+    }
+
+    result.hash = entry.hash;
+
+    // If the hash has changed, resolve the new dependencies.
+    if (job.plugin != 0 && result.hash != job.lastHash)
+    {
+        if (entry.dependenciesKnown == false)
+        {
+            entry.dependencies = job.plugin->getFileDependencies(job.component, job.basePath,
+                job.absolutePath);
+            entry.dependenciesKnown = true;
+        }
+
+        result.dependencies = entry.dependencies;
+        result.dependenciesScanned = true;
+
+        QString fileDirectory = fileInfo.path();
+        foreach (FileDependencyDesc const& desc, result.dependencies)
+        {
+            result.dependencyPaths.append(General::getRelativePath(job.basePath,
+                QFileInfo(fileDirectory + "/" + desc.filename).canonicalFilePath()));
+        }
+    }
+
+    result.cacheEntry = entry;
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::applyAnalysisResult()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::applyAnalysisResult(FileDependencyItem* fileItem, FileAnalysisResult const& result)
+{
+    Q_ASSERT(fileItem != 0);
+
+    // Check the file for modifications by comparing its hash to the saved value.
     QString lastHash = fileItem->getLastHash();
-    QString currentHash = QString();
+    QString currentHash = result.hash;
     bool dependenciesChanged = false;
 
-    // If a corresponding plugin was found, let it calculate the hash.
-    if (plugin != 0)
+    if (result.dependenciesScanned)
     {
-        currentHash = plugin->calculateHash(absPath);
+        QList<FileDependency*> oldDependencies = findDependencies(fileItem->getPath());
+
+        QString file1 = fileItem->getPath();
 
-        // If the hash has changed, resolve the new dependencies.
-        if (currentHash != lastHash)
+        // Go through all current dependencies.
+        for (int dependencyIndex = 0; dependencyIndex < result.dependencies.size(); ++dependencyIndex)
         {
-            QList<FileDependency*> oldDependencies = findDependencies(fileItem->getPath());
+            FileDependencyDesc const& desc = result.dependencies.at(dependencyIndex);
+            QString file2 = result.dependencyPaths.at(dependencyIndex);
 
-            // Scan the current dependencies.
-            QList<FileDependencyDesc> analyzedDependencies = plugin->getFileDependencies(component_.data(), 
-                basePath_, absPath);
+            FileDependencyItem* fileItem2 = findFileItem(file2);
+            
+            // Check if the second file was an external (not found).
+            if (fileItem2 == 0)
+            {
+                file2 = desc.filename;
+                fileItem2 = findExternalFileItem(file2);
+            }
 
-            QString file1 = fileItem->getPath();
+            // Check if the dependency already exists.
+            FileDependency* found = findDependency(oldDependencies, file1, file2);
 
-            // Go through all current dependencies.
-            foreach (FileDependencyDesc const& desc, analyzedDependencies)
+            if (found == 0)
             {
-                QString file2 = General::getRelativePath(basePath_,
-                    QFileInfo(QFileInfo(absPath).path() + "/" + desc.filename).canonicalFilePath());
-
-                FileDependencyItem* fileItem2 = findFileItem(file2);
-                
-                // Check if the second file was an external (not found).
+                // Create the item for external file if not found.
                 if (fileItem2 == 0)
                 {
-                    file2 = desc.filename;
-                    fileItem2 = findExternalFileItem(file2);
-                }
-
-                // Check if the dependency already exists.
-                FileDependency* found = findDependency(oldDependencies, file1, file2);
-
-                if (found == 0)
-                {
-                    // Create the item for external file if not found.
-                    if (fileItem2 == 0)
+                    FileDependencyItem* folderItem = findFolderItem("$External$");
+                    if (folderItem == 0)
                     {
-                        FileDependencyItem* folderItem = findFolderItem("$External$");
-                        if (folderItem == 0)
-                        {
-                            beginInsertRows(getItemIndex(root_, 0), root_->getChildCount(), root_->getChildCount());
-                            folderItem = root_->addFolder(component_, "$External$");
-                            endInsertRows();
-                        }
-
-                        file2 = "$External$/" + desc.filename;
-
-                        beginInsertRows(getItemIndex(folderItem, 0), folderItem->getChildCount(),
-                            folderItem->getChildCount());
-                        folderItem->addFile(component_, file2, QList<QSharedPointer<File> >());
+                        beginInsertRows(getItemIndex(root_, 0), root_->getChildCount(), root_->getChildCount());
+                        folderItem = root_->addFolder(component_, "$External$");
                         endInsertRows();
                     }
 
-                    // Create a new dependency if not found.
-                    QSharedPointer<FileDependency> dependency(new FileDependency());
-                    dependency->setFile1(file1);
-                    dependency->setFile2(file2);
-                    dependency->setDescription(desc.description);
-                    dependency->setStatus(FileDependency::STATUS_ADDED);
+                    file2 = "$External$/" + desc.filename;
 
-                    addDependency(dependency);
-                    dependenciesChanged = true;
+                    beginInsertRows(getItemIndex(folderItem, 0), folderItem->getChildCount(),
+                        folderItem->getChildCount());
+                    folderItem->addFile(component_, file2, QList<QSharedPointer<File> >());
+                    endInsertRows();
                 }
-                else
-                {
-                    // Remove the dependency from the temporary list.
-                    oldDependencies.removeOne(found);
 
-                    // Check if the existing dependency needs updating to a bidirectional one.
-                    if (found->isBidirectional() == false && found->getFile1() != file1)
-                    {
-                        found->setBidirectional(true);
-
-                        // Combine the descriptions.
-                        found->setDescription(found->getDescription() + "\n" + desc.description);
-                        emit dependencyChanged(found);
+                // Create a new dependency if not found.
+                QSharedPointer<FileDependency> dependency(new FileDependency());
+                dependency->setFile1(file1);
+                dependency->setFile2(file2);
+                dependency->setDescription(desc.description);
+                dependency->setStatus(FileDependency::STATUS_ADDED);
 
-                        dependenciesChanged = true;
-                    }
-                }
+                addDependency(dependency);
+                dependenciesChanged = true;
             }
-
-            // Mark all existing old dependencies as removed.
-            foreach (FileDependency* dependency, oldDependencies)
+            else
             {
-                // If the dependency is a bidirectional one, change it to unidirectional one.
-                if (dependency->isBidirectional())
+                // Remove the dependency from the temporary list.
+                oldDependencies.removeOne(found);
+
+                // Check if the existing dependency needs updating to a bidirectional one.
+                if (found->isBidirectional() == false && found->getFile1() != file1)
                 {
-                    // Add the removed dependency to be able to make the diff view correctly. 
-                    QSharedPointer<FileDependency> removedDependency(new FileDependency());
+                    found->setBidirectional(true);
 
-                    if (dependency->getFile1() == file1)
-                    {
-                        removedDependency->setFile1(file1);
-                        removedDependency->setFile2(dependency->getFile2());
-                    }
-                    else
-                    {
-                        removedDependency->setFile1(dependency->getFile2());
-                        removedDependency->setFile2(file1);
-                    }
-                    
-                    removedDependency->setDescription("");
-                    removedDependency->setStatus(FileDependency::STATUS_REMOVED);
+                    // Combine the descriptions.
+                    found->setDescription(found->getDescription() + "\n" + desc.description);
+                    emit dependencyChanged(found);
 
-                    addDependency(removedDependency);
-                    
-                    // Change the existing dependency into a unidirectional one.
-                    dependency->setBidirectional(false);
+                    dependenciesChanged = true;
+                }
+            }
+        }
 
-                    // Change the direction if needed.
-                    if (dependency->getFile1() == file1)
-                    {
-                        dependency->reverse();
-                    }
+        // Mark all existing old dependencies as removed.
+        foreach (FileDependency* dependency, oldDependencies)
+        {
+            // If the dependency is a bidirectional one, change it to unidirectional one.
+            if (dependency->isBidirectional())
+            {
+                // Add the removed dependency to be able to make the diff view correctly. 
+                QSharedPointer<FileDependency> removedDependency(new FileDependency());
 
-                    dependenciesChanged = true;
-                    emit dependencyChanged(dependency);
+                if (dependency->getFile1() == file1)
+                {
+                    removedDependency->setFile1(file1);
+                    removedDependency->setFile2(dependency->getFile2());
                 }
-                else if (dependency->getFile1() == file1)
+                else
                 {
-                    dependency->setStatus(FileDependency::STATUS_REMOVED);
-                    dependenciesChanged = true;
-                    emit dependencyChanged(dependency);
+                    removedDependency->setFile1(dependency->getFile2());
+                    removedDependency->setFile2(file1);
                 }
+                
+                removedDependency->setDescription("");
+                removedDependency->setStatus(FileDependency::STATUS_REMOVED);
+
+                addDependency(removedDependency);
+                
+                // Change the existing dependency into a unidirectional one.
+                dependency->setBidirectional(false);
+
+                // Change the direction if needed.
+                if (dependency->getFile1() == file1)
+                {
+                    dependency->reverse();
+                }
+
+                dependenciesChanged = true;
+                emit dependencyChanged(dependency);
+            }
+            else if (dependency->getFile1() == file1)
+            {
+                dependency->setStatus(FileDependency::STATUS_REMOVED);
+                dependenciesChanged = true;
+                emit dependencyChanged(dependency);
             }
         }
     }
-    else
-    {
-        // Calculate SHA-1 from the whole file.
-        currentHash = calculateMd5forFile(absPath);
-    }
 
     if (lastHash.isEmpty() == false && currentHash != lastHash)
     {
@@ -809,23 +1000,15 @@ void FileDependencyModel::analyze(FileDependencyItem* fileItem)
 //-----------------------------------------------------------------------------
 // Function: FileDependencyModel::calculateMd5forFile()
 //-----------------------------------------------------------------------------
-QString FileDependencyModel::calculateMd5forFile(QString const& absPath) const
+QString FileDependencyModel::calculateMd5forFile(QString const& absPath)
 {
     QFile file(absPath);
     QCryptographicHash cryptoHash(QCryptographicHash::Md5);
 
     if (file.open(QIODevice::ReadOnly))
     {
-        int const MAX_BYTES_PER_READ = 1024 * 256;
-        char readBuffer[MAX_BYTES_PER_READ];
-        int bytesRead = 0;
-
-        do 
-        {
-            bytesRead = file.read(readBuffer, MAX_BYTES_PER_READ);
-            cryptoHash.addData(readBuffer, bytesRead);
-        }
-        while (bytesRead == MAX_BYTES_PER_READ);
+        // Read in chunks by the hash itself, the stack of the pool threads is too small for a large buffer.
+        cryptoHash.addData(&file);
     }
 
     file.close();
@@ -848,26 +1031,7 @@ FileDependencyItem* FileDependencyModel::findFileItem(QString const& path)
         folderPath = path.left(path.indexOf('$', 1) + 1);
     }
 
-    // Search for a matching folder.
-    for (int i = 0; i < root_->getChildCount(); ++i)
-    {
-        FileDependencyItem* folderItem = root_->getChild(i);
-
-        if (folderItem->getPath() == folderPath)
-        {
-            for (int j = 0; j < folderItem->getChildCount(); ++j)
-            {
-                FileDependencyItem* fileItem = folderItem->getChild(j);
-
-                if (fileItem->getPath() == path)
-                {
-                    return fileItem;
-                }
-            }
-        }
-    }
-
-    return 0;
+    return root_->findFile(path, folderPath);
 }
 
 //-----------------------------------------------------------------------------
@@ -876,28 +1040,13 @@ FileDependencyItem* FileDependencyModel::findFileItem(QString const& path)
 FileDependencyItem* FileDependencyModel::findExternalFileItem(QString& path)
 {
     // Search for the file from all external locations.
-    for (int i = 0; i < root_->getChildCount(); ++i)
+    FileDependencyItem* fileItem = root_->findExternalFile(path);
+    if (fileItem != 0)
     {
-        FileDependencyItem* folderItem = root_->getChild(i);
-
-        if (folderItem->isExternal())
-        {
-            for (int j = 0; j < folderItem->getChildCount(); ++j)
-            {
-                FileDependencyItem* fileItem = folderItem->getChild(j);
-
-                // Check if the file's path ends with the path we're searching for.
-                if (fileItem->getPath().endsWith(path))
-                {
-                    // TODO: Verify that it is fully correct?
-                    path = fileItem->getPath();                   
-                    return fileItem;
-                }
-            }
-        }
+        path = fileItem->getPath();
     }
 
-    return 0;
+    return fileItem;
 }
 
 //-----------------------------------------------------------------------------
@@ -905,16 +1054,7 @@ FileDependencyItem* FileDependencyModel::findExternalFileItem(QString& path)
 //-----------------------------------------------------------------------------
 FileDependencyItem* FileDependencyModel::findFolderItem(QString const& path)
 {
-    // Search for a matching folder.
-    for (int i = 0; i < root_->getChildCount(); ++i)
-    {
-        if (root_->getChild(i)->getPath() == path)
-        {
-            return root_->getChild(i);
-        }
-    }
-
-    return 0;
+    return root_->findFolder(path);
 }
 
 //-----------------------------------------------------------------------------
@@ -940,12 +1080,13 @@ FileDependency* FileDependencyModel::findDependency(QList<FileDependency*> const
 //-----------------------------------------------------------------------------
 FileDependency* FileDependencyModel::findDependency(QString const& file1, QString const& file2) const
 {
-    foreach (QSharedPointer<FileDependency> dependency, dependencies_)
+    // The candidates connect the same files but may have been reversed after indexing.
+    foreach (FileDependency* dependency, dependencyIndex_.value(dependencyKey(file1, file2)))
     {
         if ((dependency->getFile1() == file1 && dependency->getFile2() == file2) ||
             (dependency->isBidirectional() && dependency->getFile1() == file2 && dependency->getFile2() == file1))
         {
-            return dependency.data();
+            return dependency;
         }
     }
 
@@ -958,6 +1099,7 @@ FileDependency* FileDependencyModel::findDependency(QString const& file1, QStrin
 void FileDependencyModel::addDependency(QSharedPointer<FileDependency> dependency)
 {
     dependencies_.append(dependency);
+    indexDependency(dependency.data());
     component_->setFileDependendencies(dependencies_);
 
     emit dependencyAdded(dependency.data());
@@ -973,6 +1115,7 @@ void FileDependencyModel::removeDependency(FileDependency* dependency)
         if (dep == dependency)
         {
             emit dependencyRemoved(dependency);
+            unindexDependency(dependency);
             dependencies_.removeOne(dep);
             component_->setFileDependendencies(dependencies_);
             break;
@@ -993,17 +1136,73 @@ QList< QSharedPointer<FileDependency> > FileDependencyModel::getDependencies() c
 //-----------------------------------------------------------------------------
 QList<FileDependency*> FileDependencyModel::findDependencies(QString const& file) const
 {
-    QList<FileDependency*> dependencies;
+    return fileDependencyIndex_.value(file);
+}
 
-    foreach (QSharedPointer<FileDependency> dep, dependencies_)
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::dependencyKey()
+//-----------------------------------------------------------------------------
+QPair<QString, QString> FileDependencyModel::dependencyKey(QString const& file1, QString const& file2)
+{
+    // The key does not depend on the direction, since dependencies can be reversed at any time.
+    if (file2 < file1)
     {
-        if (dep->getFile1() == file || dep->getFile2() == file)
+        return qMakePair(file2, file1);
+    }
+
+    return qMakePair(file1, file2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::indexDependency()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::indexDependency(FileDependency* dependency)
+{
+    dependencyIndex_[dependencyKey(dependency->getFile1(), dependency->getFile2())].append(dependency);
+
+    fileDependencyIndex_[dependency->getFile1()].append(dependency);
+    if (dependency->getFile2() != dependency->getFile1())
+    {
+        fileDependencyIndex_[dependency->getFile2()].append(dependency);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::unindexDependency()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::unindexDependency(FileDependency* dependency)
+{
+    QPair<QString, QString> const key = dependencyKey(dependency->getFile1(), dependency->getFile2());
+    dependencyIndex_[key].removeOne(dependency);
+    if (dependencyIndex_.value(key).isEmpty())
+    {
+        dependencyIndex_.remove(key);
+    }
+
+    QStringList files;
+    files << dependency->getFile1() << dependency->getFile2();
+    foreach (QString const& file, files)
+    {
+        fileDependencyIndex_[file].removeOne(dependency);
+        if (fileDependencyIndex_.value(file).isEmpty())
         {
-            dependencies.append(dep.data());
+            fileDependencyIndex_.remove(file);
         }
     }
+}
 
-    return dependencies;
+//-----------------------------------------------------------------------------
+// Function: FileDependencyModel::rebuildDependencyIndex()
+//-----------------------------------------------------------------------------
+void FileDependencyModel::rebuildDependencyIndex()
+{
+    dependencyIndex_.clear();
+    fileDependencyIndex_.clear();
+
+    foreach (QSharedPointer<FileDependency> dependency, dependencies_)
+    {
+        indexDependency(dependency.data());
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1094,6 +1293,7 @@ void FileDependencyModel::onExternalRelocated(FileDependencyItem* item, QString
         }
     }
 
+    rebuildDependencyIndex();
     component_->setFileDependendencies(dependencies_);
     emit dependenciesReset();
 }
@@ -12,14 +12,21 @@
 #ifndef FILEDEPENDENCYMODEL_H
 #define FILEDEPENDENCYMODEL_H
 
+#include "FileAnalysisCache.h"
+
+#include <Plugins/PluginSystem/ISourceAnalyzerPlugin.h>
+
 #include <QAbstractItemModel>
+#include <QFutureWatcher>
 #include <QTimer>
 #include <QMap>
+#include <QHash>
+#include <QPair>
 #include <QSharedPointer>
+#include <QVector>
 
 class FileDependencyItem;
 class FileDependency;
-class ISourceAnalyzerPlugin;
 class Component;
 
 //-----------------------------------------------------------------------------
@@ -132,11 +139,14 @@ public:
 
     /*!
      *  Starts the dependency analysis.
+     *
+     *  The files are hashed and scanned for dependencies in the global thread pool. The results are applied to
+     *  the model in the order of the files as they become ready.
      */
     void startAnalysis();
 
     /*!
-     *  Stops the dependency analysis.
+     *  Stops the dependency analysis. A running analysis is cancelled after the files being scanned.
      */
     void stopAnalysis();
 
@@ -273,26 +283,88 @@ signals:
 
 private slots:
     /*!
-     *  Performs one step of the dependency analysis.
+     *  Begins the analysis of the files in the model.
+     */
+    void runAnalysis();
+
+    /*!
+     *  Applies the analysis results that are ready to the model.
      */
-    void performAnalysisStep();
+    void onAnalysisResultsReady();
+
+    /*!
+     *  Finishes the analysis after all the files have been analyzed.
+     */
+    void onAnalysisFinished();
 
 private:
     // Disable copying.
     FileDependencyModel(FileDependencyModel const& rhs);
     FileDependencyModel& operator=(FileDependencyModel const& rhs);
 
+    //! The work of analyzing a single file.
+    struct FileAnalysisJob
+    {
+        QString absolutePath;                       //!< The absolute path to the file.
+        QString lastHash;                           //!< The hash of the file in the previous analysis.
+        ISourceAnalyzerPlugin* plugin = nullptr;    //!< The analyzer for the file type, if any.
+        QString analyzerName;                       //!< Name and version of the analyzer, empty if none.
+        Component const* component = nullptr;      //!< Snapshot of the component being analyzed.
+        QString basePath;                           //!< The base path of the component.
+        FileAnalysisCache const* cache = nullptr;   //!< The results of the previous analyses.
+    };
+
+    //! The result of analyzing a single file.
+    struct FileAnalysisResult
+    {
+        QString hash;                               //!< The current hash of the file.
+        bool dependenciesScanned = false;           //!< Flag for the dependencies scanned by a plugin.
+        QList<FileDependencyDesc> dependencies;     //!< The dependencies found in the file.
+        QStringList dependencyPaths;                //!< The dependency paths relative to the base path.
+        FileAnalysisCache::Entry cacheEntry;        //!< The result to cache, not cached if size is negative.
+    };
+
+    //! Hashes and scans a file for dependencies. Run in the worker threads.
+    struct FileAnalyzer
+    {
+        using result_type = FileAnalysisResult;
+
+        FileAnalysisResult operator()(FileAnalysisJob const& job) const;
+    };
+
     /*!
      *  Resolves plugins for each file type.
      */
     void resolvePlugins();
 
     /*!
-     *  Analyzes the given file item.
+     *  Finds the analyzer plugin for the given file item.
      *
      *      @param [in] fileItem The file item to analyze.
+     *
+     *      @return The analyzer plugin, or null if no plugin supports the file types.
+     */
+    ISourceAnalyzerPlugin* findAnalyzer(FileDependencyItem* fileItem) const;
+
+    /*!
+     *  Applies the analysis result of the given file item into the model.
+     *
+     *      @param [in] fileItem    The analyzed file item.
+     *      @param [in] result      The result of the analysis.
+     */
+    void applyAnalysisResult(FileDependencyItem* fileItem, FileAnalysisResult const& result);
+
+    /*!
+     *  Stores the cached analysis results of the analyzed files.
+     */
+    void saveAnalysisCache();
+
+    /*!
+     *  Updates the status of the given folder items.
+     *
+     *      @param [in] folderItems     The folders to update.
      */
-    void analyze(FileDependencyItem* fileItem);
+    void updateFolderStatus(QList<FileDependencyItem*> const& folderItems);
 
     /*!
      *  Calculates an Md5 sum for a given file. Changes in Md5 indicate change in file content.
@@ -301,7 +373,7 @@ private:
      *
      *      @return The calculated Md5 sum.
      */
-    QString calculateMd5forFile(QString const& absPath) const;
+    static QString calculateMd5forFile(QString const& absPath);
 
     /*!
      *  Searches for a dependency between the given files in the given container.
@@ -321,6 +393,33 @@ private:
      */
     QList<FileDependency*> findDependencies(QString const& file) const;
 
+    /*!
+     *  Returns the lookup key of the dependencies between the given files regardless of their direction.
+     *
+     *      @param [in] file1   File path of the first file.
+     *      @param [in] file2   File path of the second file.
+     */
+    static QPair<QString, QString> dependencyKey(QString const& file1, QString const& file2);
+
+    /*!
+     *  Adds the given dependency to the dependency lookups.
+     *
+     *      @param [in] dependency  The dependency to add.
+     */
+    void indexDependency(FileDependency* dependency);
+
+    /*!
+     *  Removes the given dependency from the dependency lookups.
+     *
+     *      @param [in] dependency  The dependency to remove.
+     */
+    void unindexDependency(FileDependency* dependency);
+
+    /*!
+     *  Rebuilds the dependency lookups after the file paths of the dependencies have changed.
+     */
+    void rebuildDependencyIndex();
+
     /*!
      *  Moves the item to the new parent.
      *
@@ -341,6 +440,9 @@ private:
     //! The parent component.
     QSharedPointer<Component> component_;
 
+    //! Snapshot of the component for the analyzer plugins, so that editing does not race with the workers.
+    QSharedPointer<Component const> analyzedComponent_;
+
     //! The component's base path.
     QString basePath_;
 
@@ -350,14 +452,23 @@ private:
     //! The externals item (for fast access).
     FileDependencyItem* unspecifiedLocation_;
 
-    //! The timer for running the analysis.
+    //! The timer for starting the analysis once the model has been populated.
     QTimer* timer_;
 
-    //! The current folder scan index.
-    int curFolderIndex_;
+    //! Watcher for the running file analysis.
+    QFutureWatcher<FileAnalysisResult>* analysisWatcher_;
 
-    //! The current file scan index.
-    int curFileIndex_;
+    //! The analyzed file items in the order of the analysis results.
+    QVector<FileDependencyItem*> analyzedItems_;
+
+    //! The number of analysis results applied to the model.
+    int appliedResultCount_;
+
+    //! The cached analysis results of the component's files. Only read during the analysis.
+    FileAnalysisCache analysisCache_;
+
+    //! The results to cache from the current analysis by absolute file path.
+    QHash<QString, FileAnalysisCache::Entry> analyzedEntries_;
 
     //! The current analysis progress.
     int progressValue_;
@@ -370,6 +481,12 @@ private:
 
     //! Dependency list.
     QList< QSharedPointer<FileDependency> > dependencies_;
+
+    //! The dependencies by the files they connect, in the order of the dependency list.
+    QHash<QPair<QString, QString>, QList<FileDependency*> > dependencyIndex_;
+
+    //! The dependencies by each file they reference, in the order of the dependency list.
+    QHash<QString, QList<FileDependency*> > fileDependencyIndex_;
 };
 
 //-----------------------------------------------------------------------------
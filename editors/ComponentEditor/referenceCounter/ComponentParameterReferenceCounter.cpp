@@ -36,6 +36,9 @@
 
 #include <editors/ComponentEditor/parameters/AbstractParameterInterface.h>
 
+#include <QHash>
+#include <QRegularExpression>
+
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterReferenceCounter::ComponentParameterReferenceCounter()
 //-----------------------------------------------------------------------------
@@ -61,27 +64,301 @@ void ComponentParameterReferenceCounter::setComponent(QSharedPointer<Component>
 void ComponentParameterReferenceCounter::recalculateReferencesToParameters(QVector<QString> const& parameterList,
     AbstractParameterInterface* parameterInterface)
 {
+    // Recalculation is requested when the counts may be out of date, so the expressions are collected again.
+    QStringList expressions;
+    if (component_)
+    {
+        collectExpressions(expressions);
+    }
+
+    // An ID made of identifier characters can only occur inside a single identifier, so its substring count
+    // is found from the distinct identifiers instead of searching every expression.
+    static const QRegularExpression NON_ID_CHARACTERS(QStringLiteral("[^a-zA-Z0-9:_.]+"));
+
+    QHash<QString, int> identifierCounts;
+    for (QString const& expression : expressions)
+    {
+        for (QString const& identifier : expression.split(NON_ID_CHARACTERS, QString::SkipEmptyParts))
+        {
+            identifierCounts[identifier]++;
+        }
+    }
+
     for (auto parameterName : parameterList)
     {
-        int referenceCount = 0;
         QString parameterID = QString::fromStdString(parameterInterface->getID(parameterName.toStdString()));
         if (!parameterID.isEmpty())
         {
-            referenceCount += countReferencesInFileSets(parameterID);
-            referenceCount += countReferencesInParameters(parameterID, component_->getParameters());
-            referenceCount += countReferencesInMemoryMaps(parameterID);
-            referenceCount += countReferencesInAddressSpaces(parameterID);
-            referenceCount += countReferencesInInstantiations(parameterID);
-            referenceCount += countReferencesInPorts(parameterID);
-            referenceCount += countReferencesInBusInterfaces(parameterID);
-            referenceCount += countReferencesInRemapStates(parameterID);
-            referenceCount += countReferencesInIndirectInterfaces(parameterID);
+            int referenceCount = 0;
+
+            if (parameterID.contains(NON_ID_CHARACTERS))
+            {
+                for (QString const& expression : expressions)
+                {
+                    referenceCount += countReferencesInExpression(parameterID, expression);
+                }
+            }
+            else
+            {
+                for (auto identifier = identifierCounts.cbegin(); identifier != identifierCounts.cend();
+                    ++identifier)
+                {
+                    referenceCount += identifier.value() * countReferencesInExpression(parameterID, identifier.key());
+                }
+            }
 
             parameterInterface->setUsageCount(parameterName.toStdString(), referenceCount);
         }
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectExpressions(QStringList& expressions) const
+{
+    for (QSharedPointer<FileSet> fileSet : *component_->getFileSets())
+    {
+        collectFileBuilderExpressions(expressions, fileSet->getDefaultFileBuilders());
+
+        for (QSharedPointer<File> file : *fileSet->getFiles())
+        {
+            if (file->getBuildCommand())
+            {
+                expressions.append(file->getBuildCommand()->getReplaceDefaultFlags());
+            }
+        }
+    }
+
+    collectParameterExpressions(expressions, component_->getParameters());
+
+    for (QSharedPointer<MemoryMap> memoryMap : *component_->getMemoryMaps())
+    {
+        collectMemoryMapExpressions(expressions, memoryMap);
+
+        for (QSharedPointer<MemoryRemap> remap : *memoryMap->getMemoryRemaps())
+        {
+            collectMemoryMapExpressions(expressions, remap);
+        }
+    }
+
+    for (QSharedPointer<AddressSpace> space : *component_->getAddressSpaces())
+    {
+        expressions.append(space->getWidth());
+        expressions.append(space->getRange());
+
+        if (space->getLocalMemoryMap())
+        {
+            collectMemoryMapExpressions(expressions, space->getLocalMemoryMap());
+        }
+
+        for (QSharedPointer<Segment> segment : *space->getSegments())
+        {
+            expressions.append(segment->getAddressOffset());
+            expressions.append(segment->getRange());
+        }
+    }
+
+    for (QSharedPointer<ComponentInstantiation> instantiation : *component_->getComponentInstantiations())
+    {
+        for (QSharedPointer<ModuleParameter> moduleParameter : *instantiation->getModuleParameters())
+        {
+            collectSingleParameterExpressions(expressions, moduleParameter);
+        }
+
+        collectParameterExpressions(expressions, instantiation->getParameters());
+        collectFileBuilderExpressions(expressions, instantiation->getDefaultFileBuilders());
+    }
+
+    for (QSharedPointer<DesignConfigurationInstantiation> instantiation :
+        *component_->getDesignConfigurationInstantiations())
+    {
+        collectParameterExpressions(expressions, instantiation->getParameters());
+
+        QSharedPointer<ConfigurableVLNVReference> configurationReference =
+            instantiation->getDesignConfigurationReference();
+        if (configurationReference && configurationReference->isValid())
+        {
+            collectConfigurableElementExpressions(expressions, configurationReference);
+        }
+    }
+
+    for (QSharedPointer<DesignInstantiation> instantiation : *component_->getDesignInstantiations())
+    {
+        QSharedPointer<ConfigurableVLNVReference> designReference = instantiation->getDesignReference();
+        if (designReference && designReference->isValid())
+        {
+            collectConfigurableElementExpressions(expressions, designReference);
+        }
+    }
+
+    for (QSharedPointer<Port> port : *component_->getPorts())
+    {
+        expressions.append(port->getLeftBound());
+        expressions.append(port->getRightBound());
+        expressions.append(port->getArrayLeft());
+        expressions.append(port->getArrayRight());
+        expressions.append(port->getDefaultValue());
+    }
+
+    for (QSharedPointer<BusInterface> busInterface : *component_->getBusInterfaces())
+    {
+        collectParameterExpressions(expressions, busInterface->getParameters());
+
+        QSharedPointer<MirroredSlaveInterface> mirroredSlave = busInterface->getMirroredSlave();
+        if (mirroredSlave)
+        {
+            expressions.append(mirroredSlave->getRange());
+
+            for (QSharedPointer<MirroredSlaveInterface::RemapAddress> remapAddress :
+                *mirroredSlave->getRemapAddresses())
+            {
+                expressions.append(remapAddress->remapAddress_);
+            }
+        }
+
+        if (busInterface->getMaster())
+        {
+            expressions.append(busInterface->getMaster()->getBaseAddress());
+        }
+    }
+
+    for (QSharedPointer<RemapState> remapState : *component_->getRemapStates())
+    {
+        for (QSharedPointer<RemapPort> remapPort : *remapState->getRemapPorts())
+        {
+            expressions.append(remapPort->getValue());
+        }
+    }
+
+    for (QSharedPointer<IndirectInterface> indirectInterface : *component_->getIndirectInterfaces())
+    {
+        collectParameterExpressions(expressions, indirectInterface->getParameters());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectParameterExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectParameterExpressions(QStringList& expressions,
+    QSharedPointer<QList<QSharedPointer<Parameter> > > parameters) const
+{
+    for (QSharedPointer<Parameter> parameter : *parameters)
+    {
+        collectSingleParameterExpressions(expressions, parameter);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectSingleParameterExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectSingleParameterExpressions(QStringList& expressions,
+    QSharedPointer<Parameter> parameter) const
+{
+    expressions.append(parameter->getValue());
+    expressions.append(parameter->getVectorLeft());
+    expressions.append(parameter->getVectorRight());
+    expressions.append(parameter->getAttribute(QLatin1String("kactus2:arrayLeft")));
+    expressions.append(parameter->getAttribute(QLatin1String("kactus2:arrayRight")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectConfigurableElementExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectConfigurableElementExpressions(QStringList& expressions,
+    QSharedPointer<ConfigurableVLNVReference> reference) const
+{
+    for (QSharedPointer<ConfigurableElementValue> element : *reference->getConfigurableElementValues())
+    {
+        expressions.append(element->getConfigurableValue());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectFileBuilderExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectFileBuilderExpressions(QStringList& expressions,
+    QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders) const
+{
+    for (QSharedPointer<FileBuilder> builder : *builders)
+    {
+        expressions.append(builder->getReplaceDefaultFlags());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectMemoryMapExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectMemoryMapExpressions(QStringList& expressions,
+    QSharedPointer<MemoryMapBase> memoryMap) const
+{
+    expressions.append(memoryMap->getIsPresent());
+
+    for (QSharedPointer<MemoryBlockBase> memoryBlock : *memoryMap->getMemoryBlocks())
+    {
+        QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
+        if (addressBlock)
+        {
+            expressions.append(addressBlock->getBaseAddress());
+            expressions.append(addressBlock->getRange());
+            expressions.append(addressBlock->getWidth());
+            expressions.append(addressBlock->getIsPresent());
+
+            collectRegisterExpressions(expressions, addressBlock->getRegisterData());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectRegisterExpressions()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectRegisterExpressions(QStringList& expressions,
+    QSharedPointer<QList<QSharedPointer<RegisterBase> > > registerData) const
+{
+    for (QSharedPointer<RegisterBase> registerItem : *registerData)
+    {
+        QSharedPointer<Register> targetRegister = registerItem.dynamicCast<Register>();
+        QSharedPointer<RegisterFile> targetFile = registerItem.dynamicCast<RegisterFile>();
+        if (targetRegister.isNull() && targetFile.isNull())
+        {
+            continue;
+        }
+
+        expressions.append(registerItem->getAddressOffset());
+        expressions.append(registerItem->getDimension());
+        expressions.append(registerItem->getIsPresent());
+
+        if (targetRegister)
+        {
+            expressions.append(targetRegister->getSize());
+
+            for (QSharedPointer<Field> field : *targetRegister->getFields())
+            {
+                expressions.append(field->getBitOffset());
+                expressions.append(field->getBitWidth());
+                expressions.append(field->getIsPresent());
+
+                for (QSharedPointer<FieldReset> fieldReset : *field->getResets())
+                {
+                    expressions.append(fieldReset->getResetValue());
+                    expressions.append(fieldReset->getResetMask());
+                }
+
+                if (field->getWriteConstraint())
+                {
+                    expressions.append(field->getWriteConstraint()->getMinimum());
+                    expressions.append(field->getWriteConstraint()->getMaximum());
+                }
+            }
+        }
+        else
+        {
+            expressions.append(targetFile->getRange());
+            collectRegisterExpressions(expressions, targetFile->getRegisterData());
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterReferenceCounter::countReferencesInFileSets()
 //-----------------------------------------------------------------------------
@@ -16,6 +16,8 @@
 
 #include <IPXACTmodels/Component/MirroredSlaveInterface.h>
 
+#include <QStringList>
+
 class Component;
 class FileBuilder;
 class FileSet;
@@ -43,6 +45,7 @@ class RemapState;
 class RemapPort;
 class AbstractParameterInterface;
 class IndirectInterface;
+class ConfigurableVLNVReference;
 
 //-----------------------------------------------------------------------------
 //! Calculates the amount of references made to component parameters.
@@ -569,6 +572,9 @@ public slots:
     /*!
      *  Recalculate references made to the selected parameters.
      *
+     *  The expressions of the component are collected once for all the selected parameters. The references
+     *  are counted as substrings of the expressions, giving the same counts as the other reference counters.
+     *
      *      @param [in] parameterList       The selected parameters.
      *      @param [in] parameterInterface  Interface for accessing parameters.
      */
@@ -588,6 +594,65 @@ private:
     int countReferencesInWriteConstraint(QString const& parameterID,
         QSharedPointer<WriteValueConstraint> writeConstraint) const;
 
+    /*!
+     *  Collects all the expressions of the component that may refer to component parameters.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     */
+    void collectExpressions(QStringList& expressions) const;
+
+    /*!
+     *  Collects the expressions of the selected parameters.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     *      @param [in] parameters          The selected parameters.
+     */
+    void collectParameterExpressions(QStringList& expressions,
+        QSharedPointer<QList<QSharedPointer<Parameter> > > parameters) const;
+
+    /*!
+     *  Collects the expressions of the selected parameter.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     *      @param [in] parameter           The selected parameter.
+     */
+    void collectSingleParameterExpressions(QStringList& expressions, QSharedPointer<Parameter> parameter) const;
+
+    /*!
+     *  Collects the configurable element values of the selected VLNV reference.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     *      @param [in] reference           The selected VLNV reference.
+     */
+    void collectConfigurableElementExpressions(QStringList& expressions,
+        QSharedPointer<ConfigurableVLNVReference> reference) const;
+
+    /*!
+     *  Collects the replace default flags of the selected file builders.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     *      @param [in] builders            The selected file builders.
+     */
+    void collectFileBuilderExpressions(QStringList& expressions,
+        QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders) const;
+
+    /*!
+     *  Collects the expressions of the selected memory map or memory remap.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     *      @param [in] memoryMap           The selected memory map or memory remap.
+     */
+    void collectMemoryMapExpressions(QStringList& expressions, QSharedPointer<MemoryMapBase> memoryMap) const;
+
+    /*!
+     *  Collects the expressions of the selected registers and register files.
+     *
+     *      @param [in/out] expressions     The list receiving the expressions.
+     *      @param [in] registerData        The selected registers and register files.
+     */
+    void collectRegisterExpressions(QStringList& expressions,
+        QSharedPointer<QList<QSharedPointer<RegisterBase> > > registerData) const;
+
 	//! No copying. No assignment.
     ComponentParameterReferenceCounter(const ComponentParameterReferenceCounter& other);
     ComponentParameterReferenceCounter& operator=(const ComponentParameterReferenceCounter& other);
@@ -84,6 +84,14 @@ bool ComponentEditorAddrBlockItem::isValid() const
     return addressBlockValidator_->validate(addrBlock_, QString::number(addressUnitBits_));
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::getAddressBlock()
+//-----------------------------------------------------------------------------
+QSharedPointer<AddressBlock> ComponentEditorAddrBlockItem::getAddressBlock() const
+{
+    return addrBlock_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::editor()
 //-----------------------------------------------------------------------------
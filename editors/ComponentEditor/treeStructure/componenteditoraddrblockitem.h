@@ -94,6 +94,13 @@ public:
 	 */
 	virtual bool isValid() const override final;
 
+    /*!
+     *  Get the address block of this item.
+     *
+     *      @return The address block edited through this item.
+     */
+    QSharedPointer<AddressBlock> getAddressBlock() const;
+
 	/*!
      *  Get pointer to the editor of this item.
 	 *
@@ -74,6 +74,14 @@ bool ComponentEditorFieldItem::isValid() const
     return fieldValidator_->validate(field_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFieldItem::getField()
+//-----------------------------------------------------------------------------
+QSharedPointer<Field> ComponentEditorFieldItem::getField() const
+{
+    return field_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorFieldItem::editor()
 //-----------------------------------------------------------------------------
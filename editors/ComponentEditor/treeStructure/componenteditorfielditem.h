@@ -98,6 +98,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+    /*!
+     *  Get the field of this item.
+     *
+     *      @return The field edited through this item.
+     */
+    QSharedPointer<Field> getField() const;
+
 	/*!
      *  Get the editor of this item.
 	 *
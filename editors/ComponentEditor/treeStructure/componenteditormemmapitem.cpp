@@ -85,6 +85,14 @@ bool ComponentEditorMemMapItem::isValid() const
     return memoryMapValidator_->validate(memoryMap_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditormemmapitem::getMemoryMap()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryMap> ComponentEditorMemMapItem::getMemoryMap() const
+{
+    return memoryMap_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditormemmapitem::editor()
 //-----------------------------------------------------------------------------
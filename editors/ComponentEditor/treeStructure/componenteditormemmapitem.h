@@ -89,6 +89,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+    /*!
+     *  Get the memory map of this item.
+     *
+     *      @return The memory map edited through this item.
+     */
+    QSharedPointer<MemoryMap> getMemoryMap() const;
+
 	/*!
      *  Get pointer to the editor of this item.
 	 *
@@ -11,6 +11,10 @@
 
 #include "componenteditormemmapsitem.h"
 #include "componenteditormemmapitem.h"
+#include "componenteditoraddrblockitem.h"
+#include "componenteditorregisteritem.h"
+#include "componenteditorfielditem.h"
+#include "componenteditorparametersitem.h"
 #include <editors/ComponentEditor/treeStructure/componenteditortreemodel.h>
 #include <editors/ComponentEditor/memoryMaps/memorymapseditor.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.h>
@@ -35,6 +39,7 @@
 #include <IPXACTmodels/Component/validators/FieldValidator.h>
 #include <IPXACTmodels/Component/validators/EnumeratedValueValidator.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
+#include <IPXACTmodels/common/validators/ValidationCache.h>
 
 //-----------------------------------------------------------------------------
 // Function: componenteditormemmapsitem::ComponentEditorMemMapsItem()
@@ -49,6 +54,7 @@ ComponentEditorItem(model, libHandler, component, parent),
     visualizer_(nullptr),
     expressionParser_(expressionParser),
     memoryMapValidator_(),
+    validationCache_(new ValidationCache(expressionParser)),
     mapInterface_()
 {
     createMemoryMapValidator();
@@ -61,6 +67,9 @@ ComponentEditorItem(model, libHandler, component, parent),
 
 	setObjectName(tr("ComponentEditorMemMapsItem"));
 
+    connect(model_, SIGNAL(dataChanged(QModelIndex const&, QModelIndex const&)),
+        this, SLOT(onItemDataChanged(QModelIndex const&, QModelIndex const&)), Qt::UniqueConnection);
+
     const int childCount = memoryMaps_->count();
 	for (int i = 0; i < childCount; ++i)
     {
@@ -185,33 +194,112 @@ void ComponentEditorMemMapsItem::addressUnitBitsChangedOnMemoryMap(int memoryMap
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditormemmapsitem::onItemDataChanged()
+//-----------------------------------------------------------------------------
+void ComponentEditorMemMapsItem::onItemDataChanged(QModelIndex const& topLeft, QModelIndex const& bottomRight)
+{
+    // Changes to the root are propagated from its children.
+    if (!topLeft.isValid())
+    {
+        return;
+    }
+
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+    {
+        invalidateChangedItem(static_cast<ComponentEditorItem*>(topLeft.sibling(row, 0).internalPointer()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditormemmapsitem::invalidateChangedItem()
+//-----------------------------------------------------------------------------
+void ComponentEditorMemMapsItem::invalidateChangedItem(ComponentEditorItem* changedItem)
+{
+    // Parameter values are checked against the references recorded in the cache.
+    if (qobject_cast<ComponentEditorParametersItem*>(changedItem))
+    {
+        return;
+    }
+
+    // Register files, remaps and subspace maps are validated as a part of the element containing them.
+    for (ComponentEditorItem* item = changedItem; item != nullptr && item != this; item = item->parent())
+    {
+        void const* element = findValidatedElement(item);
+        if (element)
+        {
+            validationCache_->invalidate(element);
+            return;
+        }
+    }
+
+    // A change in the memory maps summary or outside the memory maps may affect any of the results.
+    validationCache_->clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditormemmapsitem::findValidatedElement()
+//-----------------------------------------------------------------------------
+void const* ComponentEditorMemMapsItem::findValidatedElement(ComponentEditorItem* item) const
+{
+    ComponentEditorFieldItem* fieldItem = qobject_cast<ComponentEditorFieldItem*>(item);
+    if (fieldItem)
+    {
+        return fieldItem->getField().data();
+    }
+
+    ComponentEditorRegisterItem* registerItem = qobject_cast<ComponentEditorRegisterItem*>(item);
+    if (registerItem)
+    {
+        return registerItem->getRegister().data();
+    }
+
+    ComponentEditorAddrBlockItem* blockItem = qobject_cast<ComponentEditorAddrBlockItem*>(item);
+    if (blockItem)
+    {
+        return blockItem->getAddressBlock().data();
+    }
+
+    ComponentEditorMemMapItem* memoryMapItem = qobject_cast<ComponentEditorMemMapItem*>(item);
+    if (memoryMapItem)
+    {
+        return memoryMapItem->getMemoryMap().data();
+    }
+
+    return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditormemmapsitem::createMemoryMapValidator()
 //-----------------------------------------------------------------------------
 void ComponentEditorMemMapsItem::createMemoryMapValidator()
 {
+    // The validators evaluate their expressions through the cache to record the references of the results.
+    QSharedPointer<ExpressionParser> validationParser = validationCache_->getRecordingParser();
+
     QSharedPointer<ParameterValidator> parameterValidator (
-        new ParameterValidator(expressionParser_, component_->getChoices()));
-    QSharedPointer<EnumeratedValueValidator> enumValidator (new EnumeratedValueValidator(expressionParser_));
+        new ParameterValidator(validationParser, component_->getChoices()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator (new EnumeratedValueValidator(validationParser));
     QSharedPointer<FieldValidator> fieldValidator (
-        new FieldValidator(expressionParser_, enumValidator, parameterValidator));
+        new FieldValidator(validationParser, enumValidator, parameterValidator));
     QSharedPointer<RegisterValidator> registerValidator (
-        new RegisterValidator(expressionParser_, fieldValidator, parameterValidator));
+        new RegisterValidator(validationParser, fieldValidator, parameterValidator));
     QSharedPointer<RegisterFileValidator> registerFileValidator (
-        new RegisterFileValidator(expressionParser_, registerValidator, parameterValidator));
+        new RegisterFileValidator(validationParser, registerValidator, parameterValidator));
 
     QSharedPointer<AddressBlockValidator> addressBlockValidator (
-        new AddressBlockValidator(expressionParser_, registerValidator,registerFileValidator, parameterValidator));
+        new AddressBlockValidator(validationParser, registerValidator,registerFileValidator, parameterValidator));
 
     QSharedPointer<SubspaceMapValidator> subspaceValidator(
-        new SubspaceMapValidator(expressionParser_, parameterValidator));
+        new SubspaceMapValidator(validationParser, parameterValidator));
 
     QSharedPointer<MemoryMapValidator> memoryMapValidator(new MemoryMapValidator(
-        expressionParser_, addressBlockValidator, subspaceValidator, component_));
+        validationParser, addressBlockValidator, subspaceValidator, component_));
 
     memoryMapValidator_ = memoryMapValidator;
 
     memoryMapValidator_->componentChange(component_);
+    memoryMapValidator_->setValidationCache(validationCache_);
 }
 
 //-----------------------------------------------------------------------------
@@ -24,6 +24,7 @@ class MemoryMapValidator;
 class MemoryMapInterface;
 class BusInterfaceInterface;
 class ParameterValidator;
+class ValidationCache;
 
 //-----------------------------------------------------------------------------
 //! The Memory maps-item in the component navigation tree.
@@ -109,6 +110,16 @@ public slots:
      */
     void addressUnitBitsChangedOnMemoryMap(int memoryMapIndex);
 
+private slots:
+
+    /*!
+     *  Invalidates the stored validation results affected by the changed items of the component editor tree.
+     *
+     *      @param [in] topLeft         The index of the first changed item.
+     *      @param [in] bottomRight     The index of the last changed item.
+     */
+    void onItemDataChanged(QModelIndex const& topLeft, QModelIndex const& bottomRight);
+
 signals:
 
     /*!
@@ -169,6 +180,22 @@ private:
      */
     BusInterfaceInterface* createInterfaceForBus(QSharedPointer<ParameterValidator> parameterValidator);
 
+    /*!
+     *  Invalidates the stored validation results affected by a changed item.
+     *
+     *      @param [in] changedItem     The changed item.
+     */
+    void invalidateChangedItem(ComponentEditorItem* changedItem);
+
+    /*!
+     *  Finds the element whose validation result is stored for the selected item.
+     *
+     *      @param [in] item    The selected item.
+     *
+     *      @return The validated element of the item, or null if the item has no stored result of its own.
+     */
+    void const* findValidatedElement(ComponentEditorItem* item) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -185,6 +212,9 @@ private:
     //! The current memory map validator.
     QSharedPointer<MemoryMapValidator> memoryMapValidator_;
 
+    //! The stored validation results of the memory map elements.
+    QSharedPointer<ValidationCache> validationCache_;
+
     //! Interface for accessing memory maps.
     MemoryMapInterface* mapInterface_;
 };
@@ -87,6 +87,14 @@ bool ComponentEditorRegisterItem::isValid() const
     return registerValidator_->validate(reg_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::getRegister()
+//-----------------------------------------------------------------------------
+QSharedPointer<Register> ComponentEditorRegisterItem::getRegister() const
+{
+    return reg_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorregisteritem::editor()
 //-----------------------------------------------------------------------------
@@ -98,6 +98,13 @@ public:
 	 */
 	virtual bool isValid() const;
 
+    /*!
+     *  Get the register of this item.
+     *
+     *      @return The register edited through this item.
+     */
+    QSharedPointer<Register> getRegister() const;
+
 	/*! Get pointer to the editor of this item.
 	 *
 	 *      @return Pointer to the editor to use for this item.
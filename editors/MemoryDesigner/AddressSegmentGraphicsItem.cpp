@@ -25,8 +25,8 @@
 AddressSegmentGraphicsItem::AddressSegmentGraphicsItem(QSharedPointer<MemoryItem const> segmentItem,
     bool isEmptySegment, QVector<QString> identifierChain,
     QSharedPointer<ConnectivityComponent const> containingInstance, AddressSpaceGraphicsItem* spaceItem):
-MemoryDesignerChildGraphicsItem(segmentItem, QStringLiteral("Segment"), segmentItem->getOffset().toULongLong(),
-    segmentItem->getRange().toULongLong(), getSegmentItemWidth(spaceItem), identifierChain, containingInstance,
+MemoryDesignerChildGraphicsItem(segmentItem, QStringLiteral("Segment"), segmentItem->getOffsetValue(),
+    segmentItem->getRangeValue(), getSegmentItemWidth(spaceItem), identifierChain, containingInstance,
     spaceItem)
 {
     setColors(KactusColors::ADDRESS_SEGMENT, isEmptySegment);
@@ -43,7 +43,7 @@ cpuIcon_(new QGraphicsPixmapItem(QPixmap(":icons/common/graphics/settings-code_e
     QBrush addressSpaceBrush(KactusColors::ADDRESS_SEGMENT);
     setBrush(addressSpaceBrush);
 
-    quint64 spaceRangeInt = memoryItem->getRange().toULongLong();
+    quint64 spaceRangeInt = memoryItem->getRangeValue();
     int spaceWidth = 250;
 
     setGraphicsRectangle(spaceWidth + 1, spaceRangeInt);
@@ -109,12 +109,9 @@ MemoryDesignerChildGraphicsItem* AddressSpaceGraphicsItem::createNewSubItem(
 MemoryDesignerChildGraphicsItem* AddressSpaceGraphicsItem::createEmptySubItem(quint64 beginAddress,
     quint64 rangeEnd)
 {
-    QString emptySegmentOffset = QString::number(beginAddress);
-    QString emptySegmentRange = QString::number(rangeEnd - beginAddress + 1);
-
     QSharedPointer<MemoryItem> emptySegment(new MemoryItem("Empty", MemoryDesignerConstants::ADDRESSSEGMENT_TYPE));
-    emptySegment->setOffset(emptySegmentOffset);
-    emptySegment->setRange(emptySegmentRange);
+    emptySegment->setOffset(beginAddress);
+    emptySegment->setRange(rangeEnd - beginAddress + 1);
 
     return createNewSubItem(emptySegment, true);
 }
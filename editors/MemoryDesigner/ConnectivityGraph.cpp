@@ -21,7 +21,9 @@
 ConnectivityGraph::ConnectivityGraph():
 vertices_(),
 edges_(),
-instances_()
+instances_(),
+connectionIndex_(),
+indexedConnectionCount_(0)
 {
 
 }
@@ -56,18 +58,9 @@ QVector<QSharedPointer<ConnectivityComponent> >& ConnectivityGraph::getInstances
 QVector<QSharedPointer<ConnectivityConnection const> > ConnectivityGraph::getConnectionsFor(
     QSharedPointer<ConnectivityInterface const> startPoint) const
 {
-    QVector<QSharedPointer<ConnectivityConnection const> > connections;
+    updateConnectionIndex();
 
-    for (int i = 0; i< edges_.size(); ++i)
-    {
-        QSharedPointer<ConnectivityConnection const> edge = edges_.at(i);
-        if (edge->getFirstInterface() == startPoint || edge->getSecondInterface() == startPoint)
-        {
-            connections.append(edge);
-        }
-    }
-
-    return connections;
+    return connectionIndex_.value(startPoint.data());
 }
 
 //-----------------------------------------------------------------------------
@@ -96,3 +89,39 @@ QVector<QSharedPointer<ConnectivityConnection> >& ConnectivityGraph::getConnecti
 {
     return edges_;
 }
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraph::invalidateConnectionIndex()
+//-----------------------------------------------------------------------------
+void ConnectivityGraph::invalidateConnectionIndex() const
+{
+    connectionIndex_.clear();
+    indexedConnectionCount_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraph::updateConnectionIndex()
+//-----------------------------------------------------------------------------
+void ConnectivityGraph::updateConnectionIndex() const
+{
+    if (indexedConnectionCount_ > edges_.size())
+    {
+        invalidateConnectionIndex();
+    }
+
+    for (int i = indexedConnectionCount_; i < edges_.size(); ++i)
+    {
+        QSharedPointer<ConnectivityConnection const> edge = edges_.at(i);
+
+        ConnectivityInterface const* firstInterface = edge->getFirstInterface().data();
+        ConnectivityInterface const* secondInterface = edge->getSecondInterface().data();
+
+        connectionIndex_[firstInterface].append(edge);
+        if (secondInterface != firstInterface)
+        {
+            connectionIndex_[secondInterface].append(edge);
+        }
+    }
+
+    indexedConnectionCount_ = edges_.size();
+}
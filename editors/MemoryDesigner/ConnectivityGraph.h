@@ -12,6 +12,7 @@
 #ifndef CONNECTIVITYGRAPH_H
 #define CONNECTIVITYGRAPH_H
 
+#include <QHash>
 #include <QSharedPointer>
 #include <QVector>
 
@@ -50,6 +51,9 @@ public:
     /*!
      *  Finds all connections for the given interface.
      *
+     *  The connections are looked up from an adjacency index that is updated with the connections appended to
+     *  the graph since the previous lookup.
+     *
      *      @param [in] startPoint   The interface to find connections for.
      *
      *      @return All connections to/from the given interface.
@@ -71,16 +75,29 @@ public:
     /*!
      *  Get all connections in the graph.
      *
+     *  New connections may be appended to the list. Call invalidateConnectionIndex() after removing or
+     *  replacing any of the existing connections.
+     *
      *      @return All connections in the graph.
      */
     QVector<QSharedPointer<ConnectivityConnection> >& getConnections() const;
 
+    /*!
+     *  Discards the adjacency index of the connections. The index is rebuilt on the next lookup.
+     */
+    void invalidateConnectionIndex() const;
+
 private:
 
 	// Disable copying.
 	ConnectivityGraph(ConnectivityGraph const& rhs);
 	ConnectivityGraph& operator=(ConnectivityGraph const& rhs);
 
+    /*!
+     *  Adds the connections appended to the graph after the previous lookup into the adjacency index.
+     */
+    void updateConnectionIndex() const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -93,6 +110,13 @@ private:
 
     //! The component instances in the graph.
     mutable QVector<QSharedPointer<ConnectivityComponent> > instances_;
+
+    //! The connections of each interface in the order they appear in the edges.
+    mutable QHash<ConnectivityInterface const*, QVector<QSharedPointer<ConnectivityConnection const> > >
+        connectionIndex_;
+
+    //! The number of edges added to the connection index.
+    mutable int indexedConnectionCount_;
 };
 
 #endif // CONNECTIVITYGRAPH_H
@@ -199,7 +199,7 @@ void ConnectivityGraphFactory::addAddressSpaceMemories(QSharedPointer<Connectivi
             spaceItem->setIdentifier(spaceIdentifier);
             spaceItem->setDisplayName(space->displayName());
             spaceItem->setAUB(spaceAUB);
-            spaceItem->setAddress("0");
+            spaceItem->setAddress(0);
 
             if (!space->getRange().isEmpty())
             {
@@ -213,6 +213,8 @@ void ConnectivityGraphFactory::addAddressSpaceMemories(QSharedPointer<Connectivi
 
             newInstance->addMemory(spaceItem);
 
+            spaceItem->reserveChildren(space->getSegments()->size() + (space->hasLocalMemoryMap() ? 1 : 0));
+
             foreach(QSharedPointer<Segment> segment, *space->getSegments())
             {
                 if (segment->getIsPresent().isEmpty() ||
@@ -221,8 +223,16 @@ void ConnectivityGraphFactory::addAddressSpaceMemories(QSharedPointer<Connectivi
                     QSharedPointer<MemoryItem> segmentItem(new MemoryItem(segment->name(), "segment"));
                     segmentItem->setIdentifier(spaceIdentifier + '.' + segment->name());
                     segmentItem->setDisplayName(segment->displayName());
-                    segmentItem->setRange(expressionParser_->parseExpression(segment->getRange()));
-                    segmentItem->setOffset(expressionParser_->parseExpression(segment->getAddressOffset()));
+
+                    if (!segment->getRange().isEmpty())
+                    {
+                        segmentItem->setRange(expressionParser_->parseExpression(segment->getRange()));
+                    }
+
+                    if (!segment->getAddressOffset().isEmpty())
+                    {
+                        segmentItem->setOffset(expressionParser_->parseExpression(segment->getAddressOffset()));
+                    }
 
                     spaceItem->addChild(segmentItem);
                 }
@@ -277,7 +287,8 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryMapData(QShared
     QSharedPointer<MemoryItem> mapItem(new MemoryItem(map->name(), "memoryMap"));
     mapItem->setIdentifier(mapIdentifier);
     mapItem->setDisplayName(map->displayName());
-    mapItem->setAUB(QString::number(addressableUnitBits));
+    mapItem->setAUB(addressableUnitBits);
+    mapItem->reserveChildren(map->getMemoryBlocks()->size());
 
     General::Usage mapUsage = General::USAGE_COUNT;
     foreach (QSharedPointer<MemoryBlockBase> block, *map->getMemoryBlocks())
@@ -309,17 +320,25 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryBlock(
     QSharedPointer<const AddressBlock> addressBlock, QString const& mapIdentifier, int addressableUnitBits) const
 {
     QString blockIdentifier = mapIdentifier + "." + addressBlock->name();
-    int baseAddress = expressionParser_->parseExpression(addressBlock->getBaseAddress()).toInt();
+    quint64 baseAddress = parseValue(addressBlock->getBaseAddress());
 
     QSharedPointer<MemoryItem> blockItem(new MemoryItem(addressBlock->name(), "addressBlock"));
     blockItem->setIdentifier(blockIdentifier);
     blockItem->setDisplayName(addressBlock->displayName());
-    blockItem->setAUB(QString::number(addressableUnitBits));
-    blockItem->setAddress(QString::number(baseAddress));
-    blockItem->setRange(expressionParser_->parseExpression(addressBlock->getRange()));
-    blockItem->setWidth(expressionParser_->parseExpression(addressBlock->getWidth()));
+    blockItem->setAUB(addressableUnitBits);
+    blockItem->setAddress(baseAddress);
     blockItem->setUsage(addressBlock->getUsage());
 
+    if (!addressBlock->getRange().isEmpty())
+    {
+        blockItem->setRange(expressionParser_->parseExpression(addressBlock->getRange()));
+    }
+
+    if (!addressBlock->getWidth().isEmpty())
+    {
+        blockItem->setWidth(expressionParser_->parseExpression(addressBlock->getWidth()));
+    }
+
     QString blockPresence = addressBlock->getIsPresent();
     if (blockPresence.isEmpty())
     {
@@ -331,6 +350,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryBlock(
     }
 
     blockItem->setIsPresent(blockPresence);
+    blockItem->reserveChildren(addressBlock->getRegisterData()->size());
 
     foreach (QSharedPointer<RegisterBase> registerBase, *addressBlock->getRegisterData())
     {
@@ -353,12 +373,12 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryBlock(
 //-----------------------------------------------------------------------------
 // Function: ConnectivityGraphFactory::addRegisterData()
 //-----------------------------------------------------------------------------
-void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> reg, int baseAddress, 
+void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> reg, quint64 baseAddress,
     int addressableUnitBits, QString const& blockIdentifier, QSharedPointer<MemoryItem> blockItem) const
 {
-    quint64 registerOffset = expressionParser_->parseExpression(reg->getAddressOffset()).toInt();
+    quint64 registerOffset = parseValue(reg->getAddressOffset());
     quint64 registerAddress = baseAddress + registerOffset;
-    int registerSize =  expressionParser_->parseExpression(reg->getSize()).toInt();
+    QString registerSize = expressionParser_->parseExpression(reg->getSize());
     int registerDimension = expressionParser_->parseExpression(reg->getDimension()).toInt();
 
     for (int i = 0; i < registerDimension || (i == 0 && registerDimension == 0); i++)
@@ -372,10 +392,14 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
         QSharedPointer<MemoryItem> regItem(new MemoryItem(reg->name(), "register"));
         regItem->setIdentifier(registerIdentifier);
         regItem->setDisplayName(reg->displayName());
-        regItem->setAUB(QString::number(addressableUnitBits));
-        regItem->setAddress(QString::number(registerAddress));
-        regItem->setOffset(QString::number(registerOffset));
-        regItem->setSize(expressionParser_->parseExpression(reg->getSize()));
+        regItem->setAUB(addressableUnitBits);
+        regItem->setAddress(registerAddress);
+        regItem->setOffset(registerOffset);
+
+        if (!reg->getSize().isEmpty())
+        {
+            regItem->setSize(registerSize);
+        }
 
         QVector<QSharedPointer<MemoryItem> > fieldItems;
 
@@ -389,6 +413,7 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
         }
 
         QMap<quint64, QSharedPointer<MemoryItem> > orderedFieldItems = getOrderedFieldItems(regItem, fieldItems);
+        regItem->reserveChildren(orderedFieldItems.size() + 1);
 
         QMapIterator<quint64, QSharedPointer<MemoryItem> > fieldIterator(orderedFieldItems);
         while (fieldIterator.hasNext())
@@ -400,7 +425,7 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
         regItem->addChild(
             createRegisterResetItem(orderedFieldItems, regItem, registerIdentifier, addressableUnitBits));
 
-        registerAddress += registerSize / addressableUnitBits;      
+        registerAddress += registerSize.toULongLong() / addressableUnitBits;      
 
         blockItem->addChild(regItem);
     }
@@ -412,15 +437,15 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
 QMap<quint64, QSharedPointer<MemoryItem> > ConnectivityGraphFactory::getOrderedFieldItems(
     QSharedPointer<MemoryItem> registerItem, QVector<QSharedPointer<MemoryItem> > fieldItems) const
 {
-    quint64 registerOffset = registerItem->getAddress().toULongLong();
+    quint64 registerOffset = registerItem->getAddressValue();
     QMap<quint64, QSharedPointer<MemoryItem> > orderedFieldItems;
 
     for (auto fieldItem : fieldItems)
     {
-        quint64 fieldAddress = fieldItem->getAddress().toInt();
-        quint64 fieldStart = fieldItem->getOffset().toInt();
+        quint64 fieldAddress = fieldItem->getAddressValue();
+        quint64 fieldStart = fieldItem->getOffsetValue();
 
-        int aub = fieldItem->getAUB().toInt();
+        quint64 aub = fieldItem->getAUBValue();
 
         fieldStart = (fieldAddress - registerOffset) * aub + fieldStart;
 
@@ -434,18 +459,24 @@ QMap<quint64, QSharedPointer<MemoryItem> > ConnectivityGraphFactory::getOrderedF
 // Function: ConnectivityGraphFactory::createField()
 //-----------------------------------------------------------------------------
 QSharedPointer<MemoryItem> ConnectivityGraphFactory::createField(QSharedPointer<const Field> field, 
-    QString const& registerIdentifier, int regAddress, int addressableUnitBits) const
+    QString const& registerIdentifier, quint64 regAddress, int addressableUnitBits) const
 {
     QString fieldIdentifier = registerIdentifier + "." + field->name();
-    int bitOffset = expressionParser_->parseExpression(field->getBitOffset()).toInt();
+    quint64 bitOffset = parseValue(field->getBitOffset());
 
     QSharedPointer<MemoryItem> fieldItem(new MemoryItem(field->name(), "field"));
     fieldItem->setIdentifier(fieldIdentifier);
     fieldItem->setDisplayName(field->displayName());
-    fieldItem->setAUB(QString::number(addressableUnitBits));
-    fieldItem->setWidth(expressionParser_->parseExpression(field->getBitWidth()));
-    fieldItem->setAddress(QString::number(regAddress + bitOffset/addressableUnitBits));
-    fieldItem->setOffset(QString::number(bitOffset));
+    fieldItem->setAUB(addressableUnitBits);
+    fieldItem->setAddress(regAddress + bitOffset / addressableUnitBits);
+    fieldItem->setOffset(bitOffset);
+
+    if (!field->getBitWidth().isEmpty())
+    {
+        fieldItem->setWidth(expressionParser_->parseExpression(field->getBitWidth()));
+    }
+
+    fieldItem->reserveChildren(field->getEnumeratedValues()->size() + field->getResets()->size());
 
     for (auto enumeratedValue : *field->getEnumeratedValues())
     {
@@ -473,7 +504,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createEnumeratedValueItem(
     QSharedPointer<MemoryItem> enumItem(new MemoryItem(enumName, MemoryDesignerConstants::ENUMERATED_VALUE_TYPE));
     enumItem->setIdentifier(enumeratedValueIdentifier);
     enumItem->setDisplayName(enumeratedValue->displayName());
-    enumItem->setAUB(QString::number(addressUnitBits));
+    enumItem->setAUB(addressUnitBits);
     enumItem->setValue(expressionParser_->parseExpression(enumeratedValue->getValue()));
 
     return enumItem;
@@ -495,7 +526,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createFieldResetItem(QShare
 
     QSharedPointer<MemoryItem> resetItem(new MemoryItem(resetType, MemoryDesignerConstants::RESET_TYPE));
     resetItem->setIdentifier(resetIdentifier);
-    resetItem->setAUB(QString::number(addressUnitBits));
+    resetItem->setAUB(addressUnitBits);
 
     QString resetValue = expressionParser_->parseExpression(fieldReset->getResetValue());
     qulonglong decimalResetValue = resetValue.toULongLong();
@@ -526,7 +557,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
     QSharedPointer<MemoryItem> resetItem(
         new MemoryItem(MemoryDesignerConstants::HARD_RESET_TYPE, MemoryDesignerConstants::RESET_TYPE));
     resetItem->setIdentifier(resetIdentifier);
-    resetItem->setAUB(QString::number(addressUnitBits));
+    resetItem->setAUB(addressUnitBits);
 
     QMapIterator<quint64, QSharedPointer<MemoryItem> > fieldIterator(fieldItems);
     quint64 currentEnd = 0;
@@ -537,7 +568,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
         quint64 fieldEnd = 0;
 
         QSharedPointer<MemoryItem> fieldItem = fieldIterator.value();
-        quint64 fieldWidth = fieldItem->getWidth().toInt();
+        quint64 fieldWidth = fieldItem->getWidthValue();
 
         if (fieldWidth > 0)
         {
@@ -546,7 +577,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
 
         if (currentEnd < fieldStart)
         {
-            for (int i = currentEnd; i < fieldStart; ++i )
+            for (quint64 i = currentEnd; i < fieldStart; ++i )
             {
                 resetValue.prepend("0");
                 resetMask.prepend("0");
@@ -567,7 +598,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
         }
         else
         {
-            for (int i = 0; i < fieldWidth; ++i)
+            for (quint64 i = 0; i < fieldWidth; ++i)
             {
                 resetValue.prepend("0");
                 resetMask.prepend("0");
@@ -576,7 +607,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
         currentEnd = fieldEnd + 1;
     }
 
-    quint64 registerSize = registerItem->getSize().toULongLong();
+    quint64 registerSize = registerItem->getSizeValue();
     resetValue = resetValue.rightJustified(registerSize, '0', true);
     resetMask = resetMask.rightJustified(registerSize, '0', true);
 
@@ -621,7 +652,7 @@ void ConnectivityGraphFactory::addMemoryRemapData(QSharedPointer<const MemoryMap
         QSharedPointer<MemoryItem> remapItem(new MemoryItem(remap->name(), "memoryRemap"));
         remapItem->setDisplayName(remap->displayName());
         remapItem->setIdentifier(remapIdentifier);
-        remapItem->setAUB(QString::number(addressableUnitBits));
+        remapItem->setAUB(addressableUnitBits);
 
         mapItem->addChild(remapItem);
 
@@ -1094,3 +1125,11 @@ void ConnectivityGraphFactory::createConnectionData(QString const& connectionNam
         graph->getConnections().append(connection);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraphFactory::parseValue()
+//-----------------------------------------------------------------------------
+quint64 ConnectivityGraphFactory::parseValue(QString const& expression) const
+{
+    return expressionParser_->parseExpression(expression).toULongLong();
+}
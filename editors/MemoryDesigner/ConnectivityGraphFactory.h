@@ -170,7 +170,7 @@ private:
      *      @param [in] blockIdentifier         Identifier for the containing address block.
      *      @param [in/out] blockItem           The address block to the add register into.
      */
-    void addRegisterData(QSharedPointer<const Register> reg, int baseAddress, int addressableUnitBits,
+    void addRegisterData(QSharedPointer<const Register> reg, quint64 baseAddress, int addressableUnitBits,
         QString const& blockIdentifier, QSharedPointer<MemoryItem> blockItem) const;
 
     /*!
@@ -195,7 +195,16 @@ private:
      *      @return Representation for the field.
      */
     QSharedPointer<MemoryItem> createField(QSharedPointer<const Field> field, QString const& registerIdentifier,
-        int regAddress, int addressableUnitBits) const;
+        quint64 regAddress, int addressableUnitBits) const;
+
+    /*!
+     *  Evaluates an expression into an unsigned 64-bit value.
+     *
+     *      @param [in] expression  The expression to evaluate.
+     *
+     *      @return The value of the expression, or zero if the expression is not a valid unsigned number.
+     */
+    quint64 parseValue(QString const& expression) const;
 
     /*!
      *  Creates a representation for an enumerated value within a field.
@@ -16,10 +16,39 @@
 #include <editors/MemoryDesigner/ConnectivityInterface.h>
 #include <editors/MemoryDesigner/MemoryItem.h>
 
+namespace
+{
+    //! A vertex in the current path of the path search.
+    struct PathSearchFrame
+    {
+        //! The vertex.
+        QSharedPointer<ConnectivityInterface const> vertex;
+
+        //! The connections of the vertex, excluding the connection traveled to the vertex.
+        QVector<QSharedPointer<ConnectivityConnection const> > connections;
+
+        //! Index of the next connection to examine.
+        int nextConnection = 0;
+
+        //! Flag for a connection continuing the path found from the vertex.
+        bool connectionFound = false;
+    };
+
+    //! A vertex in the suffix tree of the found paths.
+    struct PathSuffixNode
+    {
+        //! The nodes of the preceding vertices in the paths.
+        QHash<ConnectivityInterface const*, int> children;
+
+        //! Flag for a path ending in this node having been kept.
+        bool pathKept = false;
+    };
+}
+
 //-----------------------------------------------------------------------------
 // Function: MasterSlavePathSearch::MasterSlavePathSearch()
 //-----------------------------------------------------------------------------
-MasterSlavePathSearch::MasterSlavePathSearch(): masterPaths_()
+MasterSlavePathSearch::MasterSlavePathSearch(): masterPaths_(), vertexIndexes_(), verticesOnPath_()
 {
 
 }
@@ -53,10 +82,16 @@ QVector<QVector<QSharedPointer<ConnectivityInterface const> > > MasterSlavePathS
 {
     masterPaths_.clear();
 
+    vertexIndexes_.clear();
+    for (QSharedPointer<ConnectivityInterface> const& vertex : graph->getInterfaces())
+    {
+        getVertexIndex(vertex);
+    }
+    verticesOnPath_.fill(false, vertexIndexes_.size());
+
     foreach (QSharedPointer<ConnectivityInterface const> masterInterface, findInitialMasterInterfaces(graph))
     {
-        findPaths(masterInterface, QSharedPointer<ConnectivityConnection const>(),
-            QVector<QSharedPointer<ConnectivityInterface const> >(), graph);
+        findPaths(masterInterface, graph);
     }
 
     removeDuplicatePaths();
@@ -139,45 +174,89 @@ void MasterSlavePathSearch::findConnectedInterfaceNodes(QSharedPointer<Connectiv
 // Function: MasterSlavePathSearch::findPaths()
 //-----------------------------------------------------------------------------
 void MasterSlavePathSearch::findPaths(QSharedPointer<ConnectivityInterface const> startVertex,
-    QSharedPointer<ConnectivityConnection const> previousEdge,
-    QVector<QSharedPointer<ConnectivityInterface const> > existingPath,
     QSharedPointer<const ConnectivityGraph> graph)
 {
-    existingPath.append(startVertex);
+    QVector<QSharedPointer<ConnectivityInterface const> > currentPath;
+    QVector<PathSearchFrame> searchStack;
 
-    QVector<QSharedPointer<ConnectivityConnection const> > connections =
-        graph->getConnectionsFor(existingPath.last());
-
-    if (connections.contains(previousEdge))
+    auto enterVertex = [&](QSharedPointer<ConnectivityInterface const> vertex,
+        QSharedPointer<ConnectivityConnection const> previousEdge)
     {
-        connections.remove(connections.indexOf(previousEdge));
-    }
+        currentPath.append(vertex);
+        verticesOnPath_.setBit(getVertexIndex(vertex));
 
-    if (connections.isEmpty())
-    {
-        masterPaths_.append(existingPath);
-    }
-    else
-    {
-        bool connectionFound = false;
+        PathSearchFrame frame;
+        frame.vertex = vertex;
+        frame.connections = graph->getConnectionsFor(vertex);
+
+        int previousEdgeIndex = frame.connections.indexOf(previousEdge);
+        if (previousEdgeIndex != -1)
+        {
+            frame.connections.remove(previousEdgeIndex);
+        }
+
+        if (frame.connections.isEmpty())
+        {
+            masterPaths_.append(currentPath);
+        }
 
-        foreach (QSharedPointer<ConnectivityConnection const> nextEdge, connections)
+        searchStack.append(frame);
+    };
+
+    enterVertex(startVertex, QSharedPointer<ConnectivityConnection const>());
+
+    while (!searchStack.isEmpty())
+    {
+        PathSearchFrame& frame = searchStack.last();
+        if (frame.nextConnection < frame.connections.size())
         {
-            QSharedPointer<ConnectivityInterface const> endVertex = findConnectedInterface(startVertex, nextEdge);
-            if (!existingPath.contains(endVertex) && canConnectInterfaces(startVertex, endVertex))
+            QSharedPointer<ConnectivityConnection const> nextEdge = frame.connections.at(frame.nextConnection);
+            frame.nextConnection++;
+
+            QSharedPointer<ConnectivityInterface const> endVertex = findConnectedInterface(frame.vertex, nextEdge);
+            if (!verticesOnPath_.testBit(getVertexIndex(endVertex)) &&
+                canConnectInterfaces(frame.vertex, endVertex))
             {
-                findPaths(endVertex, nextEdge, existingPath, graph);
-                connectionFound = true;
+                frame.connectionFound = true;
+                enterVertex(endVertex, nextEdge);
             }
         }
-
-        if (!connectionFound && existingPath.size() > 1)
+        else
         {
-            masterPaths_.append(existingPath);
+            if (!frame.connections.isEmpty() && !frame.connectionFound && currentPath.size() > 1)
+            {
+                masterPaths_.append(currentPath);
+            }
+
+            verticesOnPath_.clearBit(getVertexIndex(frame.vertex));
+            currentPath.removeLast();
+            searchStack.removeLast();
         }
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MasterSlavePathSearch::getVertexIndex()
+//-----------------------------------------------------------------------------
+int MasterSlavePathSearch::getVertexIndex(QSharedPointer<ConnectivityInterface const> vertex)
+{
+    auto indexIterator = vertexIndexes_.constFind(vertex.data());
+    if (indexIterator != vertexIndexes_.cend())
+    {
+        return indexIterator.value();
+    }
+
+    int vertexIndex = vertexIndexes_.size();
+    vertexIndexes_.insert(vertex.data(), vertexIndex);
+
+    if (verticesOnPath_.size() <= vertexIndex)
+    {
+        verticesOnPath_.resize(vertexIndex + 1);
+    }
+
+    return vertexIndex;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MasterSlavePathSearch::findConnectedInterface()
 //-----------------------------------------------------------------------------
@@ -240,79 +319,47 @@ bool MasterSlavePathSearch::canConnectInterfaces(QSharedPointer<ConnectivityInte
 //-----------------------------------------------------------------------------
 void MasterSlavePathSearch::removeDuplicatePaths()
 {
-    QVector<QVector<QSharedPointer<ConnectivityInterface const> > > highPaths;
-
-    for (int currentIndex = 0; currentIndex < masterPaths_.size(); ++currentIndex)
-    {
-        QVector<QSharedPointer<ConnectivityInterface const> > currentPath = masterPaths_.at(currentIndex);
-        if (currentPath.size() > 1 && pathEndsInMemoryMap(currentPath) &&
-            pathIsFullPath(currentPath, currentIndex))
-        {
-            highPaths.append(currentPath);
-        }
-    }
-
-    masterPaths_.clear();
-    masterPaths_ = highPaths;
-}
+    QVector<PathSuffixNode> suffixTree(1);
+    QVector<int> pathEndNodes;
+    pathEndNodes.reserve(masterPaths_.size());
 
-//-----------------------------------------------------------------------------
-// Function: MasterSlavePathSearch::pathIsFullPath()
-//-----------------------------------------------------------------------------
-bool MasterSlavePathSearch::pathIsFullPath(
-    QVector<QSharedPointer<ConnectivityInterface const> > const& currentPath, int currentIndex)
-{
-    for (int comparisonIndex = currentIndex + 1; comparisonIndex < masterPaths_.size(); ++comparisonIndex)
+    for (QVector<QSharedPointer<ConnectivityInterface const> > const& currentPath : masterPaths_)
     {
-        QVector<QSharedPointer<ConnectivityInterface const> > comparisonPath =
-            masterPaths_.at(comparisonIndex);
-
-        if (currentPath.last() == comparisonPath.last())
+        int node = -1;
+        if (currentPath.size() > 1 && pathEndsInMemoryMap(currentPath))
         {
-            int pathLength = currentPath.size();
-            int comparisonPathLength = comparisonPath.size();
-
-            int examinationArea = pathLength;
-            if (comparisonPathLength < pathLength)
+            node = 0;
+            for (int pathIndex = currentPath.size() - 1; pathIndex >= 0; --pathIndex)
             {
-                examinationArea = comparisonPathLength;
-            }
+                ConnectivityInterface const* vertex = currentPath.at(pathIndex).data();
 
-            if (pathContainsAnotherPath(currentPath, comparisonPath, examinationArea))
-            {
-                if (examinationArea == comparisonPathLength)
-                {
-                    masterPaths_.remove(masterPaths_.indexOf(comparisonPath));
-                }
-                else
+                int childNode = suffixTree.at(node).children.value(vertex, -1);
+                if (childNode == -1)
                 {
-                    return false;
+                    childNode = suffixTree.size();
+                    suffixTree[node].children.insert(vertex, childNode);
+                    suffixTree.append(PathSuffixNode());
                 }
+
+                node = childNode;
             }
         }
-    }
 
-    return true;
-}
+        pathEndNodes.append(node);
+    }
 
-//-----------------------------------------------------------------------------
-// Function: MasterSlavePathSearch::pathContainsAnotherPath()
-//-----------------------------------------------------------------------------
-bool MasterSlavePathSearch::pathContainsAnotherPath(
-    QVector<QSharedPointer<ConnectivityInterface const> > const& pathOne,
-    QVector<QSharedPointer<ConnectivityInterface const> > const& pathTwo, int areaSize) const
-{
-    for (int areaIndex = 0; areaIndex < areaSize; areaIndex++)
+    QVector<QVector<QSharedPointer<ConnectivityInterface const> > > highPaths;
+    for (int currentIndex = 0; currentIndex < masterPaths_.size(); ++currentIndex)
     {
-        int pathOneIndex = pathOne.size() - 1 - areaIndex;
-        int pathTwoIndex = pathTwo.size() - 1 - areaIndex;
-        if (pathOne.at(pathOneIndex) != pathTwo.at(pathTwoIndex))
+        int node = pathEndNodes.at(currentIndex);
+        if (node != -1 && suffixTree.at(node).children.isEmpty() && !suffixTree.at(node).pathKept)
         {
-            return false;
+            suffixTree[node].pathKept = true;
+            highPaths.append(masterPaths_.at(currentIndex));
         }
     }
 
-    return true;
+    masterPaths_ = highPaths;
 }
 
 //-----------------------------------------------------------------------------
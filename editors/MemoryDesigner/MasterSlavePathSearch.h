@@ -12,6 +12,8 @@
 #ifndef MASTERSLAVEPATHSEARCH_H
 #define MASTERSLAVEPATHSEARCH_H
 
+#include <QBitArray>
+#include <QHash>
 #include <QSharedPointer>
 #include <QVector>
 
@@ -88,16 +90,24 @@ private:
     /*!
      *  Finds all the paths branching from the given start vertex.
      *
+     *  The search is done depth first without recursion. All the branches share the prefix of the current path
+     *  and the path is copied only when it is complete.
+     *
      *      @param [in] startVertex     The vertex to start the search from.
-     *      @param [in] previousEdge    The edge traveled to the starting vertex and to exclude from the search.
-     *      @param [in] existingPath    The traveled path to the start vertex.
      *      @param [in] graph           The connectivity graph to find the paths from.
      */
     void findPaths(QSharedPointer<ConnectivityInterface const> startVertex,
-        QSharedPointer<ConnectivityConnection const> previousEdge, 
-        QVector<QSharedPointer<ConnectivityInterface const> > existingPath,
         QSharedPointer<const ConnectivityGraph> graph);
 
+    /*!
+     *  Gets the index of the given vertex for the bitset of visited vertices.
+     *
+     *      @param [in] vertex  The selected vertex.
+     *
+     *      @return The index of the vertex.
+     */
+    int getVertexIndex(QSharedPointer<ConnectivityInterface const> vertex);
+
     /*!
      *  Find the interface connected to the selected interface.
      *
@@ -123,31 +133,11 @@ private:
 
     /*!
      *  Remove paths that are contained within other paths.
-     */
-    void removeDuplicatePaths();
-
-    /*!
-     *  Check if the selected path should be kept in the master paths.
      *
-     *      @param [in] currentPath     The selected path.
-     *      @param [in] currentIndex    Index of the current path.
-     *
-     *      @return True, if the path is a master path, otherwise false.
+     *  The paths are inserted backwards into a suffix tree. A path is contained within another path, if its
+     *  last vertex in the tree has children.
      */
-    bool pathIsFullPath(QVector<QSharedPointer<ConnectivityInterface const> > const& currentPath,
-        int currentIndex);
-
-    /*!
-     *  Check if a path contains another path.
-     *
-     *      @param [in] pathOne     The first selected path.
-     *      @param [in] pathTwo     The second selected path.
-     *      @param [in] areaSize    Size of the smaller path.
-     *
-     *      @return True, if another of the selected paths contains the other, false otherwise.
-     */
-    bool pathContainsAnotherPath(QVector<QSharedPointer<ConnectivityInterface const> > const& pathOne,
-        QVector<QSharedPointer<ConnectivityInterface const> > const& pathTwo, int areaSize) const;
+    void removeDuplicatePaths();
 
     /*!
      *  Check if the path ends in a memory map.
@@ -164,6 +154,12 @@ private:
 
     //! Connection paths from master interfaces.
     QVector<QVector<QSharedPointer<ConnectivityInterface const> > > masterPaths_;
+
+    //! Indexes of the vertices in the searched graph.
+    QHash<ConnectivityInterface const*, int> vertexIndexes_;
+
+    //! The vertices in the current search path.
+    QBitArray verticesOnPath_;
 };
 
 #endif // MASTERSLAVEPATHSEARCH_H
@@ -127,8 +127,8 @@ QPair<quint64, quint64> MemoryConnectionAddressCalculator::getMemoryMapAddressRa
         {
             if (blockItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
             {
-                quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
-                quint64 blockRange = blockItem->getRange().toULongLong();
+                quint64 blockBaseAddress = blockItem->getAddressValue();
+                quint64 blockRange = blockItem->getRangeValue();
                 quint64 blockEndPoint = blockBaseAddress + blockRange - 1;
 
                 if (firstBlock)
@@ -19,11 +19,14 @@ name_(name),
 displayName_(),
 type_(type),
 identifier_(),
-address_(),
-range_(),
-width_(),
-size_(),
-offset_(),
+aub_(0),
+address_(0),
+range_(0),
+width_(0),
+size_(0),
+offset_(0),
+numericValues_(0),
+invalidValues_(),
 childItems_(),
 usage_(General::USAGE_COUNT),
 value_(),
@@ -92,14 +95,31 @@ QString MemoryItem::getIdentifier() const
 // Function: MemoryItem::setAUB()
 //-----------------------------------------------------------------------------
 void MemoryItem::setAUB(QString const& aub)
+{
+    setNumericValue(AUB_VALUE, aub_, aub);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setAUB()
+//-----------------------------------------------------------------------------
+void MemoryItem::setAUB(quint64 aub)
 {
     aub_ = aub;
+    numericValues_ |= AUB_VALUE;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getAUB()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getAUB() const
+{
+    return numericValueToString(AUB_VALUE, aub_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getAUBValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getAUBValue() const
 {
     return aub_;
 }
@@ -108,14 +128,31 @@ QString MemoryItem::getAUB() const
 // Function: MemoryItem::setAddress()
 //-----------------------------------------------------------------------------
 void MemoryItem::setAddress(QString const& address)
+{
+    setNumericValue(ADDRESS_VALUE, address_, address);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setAddress()
+//-----------------------------------------------------------------------------
+void MemoryItem::setAddress(quint64 address)
 {
     address_ = address;
+    numericValues_ |= ADDRESS_VALUE;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getAddress()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getAddress() const
+{
+    return numericValueToString(ADDRESS_VALUE, address_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getAddressValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getAddressValue() const
 {
     return address_;
 }
@@ -124,14 +161,31 @@ QString MemoryItem::getAddress() const
 // Function: MemoryItem::setRange()
 //-----------------------------------------------------------------------------
 void MemoryItem::setRange(QString const& range)
+{
+    setNumericValue(RANGE_VALUE, range_, range);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setRange()
+//-----------------------------------------------------------------------------
+void MemoryItem::setRange(quint64 range)
 {
     range_ = range;
+    numericValues_ |= RANGE_VALUE;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getRange()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getRange() const
+{
+    return numericValueToString(RANGE_VALUE, range_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getRangeValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getRangeValue() const
 {
     return range_;
 }
@@ -140,14 +194,31 @@ QString MemoryItem::getRange() const
 // Function: MemoryItem::setWidth()
 //-----------------------------------------------------------------------------
 void MemoryItem::setWidth(QString const& width)
+{
+    setNumericValue(WIDTH_VALUE, width_, width);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setWidth()
+//-----------------------------------------------------------------------------
+void MemoryItem::setWidth(quint64 width)
 {
     width_ = width;
+    numericValues_ |= WIDTH_VALUE;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getWidth()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getWidth() const
+{
+    return numericValueToString(WIDTH_VALUE, width_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getWidthValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getWidthValue() const
 {
     return width_;
 }
@@ -156,14 +227,31 @@ QString MemoryItem::getWidth() const
 // Function: MemoryItem::setSize()
 //-----------------------------------------------------------------------------
 void MemoryItem::setSize(QString const& size)
+{
+    setNumericValue(SIZE_VALUE, size_, size);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setSize()
+//-----------------------------------------------------------------------------
+void MemoryItem::setSize(quint64 size)
 {
     size_ = size;
+    numericValues_ |= SIZE_VALUE;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getSize()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getSize() const
+{
+    return numericValueToString(SIZE_VALUE, size_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getSizeValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getSizeValue() const
 {
     return size_;
 }
@@ -172,14 +260,31 @@ QString MemoryItem::getSize() const
 // Function: MemoryItem::setOffset()
 //-----------------------------------------------------------------------------
 void MemoryItem::setOffset(QString const& offset)
+{
+    setNumericValue(OFFSET_VALUE, offset_, offset);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setOffset()
+//-----------------------------------------------------------------------------
+void MemoryItem::setOffset(quint64 offset)
 {
     offset_ = offset;
+    numericValues_ |= OFFSET_VALUE;
 }
 
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getOffset()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getOffset() const
+{
+    return numericValueToString(OFFSET_VALUE, offset_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getOffsetValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getOffsetValue() const
 {
     return offset_;
 }
@@ -192,10 +297,18 @@ void MemoryItem::addChild(QSharedPointer<MemoryItem> child)
     childItems_.append(child);
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::reserveChildren()
+//-----------------------------------------------------------------------------
+void MemoryItem::reserveChildren(int childCount)
+{
+    childItems_.reserve(childCount);
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::getChildItems()
 //-----------------------------------------------------------------------------
-QVector<QSharedPointer<MemoryItem> > MemoryItem::getChildItems() const
+QVector<QSharedPointer<MemoryItem> > const& MemoryItem::getChildItems() const
 {
     return childItems_;         
 }
@@ -279,3 +392,43 @@ void MemoryItem::setIsPresent(QString const& newIsPresent)
 {
     isPresent_ = newIsPresent;
 }
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setNumericValue()
+//-----------------------------------------------------------------------------
+void MemoryItem::setNumericValue(NumericValue flag, quint64& target, QString const& value)
+{
+    invalidValues_.remove(flag);
+
+    bool isNumber = false;
+    quint64 number = value.toULongLong(&isNumber);
+
+    if (isNumber)
+    {
+        target = number;
+        numericValues_ |= flag;
+    }
+    else
+    {
+        target = 0;
+        numericValues_ &= ~flag;
+
+        if (!value.isEmpty())
+        {
+            invalidValues_.insert(flag, value);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::numericValueToString()
+//-----------------------------------------------------------------------------
+QString MemoryItem::numericValueToString(NumericValue flag, quint64 value) const
+{
+    if ((numericValues_ & flag) == 0)
+    {
+        return invalidValues_.value(flag);
+    }
+
+    return QString::number(value);
+}
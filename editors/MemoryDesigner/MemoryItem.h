@@ -14,12 +14,17 @@
 
 #include <IPXACTmodels/generaldeclarations.h>
 
+#include <QMap>
 #include <QString>
 #include <QSharedPointer>
 #include <QVector>
 
 //-----------------------------------------------------------------------------
 //! A memory in a connectivity graph.
+//
+// The addresses and sizes are stored as evaluated 64-bit values. The string accessors are kept for presenting
+// the values and return an empty string for values that have not been set. A value given as a string that is
+// not a valid number is left unset and presented as it was given.
 //-----------------------------------------------------------------------------
 class MemoryItem 
 {
@@ -94,6 +99,20 @@ public:
      */
     void setAUB(QString const& aub);
 
+    /*!
+     *  Sets the number of addressable unit bits in the memory.
+     *
+     *      @param [in] aub   The number of bits in an addressable unit.
+     */
+    void setAUB(quint64 aub);
+
+    /*!
+     *  Gets the number of addressable unit bits in the memory as a number.
+     *
+     *      @return The number addressable unit bits in the memory, or zero if not set.
+     */
+    quint64 getAUBValue() const;
+
     /*!
      *  Sets the address for the memory.
      *
@@ -108,6 +127,20 @@ public:
      */
     QString getAddress() const;
 
+    /*!
+     *  Sets the address for the memory.
+     *
+     *      @param [in] address   The memory address to set.
+     */
+    void setAddress(quint64 address);
+
+    /*!
+     *  Gets the memory address as a number.
+     *
+     *      @return The address for the memory, or zero if not set.
+     */
+    quint64 getAddressValue() const;
+
     /*!
      * Sets the range for the memory.
      *
@@ -122,6 +155,20 @@ public:
      */
     QString getRange() const;
 
+    /*!
+     *  Sets the range for the memory.
+     *
+     *      @param [in] range   The range to set.
+     */
+    void setRange(quint64 range);
+
+    /*!
+     *  Gets the range for the memory as a number.
+     *
+     *      @return The range for the memory, or zero if not set.
+     */
+    quint64 getRangeValue() const;
+
     /*!
      *  Sets the width for the memory.
      *
@@ -136,6 +183,20 @@ public:
      */
     QString getWidth() const;
 
+    /*!
+     *  Sets the width for the memory.
+     *
+     *      @param [in] width   The memory width to set.
+     */
+    void setWidth(quint64 width);
+
+    /*!
+     *  Gets the memory width in bits as a number.
+     *
+     *      @return The width of the memory, or zero if not set.
+     */
+    quint64 getWidthValue() const;
+
     /*!
      *  Sets the size for the memory.
      *
@@ -150,6 +211,20 @@ public:
      */
     QString getSize() const;
 
+    /*!
+     *  Sets the size for the memory.
+     *
+     *      @param [in] size    The size to set.
+     */
+    void setSize(quint64 size);
+
+    /*!
+     *  Gets the size for the memory as a number.
+     *
+     *      @return The memory size, or zero if not set.
+     */
+    quint64 getSizeValue() const;
+
     /*!
      *  Sets the offset for the memory.
      *
@@ -164,6 +239,20 @@ public:
      */
     QString getOffset() const;
 
+    /*!
+     *  Sets the offset for the memory.
+     *
+     *      @param [in] offset   The offset to set.
+     */
+    void setOffset(quint64 offset);
+
+    /*!
+     *  Gets the offset for the memory as a number.
+     *
+     *      @return The memory offset, or zero if not set.
+     */
+    quint64 getOffsetValue() const;
+
     /*!
      *  Adds a sub-element for the memory.
      *
@@ -171,12 +260,19 @@ public:
      */
     void addChild(QSharedPointer<MemoryItem> child);
 
+    /*!
+     *  Reserves space for the sub-elements of the memory.
+     *
+     *      @param [in] childCount  The expected number of sub-elements.
+     */
+    void reserveChildren(int childCount);
+
     /*!
      *  Gets the sub-elements for the memory.
      *
      *      @return The sub-elements for the memory.
      */
-    QVector<QSharedPointer<MemoryItem> > getChildItems() const;
+    QVector<QSharedPointer<MemoryItem> > const& getChildItems() const;
 
     /*!
      *  Set the usage for the memory item.
@@ -254,6 +350,38 @@ private:
 	MemoryItem(MemoryItem const& rhs);
 	MemoryItem& operator=(MemoryItem const& rhs);
 
+    //! Flags for the numeric values that have been set.
+    enum NumericValue
+    {
+        AUB_VALUE = 0x01,
+        ADDRESS_VALUE = 0x02,
+        RANGE_VALUE = 0x04,
+        WIDTH_VALUE = 0x08,
+        SIZE_VALUE = 0x10,
+        OFFSET_VALUE = 0x20
+    };
+
+    /*!
+     *  Sets a numeric value from its string presentation.
+     *
+     *      @param [in] flag        The flag of the value.
+     *      @param [out] target     The value to set.
+     *      @param [in] value       The string presentation of the value. Empty string clears the value and
+     *                              a string that is not a valid number leaves the value unset.
+     */
+    void setNumericValue(NumericValue flag, quint64& target, QString const& value);
+
+    /*!
+     *  Gets the string presentation of a numeric value.
+     *
+     *      @param [in] flag    The flag of the value.
+     *      @param [in] value   The value.
+     *
+     *      @return The value as a decimal string, the given string if it was not a valid number, or an empty
+     *              string if the value has not been set.
+     */
+    QString numericValueToString(NumericValue flag, quint64 value) const;
+
     //! The name of the memory element.
     QString name_;
 
@@ -267,22 +395,28 @@ private:
     QString identifier_;
 
     //! The number of addressable unit bits in the memory.
-    QString aub_;
+    quint64 aub_;
 
     //! The address for the memory.
-    QString address_;
+    quint64 address_;
 
     //! The range for the memory.
-    QString range_;
+    quint64 range_;
 
     //! The bit width for the memory.
-    QString width_;
+    quint64 width_;
 
     //! The size of the memory.
-    QString size_;
+    quint64 size_;
 
     //! The offset of the memory.
-    QString offset_;
+    quint64 offset_;
+
+    //! The numeric values that have been set, as a combination of NumericValue flags.
+    int numericValues_;
+
+    //! The given strings of the values that were not valid numbers, by their NumericValue flags.
+    QMap<int, QString> invalidValues_;
 
     QString value_;
 
@@ -109,8 +109,8 @@ void MemoryMapGraphicsItem::setupSubItems(qreal blockXPosition, QSharedPointer<M
         {
             if (subItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
             {
-                quint64 blockBaseAddress = subItem->getAddress().toULongLong();
-                quint64 blockRange = subItem->getRange().toULongLong();
+                quint64 blockBaseAddress = subItem->getAddressValue();
+                quint64 blockRange = subItem->getRangeValue();
 
                 FilteredBlock blockItem;
                 blockItem.blockName_ = subItem->getName();
@@ -242,30 +242,25 @@ MemoryDesignerChildGraphicsItem* MemoryMapGraphicsItem::createEmptySubItem(quint
 {
     QSharedPointer<MemoryItem> emptyItem;
 
-    QString emptyBaseAddress = QString::number(beginAddress);
-
     if (!filterAddressBlocks_)
     {
-        QString emptyBlockRange = QString::number(rangeEnd - beginAddress + 1);
-
         emptyItem = QSharedPointer<MemoryItem>(
             new MemoryItem(MemoryDesignerConstants::RESERVED_NAME, MemoryDesignerConstants::ADDRESSBLOCK_TYPE));
-        emptyItem->setAddress(emptyBaseAddress);
-        emptyItem->setRange(emptyBlockRange);
+        emptyItem->setAddress(beginAddress);
+        emptyItem->setRange(rangeEnd - beginAddress + 1);
         emptyItem->setAUB(addressUnitBits_);
     }
     else if (!filterRegisters_)
     {
         quint64 emptyRegisterRangeInt = rangeEnd - beginAddress + 1;
-        QString emptyRegisterRange = QString::number(emptyRegisterRangeInt);
 
         unsigned int intAUB = addressUnitBits_.toInt();
         quint64 registerSize = emptyRegisterRangeInt * intAUB;
 
         emptyItem = QSharedPointer<MemoryItem>(
             new MemoryItem(MemoryDesignerConstants::RESERVED_NAME, MemoryDesignerConstants::REGISTER_TYPE));
-        emptyItem->setAddress(emptyBaseAddress);
-        emptyItem->setSize(QString::number(registerSize));
+        emptyItem->setAddress(beginAddress);
+        emptyItem->setSize(registerSize);
         emptyItem->setAUB(addressUnitBits_);
     }
 
@@ -11,6 +11,8 @@
 
 #include "DocumentFileAccess.h"
 
+#include "DocumentStreamReader.h"
+
 #include <IPXACTmodels/common/VLNV.h>
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
@@ -53,7 +55,8 @@
 // Function: DocumentFileAccess::DocumentFileAccess()
 //-----------------------------------------------------------------------------
 DocumentFileAccess::DocumentFileAccess(MessageMediator* messageChannel) :
-    messageChannel_(messageChannel)
+    messageChannel_(messageChannel),
+    estimatedModelSize_(0)
 {
 
 }
@@ -63,20 +66,36 @@ DocumentFileAccess::DocumentFileAccess(MessageMediator* messageChannel) :
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 {
-    // Create file handle and use it to read the IP-XACT document into memory.
+    estimatedModelSize_ = 0;
+
+    // Create file handle and use it to stream the IP-XACT document into memory.
     QFile file(path);
-    file.open(QIODevice::ReadOnly);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        messageChannel_->showError(QObject::tr("Could not open file %1 for reading.").arg(path));
+        return QSharedPointer<Document>();
+    }
+
+    DocumentStreamReader documentReader(&file);
+
+    // Files of unknown type are rejected as soon as the root element has been read.
+    VLNV::IPXactType toCreate = documentReader.readDocumentType();
+    if (toCreate == VLNV::INVALID && !documentReader.hasError())
+    {
+        messageChannel_->showMessage(QObject::tr("File '%1' was not supported type").arg(path));
+        return QSharedPointer<Document>();
+    }
 
-    QDomDocument doc;
-    if (!doc.setContent(&file))
+    if (!documentReader.readDocument())
     {
-        file.close();
-        messageChannel_->showError(QObject::tr("Could not open file %1 for reading.").arg(path));        
+        messageChannel_->showError(QObject::tr("Could not open file %1 for reading. %2").arg(path,
+            documentReader.errorString()));
         return QSharedPointer<Document>();
     }
     file.close();
 
-    VLNV::IPXactType toCreate = VLNV::string2Type(doc.documentElement().nodeName());
+    estimatedModelSize_ = documentReader.getEstimatedModelSize();
+    QDomDocument doc = documentReader.getDocument();
 
     // Create correct type of object.
     if (toCreate == VLNV::ABSTRACTIONDEFINITION)
@@ -97,7 +116,9 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
     else if (toCreate == VLNV::COMPONENT)
     {
         ComponentReader reader;
-        return reader.createComponentFrom(doc);
+        QSharedPointer<Component> component = reader.createComponentFrom(doc);
+        documentReader.addStreamedItems(component);
+        return component;
     }
     else if (toCreate == VLNV::DESIGN)
     {
@@ -207,3 +228,11 @@ bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString c
     targetFile.close();
     return true;
 }
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::getEstimatedModelSize()
+//-----------------------------------------------------------------------------
+qint64 DocumentFileAccess::getEstimatedModelSize() const
+{
+    return estimatedModelSize_;
+}
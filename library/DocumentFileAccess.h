@@ -41,11 +41,17 @@ public:
 
     //! Writes to document model to the given path.
     bool writeDocument(QSharedPointer<Document> model, QString const& path);
+
+    //! Gets the estimated memory use of the latest read document in bytes.
+    qint64 getEstimatedModelSize() const;
     
 private:
 
     //! Channel for messages concerning file access.
     MessageMediator* messageChannel_;
+
+    //! The estimated memory use of the latest read document.
+    qint64 estimatedModelSize_;
 };
 
 #endif // DOCUMENTFILEACCESS_H
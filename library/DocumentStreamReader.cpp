@@ -0,0 +1,251 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Incremental reader for an IP-XACT document from a stream.
+//-----------------------------------------------------------------------------
+
+#include "DocumentStreamReader.h"
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/MemoryMapStreamReader.h>
+#include <IPXACTmodels/Component/Model.h>
+#include <IPXACTmodels/Component/PortStreamReader.h>
+
+#include <QObject>
+
+namespace
+{
+    //! Approximate memory used by the model object, shared pointer and container entry of an element.
+    const qint64 ELEMENT_MODEL_SIZE = 128;
+
+    //! Approximate memory used by the string and container entry of an attribute or a text.
+    const qint64 VALUE_MODEL_SIZE = 32;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::DocumentStreamReader()
+//-----------------------------------------------------------------------------
+DocumentStreamReader::DocumentStreamReader(QIODevice* device) :
+    reader_(device),
+    document_(),
+    currentNode_(document_),
+    rootElement_(),
+    estimatedModelSize_(0),
+    memoryMaps_(),
+    ports_()
+{
+    // Namespace declarations are kept as attributes and element names as written, as in the DOM reading.
+    reader_.setNamespaceProcessing(false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readDocumentType()
+//-----------------------------------------------------------------------------
+VLNV::IPXactType DocumentStreamReader::readDocumentType()
+{
+    while (rootElement_.isNull() && reader_.atEnd() == false)
+    {
+        reader_.readNext();
+        processToken();
+    }
+
+    if (rootElement_.isNull() || reader_.hasError())
+    {
+        return VLNV::INVALID;
+    }
+
+    return VLNV::string2Type(rootElement_.nodeName());
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readDocument()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::readDocument()
+{
+    while (reader_.atEnd() == false)
+    {
+        reader_.readNext();
+        processToken();
+    }
+
+    return reader_.hasError() == false && rootElement_.isNull() == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::getDocument()
+//-----------------------------------------------------------------------------
+QDomDocument DocumentStreamReader::getDocument() const
+{
+    return document_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::addStreamedItems()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::addStreamedItems(QSharedPointer<Component> component) const
+{
+    component->getMemoryMaps()->append(memoryMaps_);
+
+    if (component->getModel())
+    {
+        component->getModel()->getPorts()->append(ports_);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::hasError()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::hasError() const
+{
+    return reader_.hasError();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::errorString()
+//-----------------------------------------------------------------------------
+QString DocumentStreamReader::errorString() const
+{
+    if (reader_.hasError() == false && rootElement_.isNull())
+    {
+        return QObject::tr("No root element found.");
+    }
+
+    return QObject::tr("%1 on line %2, column %3.").arg(reader_.errorString()).arg(reader_.lineNumber()).arg(
+        reader_.columnNumber());
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::getEstimatedModelSize()
+//-----------------------------------------------------------------------------
+qint64 DocumentStreamReader::getEstimatedModelSize() const
+{
+    return estimatedModelSize_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::processToken()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::processToken()
+{
+    QXmlStreamReader::TokenType token = reader_.tokenType();
+
+    if (token == QXmlStreamReader::StartElement)
+    {
+        if (readStreamedItem())
+        {
+            return;
+        }
+
+        QDomElement element = document_.createElement(reader_.qualifiedName().toString());
+        estimatedModelSize_ += ELEMENT_MODEL_SIZE;
+        for (QXmlStreamAttribute const& attribute : reader_.attributes())
+        {
+            element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+            estimatedModelSize_ += VALUE_MODEL_SIZE + attribute.value().size() * qint64(sizeof(QChar));
+        }
+
+        currentNode_.appendChild(element);
+        currentNode_ = element;
+
+        if (rootElement_.isNull())
+        {
+            rootElement_ = element;
+        }
+    }
+    else if (token == QXmlStreamReader::EndElement)
+    {
+        currentNode_ = currentNode_.parentNode();
+    }
+    else if (token == QXmlStreamReader::Characters)
+    {
+        appendText();
+    }
+    else if (token == QXmlStreamReader::Comment)
+    {
+        currentNode_.appendChild(document_.createComment(reader_.text().toString()));
+    }
+    else if (token == QXmlStreamReader::ProcessingInstruction)
+    {
+        currentNode_.appendChild(document_.createProcessingInstruction(
+            reader_.processingInstructionTarget().toString(), reader_.processingInstructionData().toString()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readStreamedItem()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::readStreamedItem()
+{
+    if (rootElement_.isNull() || rootElement_.nodeName() != QLatin1String("ipxact:component") ||
+        currentNode_.parentNode().isNull())
+    {
+        return false;
+    }
+
+    // The items are read from the same places as in ComponentReader.
+    QDomNode parentNode = currentNode_.parentNode();
+    QStringRef elementName = reader_.qualifiedName();
+
+    if (elementName == QLatin1String("ipxact:memoryMap") &&
+        currentNode_.nodeName() == QLatin1String("ipxact:memoryMaps") && parentNode == rootElement_)
+    {
+        MemoryMapStreamReader memoryMapReader;
+        memoryMaps_.append(memoryMapReader.createMemoryMapFrom(reader_));
+        estimatedModelSize_ += ELEMENT_MODEL_SIZE + memoryMapReader.getEstimatedModelSize();
+        return true;
+    }
+    else if (elementName == QLatin1String("ipxact:port") &&
+        currentNode_.nodeName() == QLatin1String("ipxact:ports") &&
+        parentNode.nodeName() == QLatin1String("ipxact:model") && parentNode.parentNode() == rootElement_)
+    {
+        PortStreamReader portReader;
+        ports_.append(portReader.createPortFrom(reader_));
+        estimatedModelSize_ += ELEMENT_MODEL_SIZE + portReader.getEstimatedModelSize();
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::appendText()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::appendText()
+{
+    // Text outside the root element is not part of the document.
+    if (currentNode_ == document_)
+    {
+        return;
+    }
+
+    if (reader_.isCDATA())
+    {
+        currentNode_.appendChild(document_.createCDATASection(reader_.text().toString()));
+        return;
+    }
+
+    // Whitespace between elements is dropped, like in QDomDocument::setContent().
+    if (reader_.isWhitespace())
+    {
+        return;
+    }
+
+    estimatedModelSize_ += VALUE_MODEL_SIZE + reader_.text().size() * qint64(sizeof(QChar));
+
+    // The stream may deliver the text of a single node in several parts e.g. around entity references.
+    QDomNode previousNode = currentNode_.lastChild();
+    if (previousNode.isText() && previousNode.isCDATASection() == false)
+    {
+        previousNode.toText().appendData(reader_.text().toString());
+    }
+    else
+    {
+        currentNode_.appendChild(document_.createTextNode(reader_.text().toString()));
+    }
+}
@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Incremental reader for an IP-XACT document from a stream.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTSTREAMREADER_H
+#define DOCUMENTSTREAMREADER_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QDomDocument>
+#include <QDomNode>
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+#include <QXmlStreamReader>
+
+class Component;
+class MemoryMap;
+class Port;
+class QIODevice;
+
+//-----------------------------------------------------------------------------
+//! Incremental reader for an IP-XACT document from a stream.
+//
+// The device is read in chunks with QXmlStreamReader instead of first buffering the whole file for
+// QDomDocument::setContent(). The memory maps and ports of a component, which make up the bulk of large
+// components, are created directly from the stream with MemoryMapStreamReader and PortStreamReader. The rest
+// of the document is built into a DOM that is identical to the one created by setContent() without namespace
+// processing, except for the XML declaration that the document readers ignore.
+//-----------------------------------------------------------------------------
+class DocumentStreamReader
+{
+public:
+
+    /*! The constructor.
+     *
+     *      @param [in] device  The opened device to read the document from.
+     */
+    explicit DocumentStreamReader(QIODevice* device);
+
+    //! The destructor.
+    ~DocumentStreamReader() = default;
+
+    //! Disable copying.
+    DocumentStreamReader(DocumentStreamReader const& rhs) = delete;
+    DocumentStreamReader& operator=(DocumentStreamReader const& rhs) = delete;
+
+    /*! Reads the document until the start of the root element to find out the document type.
+     *
+     *  Files of unknown type can be discarded without reading them further.
+     *
+     *      @return The type of the document, or INVALID if the root element could not be read.
+     */
+    VLNV::IPXactType readDocumentType();
+
+    /*! Reads the rest of the document.
+     *
+     *      @return True, if the document was read without errors, otherwise false.
+     */
+    bool readDocument();
+
+    /*! Gets the document read so far.
+     *
+     *  The memory maps and ports of a component are not included in the DOM.
+     *
+     *      @return The DOM of the document.
+     */
+    QDomDocument getDocument() const;
+
+    /*! Adds the memory maps and ports created from the stream into a component created from the DOM.
+     *
+     *      @param [in] component   The component created from the document.
+     */
+    void addStreamedItems(QSharedPointer<Component> component) const;
+
+    /*! Checks if the reading has failed.
+     *
+     *      @return True, if the document is not well-formed, otherwise false.
+     */
+    bool hasError() const;
+
+    /*! Gets the description of the reading error.
+     *
+     *      @return The error description with the line number.
+     */
+    QString errorString() const;
+
+    /*! Gets an estimate of the memory used by the models created from the document read so far.
+     *
+     *  The markup is not kept in the models, so the estimate is counted from the elements and attributes
+     *  and from the text stored in UTF-16.
+     *
+     *      @return The estimated size in bytes.
+     */
+    qint64 getEstimatedModelSize() const;
+
+private:
+
+    //! Adds the current token of the stream into the DOM.
+    void processToken();
+
+    /*! Creates an item from the current element, if the element is read directly from the stream.
+     *
+     *      @return True, if the element was read, otherwise false.
+     */
+    bool readStreamedItem();
+
+    //! Adds the text of the current token into the current node.
+    void appendText();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The reader for the stream.
+    QXmlStreamReader reader_;
+
+    //! The document being built.
+    QDomDocument document_;
+
+    //! The node receiving the next children.
+    QDomNode currentNode_;
+
+    //! The root element of the document, if already found.
+    QDomElement rootElement_;
+
+    //! The estimated size of the models created from the document.
+    qint64 estimatedModelSize_;
+
+    //! The memory maps of a component created from the stream.
+    QList<QSharedPointer<MemoryMap> > memoryMaps_;
+
+    //! The ports of a component created from the stream.
+    QList<QSharedPointer<Port> > ports_;
+};
+
+#endif // DOCUMENTSTREAMREADER_H
@@ -20,10 +20,91 @@
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
 #include <IPXACTmodels/BusDefinition/BusDefinition.h>
 #include <IPXACTmodels/Catalog/Catalog.h>
+#include <IPXACTmodels/Component/AbstractionType.h>
+#include <IPXACTmodels/Component/BusInterface.h>
 #include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
 #include <IPXACTmodels/Design/Design.h>
 #include <IPXACTmodels/designConfiguration/DesignConfiguration.h>
 
+#include <QThread>
+#include <QtConcurrent>
+
+namespace
+{
+    //! Number of component elements above which the element groups are validated in parallel.
+    const int PARALLEL_VALIDATION_THRESHOLD = 512;
+
+    //-----------------------------------------------------------------------------
+    // Function: countElements()
+    //-----------------------------------------------------------------------------
+    int countElements(QSharedPointer<Component> component)
+    {
+        int count = component->getBusInterfaces()->size() + component->getPorts()->size() +
+            component->getViews()->size() + component->getFileSets()->size() +
+            component->getParameters()->size();
+
+        for (QSharedPointer<MemoryMap> const& memoryMap : *component->getMemoryMaps())
+        {
+            count += memoryMap->getMemoryBlocks()->size();
+        }
+
+        return count;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: loadReferencedDefinitions()
+    //-----------------------------------------------------------------------------
+    QList<QSharedPointer<Document const> > loadReferencedDefinitions(QSharedPointer<Component> component,
+        LibraryInterface* library)
+    {
+        // The library reports read errors through the message channel, which only the calling thread may use.
+        // Reading the referenced definitions here lets the validation tasks find them in the library cache.
+        QList<QSharedPointer<Document const> > definitions;
+        for (QSharedPointer<BusInterface> const& busInterface : *component->getBusInterfaces())
+        {
+            definitions.append(library->getModelReadOnly(busInterface->getBusType()));
+
+            for (QSharedPointer<AbstractionType> const& abstraction : *busInterface->getAbstractionTypes())
+            {
+                if (abstraction->getAbstractionRef())
+                {
+                    definitions.append(library->getModelReadOnly(*abstraction->getAbstractionRef()));
+                }
+            }
+        }
+
+        return definitions;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Finds the errors in a group of component elements.
+    //
+    // The expression parsers and parameter finders cache their results, so every task creates its own.
+    //-----------------------------------------------------------------------------
+    struct ComponentGroupValidator
+    {
+        using result_type = QVector<QString>;
+
+        //! The library used in the validation.
+        LibraryInterface* library = nullptr;
+
+        //! The validated component. Only read during the validation.
+        QSharedPointer<Component> component;
+
+        QVector<QString> operator()(int group) const
+        {
+            QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(component));
+            ComponentValidator validator(QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(finder)),
+                library);
+
+            QVector<QString> errors;
+            validator.findErrorsIn(errors, component, static_cast<ComponentValidator::ElementGroup>(group));
+            return errors;
+        }
+    };
+}
+
 //-----------------------------------------------------------------------------
 // Function: DocumentValidator::DocumentValidator()
 //-----------------------------------------------------------------------------
@@ -160,6 +241,32 @@ void DocumentValidator::findErrorsInAbstractionDefinition(QSharedPointer<Abstrac
 //-----------------------------------------------------------------------------
 void DocumentValidator::findErrorsInComponent(QSharedPointer<Component> component, QVector<QString>& errorList)
 {
+    if (QThread::idealThreadCount() > 1 && countElements(component) >= PARALLEL_VALIDATION_THRESHOLD)
+    {
+        QList<int> groups;
+        for (int group = ComponentValidator::INTERFACE_ELEMENTS; group < ComponentValidator::ELEMENT_GROUP_COUNT;
+            ++group)
+        {
+            groups.append(group);
+        }
+
+        // The definitions are held until the validation ends, so that the cache cannot evict them meanwhile.
+        QList<QSharedPointer<Document const> > const definitions = loadReferencedDefinitions(component, library_);
+
+        ComponentGroupValidator groupValidator;
+        groupValidator.library = library_;
+        groupValidator.component = component;
+
+        // Errors are merged in the group order, which is the same as in sequential validation.
+        QFuture<QVector<QString> > validation = QtConcurrent::mapped(groups, groupValidator);
+        for (int i = 0; i < groups.size(); ++i)
+        {
+            errorList.append(validation.resultAt(i));
+        }
+
+        return;
+    }
+
     changeComponentValidatorParameterFinder(component);
 
     componentValidator_.findErrorsIn(errorList, component);
@@ -30,7 +30,8 @@ HierarchyItem::HierarchyItem(LibraryInterface* handler, HierarchyItem* parent,
     VLNV const& vlnv, KactusAttribute::Implementation implementation, QString const& viewName):
 QObject(parent),
     vlnv_(vlnv),
-    component_(),    
+    implementation_(KactusAttribute::KTS_IMPLEMENTATION_COUNT),
+    isHierarchical_(false),
     library_(handler),
     childItems_(),
     parentItem_(parent),
@@ -92,7 +93,8 @@ QObject(parent),
 HierarchyItem::HierarchyItem(LibraryInterface* handler, QObject* parent ):
 QObject(parent),
     vlnv_(),
-    component_(),
+    implementation_(KactusAttribute::KTS_IMPLEMENTATION_COUNT),
+    isHierarchical_(false),
     library_(handler),
     childItems_(),
     parentItem_(NULL),
@@ -227,7 +229,7 @@ bool HierarchyItem::contains(VLNV const& vlnv) const
 void HierarchyItem::cleanUp()
 {
 	// make sure this is called only for root item
-	Q_ASSERT_X(!component_, "HierarchyItem::cleanUp", "Function was called for non-root item");
+	Q_ASSERT_X(type_ != HierarchyItem::COMPONENT, "HierarchyItem::cleanUp", "Function was called for non-root item");
 
 	for (auto item = childItems_.begin(); item != childItems_.end(); ++item)
     {
@@ -251,7 +253,13 @@ void HierarchyItem::cleanUp()
 //-----------------------------------------------------------------------------
 QSharedPointer<Component const> HierarchyItem::component() const
 {
-	return component_;
+    if (type_ != HierarchyItem::COMPONENT)
+    {
+        return QSharedPointer<Component const>();
+    }
+
+    // The model is not kept in the item so that the library may evict it from its cache.
+	return library_->getModelReadOnly<Component>(vlnv_);
 }
 
 //-----------------------------------------------------------------------------
@@ -474,16 +482,8 @@ void HierarchyItem::clear()
 //-----------------------------------------------------------------------------
 bool HierarchyItem::isHierarchical() const
 {
-	Q_ASSERT(component_);
-
-    if (component_->getImplementation() == KactusAttribute::SW)
-    {
-        return component_->hasViews();
-    }
-    else
-    {
-	    return component_->isHierarchical();
-    }
+	Q_ASSERT(type_ == HierarchyItem::COMPONENT);
+    return isHierarchical_;
 }
 
 //-----------------------------------------------------------------------------
@@ -491,8 +491,8 @@ bool HierarchyItem::isHierarchical() const
 //-----------------------------------------------------------------------------
 KactusAttribute::Implementation HierarchyItem::getImplementation() const
 {
-    Q_ASSERT(component_);
-    return component_->getImplementation();
+    Q_ASSERT(type_ == HierarchyItem::COMPONENT);
+    return implementation_;
 }
 
 //-----------------------------------------------------------------------------
@@ -509,7 +509,8 @@ HierarchyItem::ObjectType HierarchyItem::type() const
 void HierarchyItem::getChildren(QList<VLNV>& childList, VLNV const& owner) const
 {
 	// make sure this is called only for root item
-	Q_ASSERT_X(!component_, "HierarchyItem::getChildren", "Function was called for non-root item");
+	Q_ASSERT_X(type_ != HierarchyItem::COMPONENT, "HierarchyItem::getChildren",
+        "Function was called for non-root item");
 
 	// search each child item
 	for (HierarchyItem const* item : childItems_)
@@ -589,16 +590,27 @@ bool HierarchyItem::hasChild(VLNV const& vlnv)
 void HierarchyItem::parseComponent(VLNV const& vlnv)
 {
     type_ = HierarchyItem::COMPONENT;
-    component_ = library_->getModelReadOnly<Component>(vlnv);
-    Q_ASSERT(component_);
+    QSharedPointer<Component const> component = library_->getModelReadOnly<Component>(vlnv);
+    Q_ASSERT(component);
 
     isValid_ = library_->isValid(vlnv);
 
-    for (QSharedPointer<View> view : *component_->getViews())
+    // Only the attributes needed by the view are stored, the model is read again when needed.
+    implementation_ = component->getImplementation();
+    if (implementation_ == KactusAttribute::SW)
+    {
+        isHierarchical_ = component->hasViews();
+    }
+    else
+    {
+        isHierarchical_ = component->isHierarchical();
+    }
+
+    for (QSharedPointer<View> view : *component->getViews())
     {
         if (view->isHierarchical())
         {
-            VLNV designVLNV = findDesignReference(view);
+            VLNV designVLNV = findDesignReference(component, view);
             createChildItemForDesign(designVLNV, view->name());
         }
     }
@@ -642,13 +654,13 @@ void HierarchyItem::parseCatalog(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::findDesignReference()
 //-----------------------------------------------------------------------------
-VLNV HierarchyItem::findDesignReference(QSharedPointer<View> view)
+VLNV HierarchyItem::findDesignReference(QSharedPointer<Component const> component, QSharedPointer<View> view)
 {
     if (!view->getDesignInstantiationRef().isEmpty())
     {
         QString viewDesign = view->getDesignInstantiationRef();
 
-        for (QSharedPointer<DesignInstantiation> instantiation : *component_->getDesignInstantiations())
+        for (QSharedPointer<DesignInstantiation> instantiation : *component->getDesignInstantiations())
         {
             if (instantiation->name() == viewDesign)
             {
@@ -661,7 +673,7 @@ VLNV HierarchyItem::findDesignReference(QSharedPointer<View> view)
         QString viewConfiguration = view->getDesignConfigurationInstantiationRef();
 
         for (QSharedPointer<DesignConfigurationInstantiation> instantiation : 
-            *component_->getDesignConfigurationInstantiations())
+            *component->getDesignConfigurationInstantiations())
         {
             if (instantiation->name() == viewConfiguration)
             {
@@ -362,11 +362,12 @@ private:
     /*!
      *  Finds the referenced design in a component view.
      *
-     *      @param [in] view   The view whose reference to find.
+     *      @param [in] component   The component containing the view.
+     *      @param [in] view        The view whose reference to find.
      *
      *      @return The design referenced n the view.
      */
-    VLNV findDesignReference(QSharedPointer<View> view);
+    VLNV findDesignReference(QSharedPointer<Component const> component, QSharedPointer<View> view);
 
     /*!
      *  Creates a child item for the given design.
@@ -435,8 +436,11 @@ private:
     //! The VLNV this item represents.
     VLNV vlnv_;
 
-	//! The component that this hierarhcyItem represents.
-	QSharedPointer<Component const> component_;
+	//! The implementation of the component that this item represents.
+	KactusAttribute::Implementation implementation_;
+
+	//! Specifies if the component that this item represents is hierarchical.
+	bool isHierarchical_;
 
 	//! The object that manages the library.
 	LibraryInterface* library_;
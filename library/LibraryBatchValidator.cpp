@@ -0,0 +1,327 @@
+//-----------------------------------------------------------------------------
+// File: LibraryBatchValidator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Validates a set of library documents in parallel and reports the results.
+//-----------------------------------------------------------------------------
+
+#include "LibraryBatchValidator.h"
+
+#include "DocumentFileAccess.h"
+#include "DocumentValidator.h"
+#include "LibraryInterface.h"
+
+#include <common/ui/MessageMediator.h>
+#include <common/utils.h>
+
+#include <IPXACTmodels/common/Document.h>
+#include <IPXACTmodels/generaldeclarations.h>
+
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpressionValidator>
+#include <QXmlStreamWriter>
+
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+    //! Number of work chunks per worker to balance documents of different sizes.
+    const int CHUNKS_PER_WORKER = 4;
+
+    //-----------------------------------------------------------------------------
+    //! Collects the messages reported while reading a document.
+    //-----------------------------------------------------------------------------
+    class ErrorCollector : public MessageMediator
+    {
+    public:
+
+        void showMessage(QString const& message) const override { messages_.append(message); }
+
+        void showError(QString const& error) const override { messages_.append(error); }
+
+        void showFailure(QString const& error) const override { messages_.append(error); }
+
+        void showStatusMessage(QString const& /*status*/) const override { }
+
+        //! Takes the collected messages.
+        QVector<QString> takeMessages() { QVector<QString> taken; taken.swap(messages_); return taken; }
+
+    private:
+
+        //! The collected messages.
+        mutable QVector<QString> messages_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Validates a chunk of documents with validators owned by the worker.
+    //-----------------------------------------------------------------------------
+    struct ChunkValidator
+    {
+        using result_type = QVector<LibraryBatchValidator::DocumentResult>;
+
+        //! The library used for resolving the references. Only read during the validation.
+        LibraryInterface* library = nullptr;
+
+        result_type operator()(result_type const& chunk) const;
+    };
+
+    //-----------------------------------------------------------------------------
+    // Function: ChunkValidator::operator()
+    //-----------------------------------------------------------------------------
+    ChunkValidator::result_type ChunkValidator::operator()(result_type const& chunk) const
+    {
+        ErrorCollector readErrors;
+        DocumentFileAccess fileAccess(&readErrors);
+        DocumentValidator validator(library);
+        QRegularExpressionValidator urlTester(Utils::URL_VALIDITY_REG_EXP);
+
+        result_type results = chunk;
+        for (LibraryBatchValidator::DocumentResult& result : results)
+        {
+            QElapsedTimer timer;
+            timer.start();
+
+            QSharedPointer<Document> document = fileAccess.readDocument(result.path);
+            result.errors = readErrors.takeMessages();
+
+            if (document.isNull())
+            {
+                if (result.errors.isEmpty())
+                {
+                    result.errors.append(QObject::tr("Could not read document %1.").arg(result.path));
+                }
+
+                result.elapsedMs = timer.elapsed();
+                continue;
+            }
+
+            validator.findErrorsIn(document, result.errors);
+
+            for (VLNV const& reference : document->getDependentVLNVs())
+            {
+                if (library->contains(reference) == false)
+                {
+                    result.errors.append(QObject::tr("The referenced VLNV was not found in the library: %1").arg(
+                        reference.toString()));
+                }
+            }
+
+            for (QString const& directoryPath : document->getDependentDirs())
+            {
+                if (QFileInfo(General::getAbsolutePath(result.path, directoryPath)).exists() == false)
+                {
+                    result.errors.append(QObject::tr("Directory %1 was not found in the file system.").arg(
+                        directoryPath));
+                }
+            }
+
+            for (QString filePath : document->getDependentFiles())
+            {
+                int pos = 0;
+                if (urlTester.validate(filePath, pos) == QValidator::Acceptable)
+                {
+                    continue;
+                }
+
+                QString absolutePath = filePath;
+                if (QFileInfo(absolutePath).isRelative())
+                {
+                    absolutePath = General::getAbsolutePath(result.path, filePath);
+                }
+
+                if (QFileInfo(absolutePath).exists() == false)
+                {
+                    result.errors.append(QObject::tr("File %1 was not found in the file system.").arg(filePath));
+                }
+            }
+
+            result.elapsedMs = timer.elapsed();
+        }
+
+        return results;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: countFailures()
+    //-----------------------------------------------------------------------------
+    int countFailures(QVector<LibraryBatchValidator::DocumentResult> const& results)
+    {
+        return std::count_if(results.cbegin(), results.cend(),
+            [](LibraryBatchValidator::DocumentResult const& result) { return result.errors.isEmpty() == false; });
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryBatchValidator::LibraryBatchValidator()
+//-----------------------------------------------------------------------------
+LibraryBatchValidator::LibraryBatchValidator(LibraryInterface* library): library_(library)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryBatchValidator::validate()
+//-----------------------------------------------------------------------------
+QVector<LibraryBatchValidator::DocumentResult> LibraryBatchValidator::validate(QList<VLNV> const& documents,
+    int workerCount) const
+{
+    workerCount = qMax(1, workerCount);
+
+    // Paths are resolved in the calling thread, the workers only read the files.
+    int const chunkCount = qMax(1, qMin(documents.size(), workerCount * CHUNKS_PER_WORKER));
+    int const chunkSize = (documents.size() + chunkCount - 1) / chunkCount;
+
+    QList<QVector<DocumentResult> > chunks;
+    for (int i = 0; i < documents.size(); ++i)
+    {
+        if (i % chunkSize == 0)
+        {
+            chunks.append(QVector<DocumentResult>());
+        }
+
+        DocumentResult result;
+        result.vlnv = documents.at(i);
+        result.path = library_->getPath(result.vlnv);
+        chunks.last().append(result);
+    }
+
+    // A private pool limits the number of workers without affecting the global thread pool.
+    QThreadPool pool;
+    pool.setMaxThreadCount(workerCount);
+
+    ChunkValidator chunkValidator;
+    chunkValidator.library = library_;
+
+    QList<QFuture<QVector<DocumentResult> > > validations;
+    for (QVector<DocumentResult> const& chunk : chunks)
+    {
+        validations.append(QtConcurrent::run(&pool, [chunkValidator, chunk]() { return chunkValidator(chunk); }));
+    }
+
+    QVector<DocumentResult> results;
+    results.reserve(documents.size());
+    for (QFuture<QVector<DocumentResult> > const& validation : validations)
+    {
+        results.append(validation.result());
+    }
+
+    return results;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryBatchValidator::selectDocuments()
+//-----------------------------------------------------------------------------
+QList<VLNV> LibraryBatchValidator::selectDocuments(QList<VLNV> const& documents, QString const& prefix)
+{
+    QStringList const fields = prefix.split(QLatin1Char(':'), QString::SkipEmptyParts);
+
+    QList<VLNV> selected;
+    for (VLNV const& vlnv : documents)
+    {
+        QStringList const vlnvFields({ vlnv.getVendor(), vlnv.getLibrary(), vlnv.getName(), vlnv.getVersion() });
+
+        bool matches = fields.size() <= vlnvFields.size();
+        for (int i = 0; matches && i < fields.size(); ++i)
+        {
+            matches = vlnvFields.at(i) == fields.at(i);
+        }
+
+        if (matches)
+        {
+            selected.append(vlnv);
+        }
+    }
+
+    std::sort(selected.begin(), selected.end());
+    return selected;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryBatchValidator::toJson()
+//-----------------------------------------------------------------------------
+QByteArray LibraryBatchValidator::toJson(QVector<DocumentResult> const& results)
+{
+    QJsonArray documents;
+    for (DocumentResult const& result : results)
+    {
+        QJsonArray errors;
+        for (QString const& error : result.errors)
+        {
+            errors.append(error);
+        }
+
+        QJsonObject document;
+        document.insert(QStringLiteral("vlnv"), result.vlnv.toString());
+        document.insert(QStringLiteral("type"), result.vlnv.getTypestr());
+        document.insert(QStringLiteral("path"), result.path);
+        document.insert(QStringLiteral("valid"), result.errors.isEmpty());
+        document.insert(QStringLiteral("elapsedMs"), result.elapsedMs);
+        document.insert(QStringLiteral("errors"), errors);
+        documents.append(document);
+    }
+
+    QJsonObject report;
+    report.insert(QStringLiteral("documents"), results.size());
+    report.insert(QStringLiteral("failures"), countFailures(results));
+    report.insert(QStringLiteral("results"), documents);
+
+    return QJsonDocument(report).toJson();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryBatchValidator::toJUnit()
+//-----------------------------------------------------------------------------
+QByteArray LibraryBatchValidator::toJUnit(QVector<DocumentResult> const& results)
+{
+    qint64 totalMs = 0;
+    for (DocumentResult const& result : results)
+    {
+        totalMs += result.elapsedMs;
+    }
+
+    QByteArray report;
+    QXmlStreamWriter writer(&report);
+    writer.setAutoFormatting(true);
+    writer.writeStartDocument();
+
+    writer.writeStartElement(QStringLiteral("testsuite"));
+    writer.writeAttribute(QStringLiteral("name"), QStringLiteral("Kactus2 library validation"));
+    writer.writeAttribute(QStringLiteral("tests"), QString::number(results.size()));
+    writer.writeAttribute(QStringLiteral("failures"), QString::number(countFailures(results)));
+    writer.writeAttribute(QStringLiteral("time"), QString::number(totalMs / 1000.0, 'f', 3));
+
+    for (DocumentResult const& result : results)
+    {
+        writer.writeStartElement(QStringLiteral("testcase"));
+        writer.writeAttribute(QStringLiteral("classname"), result.vlnv.getTypestr());
+        writer.writeAttribute(QStringLiteral("name"), result.vlnv.toString());
+        writer.writeAttribute(QStringLiteral("file"), result.path);
+        writer.writeAttribute(QStringLiteral("time"), QString::number(result.elapsedMs / 1000.0, 'f', 3));
+
+        if (result.errors.isEmpty() == false)
+        {
+            writer.writeStartElement(QStringLiteral("failure"));
+            writer.writeAttribute(QStringLiteral("message"),
+                QObject::tr("%1 error(s) found").arg(result.errors.size()));
+            writer.writeCharacters(QStringList(result.errors.toList()).join(QLatin1Char('\n')));
+            writer.writeEndElement();
+        }
+
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+    writer.writeEndDocument();
+
+    return report;
+}
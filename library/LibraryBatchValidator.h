@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// File: LibraryBatchValidator.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Validates a set of library documents in parallel and reports the results.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYBATCHVALIDATOR_H
+#define LIBRARYBATCHVALIDATOR_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QThread>
+#include <QVector>
+
+class LibraryInterface;
+
+//-----------------------------------------------------------------------------
+//! Validates a set of library documents in parallel and reports the results.
+//
+// Every worker reads its documents directly from the disk and uses its own validators, so the documents
+// cached in the library are not modified during the validation.
+//-----------------------------------------------------------------------------
+class LibraryBatchValidator
+{
+public:
+
+    //! Validation result of a single document.
+    struct DocumentResult
+    {
+        VLNV vlnv;                  //!< The VLNV of the document.
+        QString path;               //!< The path to the document file.
+        QVector<QString> errors;    //!< The errors found in the document.
+        qint64 elapsedMs = 0;       //!< The time spent on the document in milliseconds.
+    };
+
+    /*! The constructor.
+     *
+     *      @param [in] library     The library containing the documents.
+     */
+    explicit LibraryBatchValidator(LibraryInterface* library);
+
+    //! The destructor.
+    ~LibraryBatchValidator() = default;
+
+    /*! Validates the given documents.
+     *
+     *      @param [in] documents       The VLNVs of the documents to validate.
+     *      @param [in] workerCount     The maximum number of parallel workers.
+     *
+     *      @return The results in the same order as the given documents.
+     */
+    QVector<DocumentResult> validate(QList<VLNV> const& documents,
+        int workerCount = QThread::idealThreadCount()) const;
+
+    /*! Selects the documents matching the given VLNV prefix.
+     *
+     *      @param [in] documents   The documents to select from.
+     *      @param [in] prefix      The prefix in format vendor[:library[:name[:version]]]. Empty selects all.
+     *
+     *      @return The matching documents in sorted order.
+     */
+    static QList<VLNV> selectDocuments(QList<VLNV> const& documents, QString const& prefix);
+
+    /*! Creates a JSON report of the validation results.
+     *
+     *      @param [in] results     The validation results.
+     *
+     *      @return The report.
+     */
+    static QByteArray toJson(QVector<DocumentResult> const& results);
+
+    /*! Creates a JUnit XML report of the validation results.
+     *
+     *      @param [in] results     The validation results.
+     *
+     *      @return The report.
+     */
+    static QByteArray toJUnit(QVector<DocumentResult> const& results);
+
+private:
+
+    // Disable copying.
+    LibraryBatchValidator(LibraryBatchValidator const& rhs);
+    LibraryBatchValidator& operator=(LibraryBatchValidator const& rhs);
+
+    //! The library containing the documents.
+    LibraryInterface* library_;
+};
+
+#endif // LIBRARYBATCHVALIDATOR_H
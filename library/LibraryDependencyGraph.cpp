@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// File: LibraryDependencyGraph.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Graph of the VLNV references between the documents in the library.
+//-----------------------------------------------------------------------------
+
+#include "LibraryDependencyGraph.h"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::setDependencies()
+//-----------------------------------------------------------------------------
+void LibraryDependencyGraph::setDependencies(VLNV const& document, QList<VLNV> const& dependencies)
+{
+    removeDocument(document);
+
+    QSet<VLNV> added;
+    QVector<VLNV>& documentDependencies = dependencies_[document];
+    for (VLNV const& dependency : dependencies)
+    {
+        if (dependency.isValid() && dependency != document && added.contains(dependency) == false)
+        {
+            added.insert(dependency);
+            documentDependencies.append(dependency);
+            dependents_[dependency].insert(document);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::removeDocument()
+//-----------------------------------------------------------------------------
+void LibraryDependencyGraph::removeDocument(VLNV const& document)
+{
+    auto documentDependencies = dependencies_.find(document);
+    if (documentDependencies == dependencies_.end())
+    {
+        return;
+    }
+
+    for (VLNV const& dependency : documentDependencies.value())
+    {
+        auto referencing = dependents_.find(dependency);
+        if (referencing != dependents_.end())
+        {
+            referencing->remove(document);
+            if (referencing->isEmpty())
+            {
+                dependents_.erase(referencing);
+            }
+        }
+    }
+
+    dependencies_.erase(documentDependencies);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::clear()
+//-----------------------------------------------------------------------------
+void LibraryDependencyGraph::clear()
+{
+    dependencies_.clear();
+    dependents_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::hasDependencies()
+//-----------------------------------------------------------------------------
+bool LibraryDependencyGraph::hasDependencies(VLNV const& document) const
+{
+    return dependencies_.contains(document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::getDependencies()
+//-----------------------------------------------------------------------------
+QList<VLNV> LibraryDependencyGraph::getDependencies(VLNV const& document) const
+{
+    return dependencies_.value(document).toList();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::getDependents()
+//-----------------------------------------------------------------------------
+QList<VLNV> LibraryDependencyGraph::getDependents(VLNV const& vlnv) const
+{
+    QList<VLNV> dependents = dependents_.value(vlnv).toList();
+    std::sort(dependents.begin(), dependents.end());
+    return dependents;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryDependencyGraph::dependentCount()
+//-----------------------------------------------------------------------------
+int LibraryDependencyGraph::dependentCount(VLNV const& vlnv) const
+{
+    return dependents_.value(vlnv).size();
+}
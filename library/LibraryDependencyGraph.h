@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// File: LibraryDependencyGraph.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Graph of the VLNV references between the documents in the library.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYDEPENDENCYGRAPH_H
+#define LIBRARYDEPENDENCYGRAPH_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Graph of the VLNV references between the documents in the library.
+//
+// Both the references of each document and the documents referencing each VLNV are stored, so queries in
+// either direction do not require reading the documents. The graph is updated one document at a time.
+//-----------------------------------------------------------------------------
+class LibraryDependencyGraph
+{
+public:
+
+    //! The constructor.
+    LibraryDependencyGraph() = default;
+
+    //! The destructor.
+    ~LibraryDependencyGraph() = default;
+
+    /*! Sets the VLNVs referenced by a document, replacing any previous references.
+     *
+     *      @param [in] document        The VLNV of the document.
+     *      @param [in] dependencies    The VLNVs referenced in the document.
+     */
+    void setDependencies(VLNV const& document, QList<VLNV> const& dependencies);
+
+    /*! Removes a document and its references from the graph.
+     *
+     *  References to the document from other documents are kept.
+     *
+     *      @param [in] document    The VLNV of the removed document.
+     */
+    void removeDocument(VLNV const& document);
+
+    //! Removes all documents from the graph.
+    void clear();
+
+    /*! Checks if the references of a document are known.
+     *
+     *      @param [in] document    The VLNV of the document.
+     *
+     *      @return True, if the references have been set, otherwise false.
+     */
+    bool hasDependencies(VLNV const& document) const;
+
+    /*! Gets the VLNVs referenced by a document.
+     *
+     *      @param [in] document    The VLNV of the document.
+     *
+     *      @return The referenced VLNVs in the order of the document.
+     */
+    QList<VLNV> getDependencies(VLNV const& document) const;
+
+    /*! Gets the documents referencing a VLNV.
+     *
+     *      @param [in] vlnv    The referenced VLNV.
+     *
+     *      @return The VLNVs of the referencing documents in sorted order.
+     */
+    QList<VLNV> getDependents(VLNV const& vlnv) const;
+
+    /*! Gets the number of documents referencing a VLNV.
+     *
+     *      @param [in] vlnv    The referenced VLNV.
+     *
+     *      @return The number of referencing documents.
+     */
+    int dependentCount(VLNV const& vlnv) const;
+
+private:
+
+    // Disable copying.
+    LibraryDependencyGraph(LibraryDependencyGraph const& rhs);
+    LibraryDependencyGraph& operator=(LibraryDependencyGraph const& rhs);
+
+    //! The referenced VLNVs of each document without duplicates.
+    QHash<VLNV, QVector<VLNV> > dependencies_;
+
+    //! The referencing documents of each VLNV.
+    QHash<VLNV, QSet<VLNV> > dependents_;
+};
+
+#endif // LIBRARYDEPENDENCYGRAPH_H
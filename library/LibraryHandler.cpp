@@ -47,10 +47,63 @@
 #include <QList>
 #include <QMap>
 #include <QMessageBox>
+#include <QMutexLocker>
+#include <QSet>
 #include <QString>
 #include <QStringList>
+#include <QSettings>
+#include <QThread>
 #include <QTimer>
 
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+    //! Default memory budget for the parsed documents, as their estimated memory use in megabytes.
+    const int DEFAULT_CACHE_BUDGET_MB = 512;
+
+    //! Time without new file changes before a batch is read, long enough to cover removing and rewriting a file.
+    const int FILE_CHANGE_DELAY_MS = 250;
+
+    //! Ratio of the estimated model size to the file size, used when a document was not read from its file.
+    const int FILE_TO_MODEL_SIZE_RATIO = 4;
+
+    //! Number of changed documents above which the library views are rebuilt instead of updated item by item.
+    const int MODEL_RESET_THRESHOLD = 20;
+
+    //-----------------------------------------------------------------------------
+    //! Collects the messages reported while reading documents outside the GUI thread.
+    //-----------------------------------------------------------------------------
+    class MessageCollector : public MessageMediator
+    {
+    public:
+
+        void showMessage(QString const& message) const override { notices_.append(message); }
+
+        void showError(QString const& error) const override { errors_.append(error); }
+
+        void showFailure(QString const& error) const override { errors_.append(error); }
+
+        void showStatusMessage(QString const& /*status*/) const override { }
+
+        //! Takes the collected errors.
+        QVector<QString> takeErrors() { QVector<QString> taken; taken.swap(errors_); return taken; }
+
+        //! Takes the collected notices.
+        QVector<QString> takeNotices() { QVector<QString> taken; taken.swap(notices_); return taken; }
+
+    private:
+
+        //! The collected errors.
+        mutable QVector<QString> errors_;
+
+        //! The collected notices.
+        mutable QVector<QString> notices_;
+    };
+}
+
 LibraryHandler* LibraryHandler::instance_ = nullptr;
 
 //-----------------------------------------------------------------------------
@@ -87,6 +140,7 @@ QObject(parent),
     fileAccess_(messageChannel),
     loader_(messageChannel),
     documentCache_(),
+    dependencyGraph_(),
     urlTester_(Utils::URL_VALIDITY_REG_EXP, this),
     validator_(this),
     treeModel_(new LibraryTreeModel(this, this)),
@@ -96,12 +150,26 @@ QObject(parent),
     fileWatch_(this),
     itemExporter_(new ItemExporter(messageChannel, this, fileAccess_, parentWidget, this)),
     checkResults_(),
-    updatedPaths_()
+    changedPaths_(),
+    fileChangeTimer_(),
+    fileChangeReader_(),
+    cacheBudget_(QSettings().value(QStringLiteral("Library/CacheBudget"), DEFAULT_CACHE_BUDGET_MB).toLongLong() *
+        1024 * 1024),
+    cachedSize_(0),
+    evictionDeferred_(false),
+    accessCounter_(0),
+    pinnedDocuments_(),
+    cacheStatistics_()
 {
     // create the connections between models and library handler
     syncronizeModels();
     connect(&fileWatch_, SIGNAL(fileChanged(QString const&)),
             this, SLOT(onFileChangedOnDisk(QString const&)), Qt::UniqueConnection);
+
+    fileChangeTimer_.setSingleShot(true);
+    fileChangeTimer_.setInterval(FILE_CHANGE_DELAY_MS);
+    connect(&fileChangeTimer_, SIGNAL(timeout()), this, SLOT(handleFileChange()), Qt::UniqueConnection);
+    connect(&fileChangeReader_, SIGNAL(finished()), this, SLOT(applyFileChanges()), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -109,23 +177,19 @@ QObject(parent),
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 {
-    auto info = documentCache_.find(vlnv);
-    if (info == documentCache_.end())
+    if (contains(vlnv) == false)
     {
         showNotFoundError(vlnv);
         return QSharedPointer<Document>();
     }
 
-    // If object has not already been parsed, read it from the disk.
-    if (info->document.isNull())
-    {
-        info->document = fileAccess_.readDocument(info->path);
-    }
+    // The caller may modify the model, so it must not share the cached instance.
+    QSharedPointer<Document> cached = getCachedDocument(vlnv);
 
     QSharedPointer<Document> copy;
-    if (info->document.isNull() == false)
+    if (cached.isNull() == false)
     {
-        copy = info->document->clone();
+        copy = cached->clone();
     }
 
     return copy;
@@ -136,18 +200,7 @@ QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv)
 {
-    auto info = documentCache_.find(vlnv);
-    if (info == documentCache_.end())
-    {
-        return QSharedPointer<Document const>();
-    }
-
-    if (info->document.isNull())
-    {
-        info->document = fileAccess_.readDocument(info->path);
-    }
-
-    return info->document;
+    return getCachedDocument(vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -205,7 +258,7 @@ bool LibraryHandler::writeModelToFile(QString const& path, QSharedPointer<Docume
     }
 
     // the hierarchy model must be re-built
-    hierarchyModel_->onResetModel();
+    resetHierarchyModel();
     treeModel_->onAddVLNV(vlnv);
     
     return true;
@@ -233,29 +286,58 @@ void LibraryHandler::searchForIPXactFiles()
     resetModels();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::loadLibraryIndex()
+//-----------------------------------------------------------------------------
+void LibraryHandler::loadLibraryIndex()
+{
+    clearCache();
+
+    loadAvailableVLNVs();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getNeededVLNVs()
 //-----------------------------------------------------------------------------
 void LibraryHandler::getNeededVLNVs(VLNV const& vlnv, QList<VLNV>& list)
 {
-    if (contains(vlnv) == false)
+    QSet<VLNV> searched;
+    for (VLNV const& listed : list)
     {
-        messageChannel_->showError(tr("No item with following info was found in library: \n"
-            "Vendor: %1\n"
-            "Library: %2\n"
-            "Name: %3\n"
-            "Version: %4").arg(vlnv.getVendor(), vlnv.getLibrary(), vlnv.getName(), vlnv.getVersion()));
-        return;
+        searched.insert(listed);
     }
 
-    // This document is searched so add it to the list.
-    list.append(vlnv);
-
-    for (VLNV const& dependentVLNV : getModelReadOnly(vlnv)->getDependentVLNVs())
+    // Depth-first search in the same order as the documents list their references.
+    QVector<VLNV> pending({ vlnv });
+    while (pending.isEmpty() == false)
     {
-        if (list.contains(dependentVLNV) == false)
+        VLNV const current = pending.takeLast();
+        if (searched.contains(current))
+        {
+            continue;
+        }
+
+        if (contains(current) == false)
         {
-            getNeededVLNVs(dependentVLNV, list);
+            messageChannel_->showError(tr("No item with following info was found in library: \n"
+                "Vendor: %1\n"
+                "Library: %2\n"
+                "Name: %3\n"
+                "Version: %4").arg(current.getVendor(), current.getLibrary(), current.getName(),
+                current.getVersion()));
+            continue;
+        }
+
+        searched.insert(current);
+        list.append(current);
+
+        QList<VLNV> const dependencies = findDependencies(current);
+        for (auto dependency = dependencies.crbegin(); dependency != dependencies.crend(); ++dependency)
+        {
+            if (searched.contains(*dependency) == false)
+            {
+                pending.append(*dependency);
+            }
         }
     }
 }
@@ -311,8 +393,7 @@ VLNV::IPXactType LibraryHandler::getDocumentType(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 int LibraryHandler::referenceCount(VLNV const& vlnv) const
 {
-    QList<VLNV> list;
-    return hierarchyModel_->getOwners(list, vlnv);
+    return dependencyGraph_.dependentCount(vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -320,7 +401,15 @@ int LibraryHandler::referenceCount(VLNV const& vlnv) const
 //-----------------------------------------------------------------------------
 int LibraryHandler::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 {
-    return hierarchyModel_->getOwners(list, vlnvToSearch);
+    for (VLNV const& owner : dependencyGraph_.getDependents(vlnvToSearch))
+    {
+        if (list.contains(owner) == false)
+        {
+            list.append(owner);
+        }
+    }
+
+    return list.size();
 }
 
 //-----------------------------------------------------------------------------
@@ -333,6 +422,24 @@ int LibraryHandler::getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) con
         return 0;
     }
 
+    // The abstraction definitions of a bus are found directly from their references to the bus definition.
+    auto document = documentCache_.constFind(vlnvToSearch);
+    if (document != documentCache_.cend() && document.key().getType() == VLNV::BUSDEFINITION)
+    {
+        for (VLNV const& dependent : dependencyGraph_.getDependents(vlnvToSearch))
+        {
+            auto dependentDocument = documentCache_.constFind(dependent);
+            if (dependentDocument != documentCache_.cend() &&
+                dependentDocument.key().getType() == VLNV::ABSTRACTIONDEFINITION &&
+                list.contains(dependent) == false)
+            {
+                list.append(dependent);
+            }
+        }
+
+        return list.size();
+    }
+
     hierarchyModel_->getChildren(list, vlnvToSearch);
     return list.size();
 }
@@ -402,6 +509,29 @@ bool LibraryHandler::isValid(VLNV const& vlnv)
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCacheStatistics()
+//-----------------------------------------------------------------------------
+LibraryHandler::CacheStatistics LibraryHandler::getCacheStatistics() const
+{
+    QMutexLocker locker(&cacheMutex_);
+
+    CacheStatistics statistics = cacheStatistics_;
+    statistics.cachedSize = cachedSize_;
+    return statistics;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::setCacheBudget()
+//-----------------------------------------------------------------------------
+void LibraryHandler::setCacheBudget(qint64 budget)
+{
+    QMutexLocker locker(&cacheMutex_);
+
+    cacheBudget_ = budget;
+    enforceCacheBudget(VLNV(), locker);
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getHierarchyModel()
 //-----------------------------------------------------------------------------
@@ -431,27 +561,31 @@ void LibraryHandler::onCheckLibraryIntegrity()
     QVector<TagData> documentTags;
     for (auto it = documentCache_.begin(); it != documentCache_.end(); ++it)
     {
-        // TODO: Add model to cache only, if it is already previously cached.
-        // Current hierarchy model forces all models to be loaded, but this should be changed.
-        QSharedPointer<Document> model = it->document;
-        if (model.isNull())
-        {
-            model = fileAccess_.readDocument(it->path);
-            it->document = model;
-        }           
+        // Documents are loaded through the cache so that the memory budget is respected during the check.
+        QSharedPointer<Document> model = getCachedDocument(it.key());
 
         if (model.isNull() == false)
         {
             documentTags += (model->getTags());
+
+            if (dependencyGraph_.hasDependencies(it.key()) == false)
+            {
+                updateDependencies(it.key(), it->path, model);
+            }
         }
 
-        it->isValid = validateDocument(model, it->path);
-        if (it->isValid == false)
+        bool const documentValid = validateDocument(model, it->path);
+        if (documentValid == false)
         {
             checkResults_.documentCount++;
         }
+
+        QMutexLocker locker(&cacheMutex_);
+        it->isValid = documentValid;
     }
 
+    loader_.saveIndex();
+
     TagManager& manager = TagManager::getInstance();
     manager.setTags(documentTags);
 
@@ -460,6 +594,29 @@ void LibraryHandler::onCheckLibraryIntegrity()
     messageChannel_->showStatusMessage(tr("Ready."));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::pinDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::pinDocument(VLNV const& vlnv)
+{
+    QMutexLocker locker(&cacheMutex_);
+    pinnedDocuments_[vlnv]++;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::unpinDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::unpinDocument(VLNV const& vlnv)
+{
+    QMutexLocker locker(&cacheMutex_);
+
+    auto pinned = pinnedDocuments_.find(vlnv);
+    if (pinned != pinnedDocuments_.end() && --pinned.value() <= 0)
+    {
+        pinnedDocuments_.erase(pinned);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::onEditItem()
 //-----------------------------------------------------------------------------
@@ -494,7 +651,7 @@ void LibraryHandler::onEditItem(VLNV const& vlnv)
     else if (documentType == VLNV::BUSDEFINITION)
     {
         QList<VLNV> absDefVLNVs;
-        hierarchyModel_->getChildren(absDefVLNVs, vlnv);
+        getChildren(absDefVLNVs, vlnv);
 
         if (absDefVLNVs.size() == 1)
         {
@@ -525,7 +682,7 @@ void LibraryHandler::onEditItem(VLNV const& vlnv)
         }
 
         QList<VLNV> absDefVLNVs;
-        hierarchyModel_->getChildren(absDefVLNVs, busDefVLNV);
+        getChildren(absDefVLNVs, busDefVLNV);
 
         // If there is exactly one abstraction definition per bus definition, open it.
         if (absDefVLNVs.size() == 1 && absDefVLNVs.first() == vlnv)
@@ -554,7 +711,8 @@ void LibraryHandler::onShowErrors(VLNV const& vlnv)
         return;
     }
 
-    QSharedPointer<Document> document = getModel(vlnv);
+    // Error search does not modify the document, so the cached instance can be used without copying.
+    QSharedPointer<Document> document = getCachedDocument(vlnv);
 
     // Show error list in a dialog.
     TableViewDialog* dialog = new TableViewDialog(parentWidget_);
@@ -563,6 +721,7 @@ void LibraryHandler::onShowErrors(VLNV const& vlnv)
     dialog->resize(700, 350);
 
     LibraryErrorModel* model = new LibraryErrorModel(dialog);
+    model->addErrors(documentCache_.value(vlnv).readErrors, vlnv.toString());
     model->addErrors(findErrorsInDocument(document, getPath(vlnv)), vlnv.toString());
 
     dialog->show();
@@ -591,7 +750,10 @@ void LibraryHandler::onGenerateIntegrityReport()
         {
             if (it->isValid == false)
             {
-                model->addErrors(findErrorsInDocument(it->document, it->path), it.key().toString());
+                QSharedPointer<Document> document = getCachedDocument(it.key());
+                model->addErrors(it->readErrors, it.key().toString());
+                model->addErrors(findErrorsInDocument(document, it->path),
+                    it.key().toString());
             }
         }             
 
@@ -704,9 +866,22 @@ void LibraryHandler::removeObject(VLNV const& vlnv)
         return;
     }
 
-    QString path = documentCache_.find(vlnv)->path;
+    QString path;
+    {
+        QMutexLocker locker(&cacheMutex_);
+
+        auto info = documentCache_.find(vlnv);
+        path = info->path;
+
+        if (info->document.isNull() == false)
+        {
+            cachedSize_ -= info->cachedSize;
+        }
+        documentCache_.erase(info);
+    }
+
     fileWatch_.removePath(path);
-    documentCache_.remove(vlnv);
+    dependencyGraph_.removeDocument(vlnv);
 
     treeModel_->onRemoveVLNV(vlnv);
     hierarchyModel_->onRemoveVLNV(vlnv);
@@ -831,7 +1006,7 @@ void LibraryHandler::onCreateAbsDef(VLNV const& busDefVLNV)
     QString directory = busDefInfo.absolutePath();
 
     QList<VLNV> absDefVLNVs;
-    hierarchyModel_->getChildren(absDefVLNVs, busDefVLNV);
+    getChildren(absDefVLNVs, busDefVLNV);
 
     // if theres no previous abstraction definition for given bus def
     if (absDefVLNVs.isEmpty())
@@ -876,9 +1051,9 @@ void LibraryHandler::onItemSaved(VLNV const& vlnv)
     VLNV savedItem = vlnv;
     savedItem.setType(getDocumentType(vlnv));
 
-    // Replace overwritten item with new and check validity.
-    QSharedPointer<Document> model = getModel(vlnv);
-    documentCache_.insert(vlnv, DocumentInfo(getPath(vlnv), model, validateDocument(model, getPath(vlnv))));
+    // Check validity of the cached item.
+    QSharedPointer<Document> model = getCachedDocument(vlnv);
+    cacheDocument(vlnv, getPath(vlnv), model, validateDocument(model, getPath(vlnv)));
     
     treeModel_->onDocumentUpdated(vlnv);
     hierarchyModel_->onDocumentUpdated(vlnv);
@@ -898,9 +1073,10 @@ void LibraryHandler::onCloseIntegrityReport()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onFileChangedOnDisk(QString const& path)
 {
-    // Add timer to skip the time it takes to remove the file and rewrite it on save.
-    updatedPaths_.append(path);
-    QTimer::singleShot(100, Qt::CoarseTimer, this, SLOT(handleFileChange()));
+    // Restart the timer on every change to skip the time it takes to remove the file and rewrite it on save,
+    // and to collect the files changed together e.g. by a version control update into one batch.
+    changedPaths_.insert(path);
+    fileChangeTimer_.start();
 }
 
 //-----------------------------------------------------------------------------
@@ -908,32 +1084,174 @@ void LibraryHandler::onFileChangedOnDisk(QString const& path)
 //-----------------------------------------------------------------------------
 void LibraryHandler::handleFileChange()
 {
-    VLNV vlnv;
-    QString path = updatedPaths_.takeFirst();
-    
-    if (QFile::exists(path))
+    // Changes arriving during the read are handled as the next batch once the read has been applied.
+    if (fileChangeReader_.isRunning() || changedPaths_.isEmpty())
     {
-        // File updated on disk.
-        QSharedPointer<Document> model = fileAccess_.readDocument(path);
-        vlnv = model->getVlnv();
-        documentCache_.insert(vlnv, DocumentInfo(path, model, validateDocument(model, path)));
+        return;
+    }
 
-        emit updatedVLNV(vlnv);
+    QVector<QString> paths;
+    paths.reserve(changedPaths_.size());
+    for (QString const& path : changedPaths_)
+    {
+        paths.append(path);
+    }
+    changedPaths_.clear();
+
+    std::sort(paths.begin(), paths.end());
+
+    messageChannel_->showStatusMessage(tr("Reading %1 changed file(s). Please wait...").arg(paths.size()));
+    fileChangeReader_.setFuture(QtConcurrent::run(&LibraryHandler::readChangedFiles, paths));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::applyFileChanges()
+//-----------------------------------------------------------------------------
+void LibraryHandler::applyFileChanges()
+{
+    QVector<FileChange> const changes = fileChangeReader_.result();
+
+    QHash<QString, VLNV> cachedPaths;
+    {
+        QMutexLocker locker(&cacheMutex_);
+
+        cachedPaths.reserve(documentCache_.size());
+        for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+        {
+            cachedPaths.insert(it->path, it.key());
+        }
+    }
+
+    QSet<QString> const watchedFiles = QSet<QString>::fromList(fileWatch_.files());
+
+    QVector<VLNV> removedDocuments;
+    QVector<VLNV> updatedDocuments;
+    bool documentsAdded = false;
+
+    for (FileChange const& change : changes)
+    {
+        for (QString const& error : change.errors)
+        {
+            messageChannel_->showError(error);
+        }
+
+        for (QString const& notice : change.notices)
+        {
+            messageChannel_->showMessage(notice);
+        }
+
+        VLNV const previousVLNV = cachedPaths.value(change.path);
+
+        VLNV currentVLNV;
+        if (change.removed == false && change.document.isNull() == false)
+        {
+            currentVLNV = change.document->getVlnv();
+        }
+
+        // A file that could not be read keeps its previous document until it is rewritten.
+        bool const vlnvChanged = currentVLNV.isValid() && currentVLNV != previousVLNV;
+        if (previousVLNV.isValid() && (change.removed || vlnvChanged))
+        {
+            QMutexLocker locker(&cacheMutex_);
+
+            auto removed = documentCache_.find(previousVLNV);
+            if (removed != documentCache_.end())
+            {
+                if (removed->document.isNull() == false)
+                {
+                    cachedSize_ -= removed->cachedSize;
+                }
+                documentCache_.erase(removed);
+            }
+
+            dependencyGraph_.removeDocument(previousVLNV);
+            removedDocuments.append(previousVLNV);
+        }
+
+        if (currentVLNV.isValid() == false)
+        {
+            continue;
+        }
+
+        documentsAdded = documentsAdded || previousVLNV != currentVLNV;
+
+        cacheDocument(currentVLNV, change.path, change.document, validateDocument(change.document, change.path),
+            change.modelSize);
+        updateDependencies(currentVLNV, change.path, change.document);
+        updatedDocuments.append(currentVLNV);
+
+        // Files rewritten by removing and recreating them are no longer watched.
+        if (watchedFiles.contains(change.path) == false)
+        {
+            fileWatch_.addPath(change.path);
+        }
+    }
+
+    if (documentsAdded || removedDocuments.size() + updatedDocuments.size() > MODEL_RESET_THRESHOLD)
+    {
+        resetModels();
     }
     else
     {
-        // File removed.
-        auto changedDocument = std::find_if(documentCache_.begin(), documentCache_.end(),
-            [path](const DocumentInfo& item) { return item.path.compare(path) == 0; });
+        for (VLNV const& vlnv : removedDocuments)
+        {
+            treeModel_->onRemoveVLNV(vlnv);
+            hierarchyModel_->onRemoveVLNV(vlnv);
+        }
 
-        if (changedDocument != documentCache_.end() && changedDocument.key().isValid())
+        for (VLNV const& vlnv : updatedDocuments)
         {
-            vlnv = changedDocument.key();
-            documentCache_.erase(changedDocument);
+            treeModel_->onDocumentUpdated(vlnv);
+            hierarchyModel_->onDocumentUpdated(vlnv);
+        }
+
+        messageChannel_->showStatusMessage(tr("Ready."));
+    }
 
-            emit removeVLNV(vlnv);
+    for (VLNV const& vlnv : removedDocuments)
+    {
+        emit removeVLNV(vlnv);
+    }
+
+    for (VLNV const& vlnv : updatedDocuments)
+    {
+        emit updatedVLNV(vlnv);
+    }
+
+    if (changedPaths_.isEmpty() == false)
+    {
+        fileChangeTimer_.start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::readChangedFiles()
+//-----------------------------------------------------------------------------
+QVector<LibraryHandler::FileChange> LibraryHandler::readChangedFiles(QVector<QString> const& paths)
+{
+    MessageCollector messages;
+    DocumentFileAccess fileAccess(&messages);
+
+    QVector<FileChange> changes;
+    changes.reserve(paths.size());
+    for (QString const& path : paths)
+    {
+        FileChange change;
+        change.path = path;
+        change.removed = QFile::exists(path) == false;
+
+        if (change.removed == false)
+        {
+            change.document = fileAccess.readDocument(path);
+            change.modelSize = fileAccess.getEstimatedModelSize();
+            change.errors = messages.takeErrors();
+            change.notices = messages.takeNotices();
         }
+
+        changes.append(change);
     }
+
+    return changes;
 }
 
 //-----------------------------------------------------------------------------
@@ -942,22 +1260,10 @@ void LibraryHandler::handleFileChange()
 void LibraryHandler::syncronizeModels()
 {
     // connect the signals from the data model
-    connect(this, SIGNAL(removeVLNV(const VLNV&)),
-        treeModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
-    connect(this, SIGNAL(removeVLNV(const VLNV&)),
-        hierarchyModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
-
+    // The models are updated for changes on disk in applyFileChanges() once per batch.
     connect(this, SIGNAL(addVLNV(const VLNV&)),
         treeModel_, SLOT(onAddVLNV(const VLNV&)), Qt::UniqueConnection);
 
-    connect(this, SIGNAL(updatedVLNV(VLNV const&)),
-        this, SLOT(onItemSaved(VLNV const&)), Qt::UniqueConnection);
-
-    connect(this, SIGNAL(updatedVLNV(VLNV const&)),
-            treeModel_, SLOT(onDocumentUpdated(VLNV const&)), Qt::UniqueConnection);
-    connect(this, SIGNAL(updatedVLNV(VLNV const&)),
-            hierarchyModel_, SLOT(onDocumentUpdated(VLNV const&)), Qt::UniqueConnection);
-
     connect(itemExporter_, SIGNAL(noticeMessage(const QString&)),
         this, SIGNAL(noticeMessage(QString const&)), Qt::UniqueConnection);
 
@@ -1062,6 +1368,196 @@ void LibraryHandler::showNotFoundError(VLNV const& vlnv) const
     messageChannel_->showError(tr("VLNV: %1 was not found in library.").arg(vlnv.toString()));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCachedDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> LibraryHandler::getCachedDocument(VLNV const& vlnv)
+{
+    // Validators may read referenced documents concurrently e.g. in headless batch validation.
+    QString path;
+    {
+        QMutexLocker locker(&cacheMutex_);
+
+        auto info = documentCache_.find(vlnv);
+        if (info == documentCache_.end())
+        {
+            return QSharedPointer<Document>();
+        }
+
+        info->lastAccess = ++accessCounter_;
+
+        if (info->document.isNull() == false)
+        {
+            cacheStatistics_.hits++;
+            return info->document;
+        }
+
+        // A model still in use elsewhere is taken back instead of creating a second copy of it.
+        QSharedPointer<Document> inUse = info->evicted.toStrongRef();
+        if (inUse.isNull() == false)
+        {
+            cacheStatistics_.hits++;
+            info->document = inUse;
+            info->evicted.clear();
+            cachedSize_ += info->cachedSize;
+
+            enforceCacheBudget(vlnv, locker);
+            return inUse;
+        }
+
+        cacheStatistics_.misses++;
+        path = info->path;
+    }
+
+    // If object has not already been parsed or it has been evicted, read it from the disk without holding
+    // the lock, so that reading one document does not block the readers of the others.
+    // The messages are collected, since the message channel may only be used in the thread of the handler.
+    MessageCollector messages;
+    DocumentFileAccess fileAccess(&messages);
+    QSharedPointer<Document> document = fileAccess.readDocument(path);
+    qint64 const modelSize = fileAccess.getEstimatedModelSize();
+
+    QVector<QString> readErrors = messages.takeErrors();
+    if (QThread::currentThread() == thread())
+    {
+        for (QString const& error : readErrors)
+        {
+            messageChannel_->showError(error);
+        }
+    }
+
+    QMutexLocker locker(&cacheMutex_);
+
+    auto info = documentCache_.find(vlnv);
+    if (info == documentCache_.end() || info->path != path)
+    {
+        // The document was removed or moved while it was read.
+        return document;
+    }
+
+    info->readErrors = readErrors;
+
+    if (info->document.isNull() == false)
+    {
+        // Another thread read the document first, so all the callers share its instance.
+        return info->document;
+    }
+
+    if (document.isNull() == false)
+    {
+        info->document = document;
+        info->evicted.clear();
+        info->cachedSize = modelSize;
+        cachedSize_ += info->cachedSize;
+
+        enforceCacheBudget(vlnv, locker);
+    }
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::cacheDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::cacheDocument(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document,
+    bool isValid, qint64 modelSize)
+{
+    QMutexLocker locker(&cacheMutex_);
+
+    DocumentInfo info(path, document, isValid);
+    info.lastAccess = ++accessCounter_;
+
+    auto previous = documentCache_.constFind(vlnv);
+    bool const previouslyCached = previous != documentCache_.cend() && previous->document.isNull() == false;
+    if (previouslyCached)
+    {
+        cachedSize_ -= previous->cachedSize;
+    }
+
+    if (document.isNull() == false)
+    {
+        if (modelSize >= 0)
+        {
+            info.cachedSize = modelSize;
+        }
+        else if (previouslyCached && previous->document == document)
+        {
+            info.cachedSize = previous->cachedSize;
+        }
+        else
+        {
+            info.cachedSize = QFileInfo(path).size() * FILE_TO_MODEL_SIZE_RATIO;
+        }
+    }
+
+    cachedSize_ += info.cachedSize;
+    documentCache_.insert(vlnv, info);
+
+    enforceCacheBudget(vlnv, locker);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::enforceCacheBudget()
+//-----------------------------------------------------------------------------
+void LibraryHandler::enforceCacheBudget(VLNV const& keptDocument, QMutexLocker const& cacheLock)
+{
+    Q_ASSERT(cacheLock.mutex() == &cacheMutex_);
+
+    if (evictionDeferred_ || cacheBudget_ <= 0 || cachedSize_ <= cacheBudget_)
+    {
+        return;
+    }
+
+    QVector<QPair<quint64, VLNV> > candidates;
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        if (it->document.isNull() == false && it.key() != keptDocument &&
+            pinnedDocuments_.contains(it.key()) == false)
+        {
+            candidates.append(qMakePair(it->lastAccess, it.key()));
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    // Evict below the budget to avoid a new sweep on every following load.
+    qint64 const targetSize = cacheBudget_ - cacheBudget_ / 10;
+    for (auto const& candidate : candidates)
+    {
+        if (cachedSize_ <= targetSize)
+        {
+            break;
+        }
+
+        // The size is kept for taking the model back, if it is still in use when requested again.
+        auto info = documentCache_.find(candidate.second);
+        cachedSize_ -= info->cachedSize;
+        info->evicted = info->document;
+        info->document.clear();
+
+        cacheStatistics_.evictions++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::resetHierarchyModel()
+//-----------------------------------------------------------------------------
+void LibraryHandler::resetHierarchyModel()
+{
+    // The hierarchy reads the same documents several times e.g. for designs used in many components.
+    // Evicting during the build would parse those again, so the budget is enforced once at the end.
+    {
+        QMutexLocker locker(&cacheMutex_);
+        evictionDeferred_ = true;
+    }
+
+    hierarchyModel_->onResetModel();
+
+    QMutexLocker locker(&cacheMutex_);
+    evictionDeferred_ = false;
+    enforceCacheBudget(VLNV(), locker);
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::addObject()
 //-----------------------------------------------------------------------------
@@ -1081,11 +1577,41 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
 
     TagManager::getInstance().addNewTags(model->getTags());
 
-    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, model->clone(), validateDocument(model, targetPath)));
+    cacheDocument(model->getVlnv(), targetPath, model->clone(), validateDocument(model, targetPath));
+    updateDependencies(model->getVlnv(), targetPath, model);
 
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::updateDependencies()
+//-----------------------------------------------------------------------------
+void LibraryHandler::updateDependencies(VLNV const& vlnv, QString const& path,
+    QSharedPointer<const Document> document)
+{
+    if (document.isNull())
+    {
+        return;
+    }
+
+    QList<VLNV> const dependencies = document->getDependentVLNVs();
+    dependencyGraph_.setDependencies(vlnv, dependencies);
+    loader_.setDependencies(path, dependencies);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findDependencies()
+//-----------------------------------------------------------------------------
+QList<VLNV> LibraryHandler::findDependencies(VLNV const& vlnv)
+{
+    if (dependencyGraph_.hasDependencies(vlnv) == false)
+    {
+        updateDependencies(vlnv, getPath(vlnv), getModelReadOnly(vlnv));
+    }
+
+    return dependencyGraph_.getDependencies(vlnv);
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::clearCache()
 //-----------------------------------------------------------------------------
@@ -1094,7 +1620,11 @@ void LibraryHandler::clearCache()
     if (!documentCache_.isEmpty())
     {
         fileWatch_.removePaths(fileWatch_.files());
+        dependencyGraph_.clear();
+
+        QMutexLocker locker(&cacheMutex_);
         documentCache_.clear();
+        cachedSize_ = 0;
     }
 }
 
@@ -1105,9 +1635,16 @@ void LibraryHandler::loadAvailableVLNVs()
 {
     messageChannel_->showStatusMessage(tr("Scanning library. Please wait..."));
 
+    auto reportProgress = [this](int scannedFiles, int totalFiles)
+    {
+        messageChannel_->showStatusMessage(tr("Scanning library. Please wait... (%1/%2 files)").arg(
+            QString::number(scannedFiles), QString::number(totalFiles)));
+        return true;
+    };
+
     // Read all items before validation.
     // Validation will check for VLNVs in the library, so they must be available before validation.    
-    for (auto const& target: loader_.parseLibrary())
+    for (auto const& target: loader_.parseLibrary(reportProgress))
     {
         if (contains(target.vlnv))
         {
@@ -1116,8 +1653,18 @@ void LibraryHandler::loadAvailableVLNVs()
         }
         else
         {
-            documentCache_.insert(target.vlnv, DocumentInfo(target.path));
+            {
+                QMutexLocker locker(&cacheMutex_);
+                documentCache_.insert(target.vlnv, DocumentInfo(target.path));
+            }
             fileWatch_.addPath(target.path);
+
+            // Unchanged files get their references from the library index without reading the document.
+            QList<VLNV> dependencies;
+            if (loader_.findDependencies(target.path, dependencies))
+            {
+                dependencyGraph_.setDependencies(target.vlnv, dependencies);
+            }
         }
     }
     messageChannel_->showStatusMessage(tr("Ready."));
@@ -1129,7 +1676,7 @@ void LibraryHandler::loadAvailableVLNVs()
 void LibraryHandler::resetModels()
 {
     messageChannel_->showStatusMessage(tr("Updating library view. Please wait..."));
-    hierarchyModel_->onResetModel();
+    resetHierarchyModel();
     treeModel_->onResetModel();
     messageChannel_->showStatusMessage(tr("Ready."));
 }
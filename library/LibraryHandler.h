@@ -12,6 +12,7 @@
 #ifndef LIBRARYHANDLER_H
 #define LIBRARYHANDLER_H
 
+#include "LibraryDependencyGraph.h"
 #include "LibraryInterface.h"
 #include "LibraryLoader.h"
 #include "LibraryTreeWidget.h"
@@ -35,9 +36,13 @@
 #include <QList>
 #include <QFileInfo>
 #include <QFileSystemWatcher>
+#include <QFutureWatcher>
 #include <QSharedPointer>
 #include <QHash>
+#include <QMutex>
 #include <QObject>
+#include <QSet>
+#include <QTimer>
 
 class Document;
 class LibraryItem;
@@ -73,6 +78,8 @@ public:
     /*! Get a model that matches given VLNV.
      *
      * This function can be called to get a model that matches an IP-Xact document.
+     * The returned model is a private copy that the caller may modify. Callers that only read the
+     * model should use getModelReadOnly() which does not copy the document.
      * 
      *      @param [in] vlnv Identifies the desired document.
      *
@@ -151,6 +158,12 @@ public:
 
     //! Search for IP-Xact files in the file system and add them to library
     virtual void searchForIPXactFiles() override final;
+
+    /*! Loads the documents in the library without checking their integrity or updating the library views.
+     *
+     *  Intended for batch use, where the documents are validated separately.
+     */
+    void loadLibraryIndex();
     
     /*! Get list of vlnvs that are needed by given document.
      *
@@ -193,15 +206,19 @@ public:
     */
     virtual VLNV::IPXactType getDocumentType(VLNV const& vlnv) override final;
 
-    /*! Count how many times the given component is instantiated in the library.
+    /*! Count how many documents in the library reference the given VLNV.
+     *
+     *  Each referencing document is counted once, regardless of how many times it references the VLNV.
      *
      *      @param [in] vlnv Identifies the component that's instances are searched.
      *
-     *      @return Number of found instances.
+     *      @return Number of documents referencing the VLNV.
      */
     virtual int referenceCount(VLNV const& vlnv) const override final;
 
     /*! Get the items that have referenced the given vlnv in their meta data.
+     *
+     *  The documents referencing the vlnv directly are appended to the list once each.
      *
      *      @param [out] list           The search results.
      *      @param [in] vlnvToSearch    Identifies the item to search for.
@@ -257,6 +274,27 @@ public:
     */
     virtual bool isValid(VLNV const& vlnv) override final;
 
+    //! Statistics of the parsed document cache.
+    struct CacheStatistics
+    {
+        int hits = 0;               //!< Number of requests served from the cache.
+        int misses = 0;             //!< Number of requests that required reading the document.
+        int evictions = 0;          //!< Number of documents dropped to stay within the budget.
+        qint64 cachedSize = 0;      //!< Estimated memory use of the currently cached documents in bytes.
+    };
+
+    /*! Get the statistics of the parsed document cache.
+     *
+     *      @return The cache statistics.
+     */
+    CacheStatistics getCacheStatistics() const;
+
+    /*! Set the budget for the parsed documents. Documents over the budget are evicted immediately.
+     *
+     *      @param [in] budget  The estimated memory use of the parsed documents in bytes. Zero means unlimited.
+     */
+    void setCacheBudget(qint64 budget);
+
     HierarchyModel* getHierarchyModel();
 
     LibraryTreeModel* getTreeModel();
@@ -270,6 +308,18 @@ public slots:
     */
     virtual void onCheckLibraryIntegrity() override final;
 
+    /*! Keep the given document in the cache regardless of the memory budget, e.g. while it is open in an editor.
+     *
+     *      @param [in] vlnv    Identifies the document to pin.
+     */
+    void pinDocument(VLNV const& vlnv);
+
+    /*! Allow the given document to be evicted from the cache again.
+     *
+     *      @param [in] vlnv    Identifies the document to unpin.
+     */
+    void unpinDocument(VLNV const& vlnv);
+
     /*! Edit an item in the library
      *
      *      @param [in] vlnv Reference to the vlnv that identifies the object to edit.
@@ -489,8 +539,12 @@ private slots:
     */
     void onFileChangedOnDisk(QString const& path);
 
+    //! Starts reading the files changed on disk since the previous batch in the background.
     void handleFileChange();
 
+    //! Applies the read file changes to the library and updates the models once for the batch.
+    void applyFileChanges();
+
 private:
 
     //! All relevant data about an IP-XACT document is stored in DocumentInfo.
@@ -499,6 +553,10 @@ private:
         QSharedPointer<Document> document;  //<! The model for the document.
         QString path;                       //<! The path to the file containing the document.
         bool isValid;                       //<! Flag for well-formed content.
+        quint64 lastAccess = 0;             //<! Access counter value of the latest use of the document.
+        qint64 cachedSize = 0;              //<! Estimated memory use of the document model in bytes.
+        QWeakPointer<Document> evicted;     //<! The evicted model, as long as it is still used elsewhere.
+        QVector<QString> readErrors;        //<! Errors found in the latest read of the document file.
 
         //! Constructor.
         explicit DocumentInfo(QString const& filePath = QString(), 
@@ -520,6 +578,17 @@ private:
         bool noToAll = false;
     };
 
+    //! A file changed on disk, read in the background.
+    struct FileChange
+    {
+        QString path;                       //!< The path to the changed file.
+        bool removed = false;               //!< Flag for a file no longer on the disk.
+        QSharedPointer<Document> document;  //!< The document read from the file.
+        qint64 modelSize = 0;               //!< The estimated memory use of the document model.
+        QVector<QString> errors;            //!< The errors reported while reading the file.
+        QVector<QString> notices;           //!< The notices reported while reading the file.
+    };
+
     //-----------------------------------------------------------------------------
     // The private functions used by public class methods
     //-----------------------------------------------------------------------------
@@ -538,9 +607,64 @@ private:
     //! Show error message for VLNV not found in the library.
     void showNotFoundError(VLNV const& vlnv) const;
 
+    /*! Gets the cached instance of a document, reading it from the disk if it is not yet loaded.
+     *
+     *  The returned instance is shared with the library and must not be modified.
+     *
+     *      @param [in] vlnv    Identifies the desired document.
+     *
+     *      @return The cached document, or null if not found.
+     */
+    QSharedPointer<Document> getCachedDocument(VLNV const& vlnv);
+
+    /*! Stores the given document in the library cache, replacing any previous entry.
+     *
+     *      @param [in] vlnv        Identifies the document.
+     *      @param [in] path        The path to the document file.
+     *      @param [in] document    The parsed document.
+     *      @param [in] isValid     Flag for valid document.
+     *      @param [in] modelSize   The estimated memory use of the document, or negative if not known.
+     */
+    void cacheDocument(VLNV const& vlnv, QString const& path, QSharedPointer<Document> document, bool isValid,
+        qint64 modelSize = -1);
+
+    /*! Evicts the least recently used unpinned documents until the cache is within its budget.
+     *
+     *      @param [in] keptDocument    Document that must not be evicted.
+     *      @param [in] cacheLock       The caller's lock on the cache mutex.
+     */
+    void enforceCacheBudget(VLNV const& keptDocument, QMutexLocker const& cacheLock);
+
+    //! Rebuilds the hierarchy view, evicting the documents only after all of them have been read.
+    void resetHierarchyModel();
+
     //! Adds a IP-XACT document into the library cache.
     bool addObject(QSharedPointer<Document> model, QString const& filePath);
 
+    /*! Reads the changed files. Safe to call from a worker thread.
+     *
+     *      @param [in] paths   The paths to the changed files.
+     *
+     *      @return The changes in the same order as the paths.
+     */
+    static QVector<FileChange> readChangedFiles(QVector<QString> const& paths);
+
+    /*! Stores the VLNVs referenced by a document in the dependency graph and the library index.
+     *
+     *      @param [in] vlnv        Identifies the document.
+     *      @param [in] path        The path to the document file.
+     *      @param [in] document    The parsed document.
+     */
+    void updateDependencies(VLNV const& vlnv, QString const& path, QSharedPointer<const Document> document);
+
+    /*! Gets the VLNVs referenced by a document, reading the document only if they are not yet known.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *
+     *      @return The referenced VLNVs.
+     */
+    QList<VLNV> findDependencies(VLNV const& vlnv);
+
     //! Clears the library cache of documents.
     void clearCache();
 
@@ -679,6 +803,9 @@ private:
      */
     QMap<VLNV, DocumentInfo> documentCache_;
 
+    //! The VLNV references between the documents in the library.
+    LibraryDependencyGraph dependencyGraph_;
+
     //! Checks if the given string is a URL (invalids are allowed) or not.
     QRegularExpressionValidator urlTester_;
 
@@ -706,8 +833,36 @@ private:
     //! Statistics for library integrity check.
     DocumentStatistics checkResults_;
 
-    //! Queue for files updated on disk.
-    QVector<QString> updatedPaths_;
+    //! Files changed on disk since the previous batch.
+    QSet<QString> changedPaths_;
+
+    //! Collects the file changes into batches until the files have been quiet for a while.
+    QTimer fileChangeTimer_;
+
+    //! Reads a batch of changed files in the background.
+    QFutureWatcher<QVector<FileChange> > fileChangeReader_;
+
+    //! Budget for the parsed documents as their estimated memory use in bytes. Zero means unlimited.
+    qint64 cacheBudget_;
+
+    //! Estimated memory use of the currently parsed documents.
+    qint64 cachedSize_;
+
+    //! Flag for postponing the eviction during operations that read the whole library. Guarded by the cache mutex.
+    bool evictionDeferred_;
+
+    //! Counter for ordering the document accesses.
+    quint64 accessCounter_;
+
+    //! Pin counts of the documents that must not be evicted.
+    QMap<VLNV, int> pinnedDocuments_;
+
+    //! Statistics of the document cache.
+    CacheStatistics cacheStatistics_;
+
+    //! Guards the document cache, its size, access order, pins and statistics, since documents may be
+    //! requested from worker threads.
+    mutable QMutex cacheMutex_;
 };
 
 #endif // LIBRARYHANDLER_H
@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------------
+// File: LibraryIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Persistent index of the IP-XACT documents found in the library locations.
+//-----------------------------------------------------------------------------
+
+#include "LibraryIndex.h"
+
+#include <common/ChecksummedFile.h>
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace
+{
+    //! Identifier written in the beginning of every index file.
+    const quint32 INDEX_MAGIC = 0x4B32494E;
+
+    //! Format version of the index file. Increase whenever the stored content changes.
+    const quint32 INDEX_VERSION = 2;
+
+    //! Writes the given VLNV into a stream.
+    void writeVLNV(QDataStream& stream, VLNV const& vlnv)
+    {
+        stream << static_cast<qint32>(vlnv.getType()) << vlnv.getVendor() << vlnv.getLibrary() <<
+            vlnv.getName() << vlnv.getVersion();
+    }
+
+    //! Reads a VLNV from a stream.
+    VLNV readVLNV(QDataStream& stream)
+    {
+        qint32 type = VLNV::INVALID;
+        QString vendor;
+        QString library;
+        QString name;
+        QString version;
+        stream >> type >> vendor >> library >> name >> version;
+
+        if (type < VLNV::BUSDEFINITION || type > VLNV::INVALID)
+        {
+            stream.setStatus(QDataStream::ReadCorruptData);
+            return VLNV();
+        }
+
+        return VLNV(static_cast<VLNV::IPXactType>(type), vendor, library, name, version);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::load()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::load(QString const& location)
+{
+    QByteArray payload;
+    if (ChecksummedFile::read(indexFilePath(location), INDEX_MAGIC, INDEX_VERSION, payload) == false)
+    {
+        return false;
+    }
+
+    QDataStream payloadStream(payload);
+    payloadStream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 entryCount = 0;
+    payloadStream >> entryCount;
+
+    QHash<QString, Entry> loadedEntries;
+    for (quint32 i = 0; i < entryCount && payloadStream.status() == QDataStream::Ok; ++i)
+    {
+        QString relativePath;
+        Entry entry;
+        payloadStream >> relativePath >> entry.size >> entry.lastModified >> entry.contentHash >> entry.notice;
+        entry.vlnv = readVLNV(payloadStream);
+
+        quint32 dependencyCount = 0;
+        payloadStream >> entry.dependenciesKnown >> dependencyCount;
+        for (quint32 j = 0; j < dependencyCount && payloadStream.status() == QDataStream::Ok; ++j)
+        {
+            entry.dependencies.append(readVLNV(payloadStream));
+        }
+
+        loadedEntries.insert(QDir(location).absoluteFilePath(relativePath), entry);
+    }
+
+    if (payloadStream.status() != QDataStream::Ok)
+    {
+        return false;
+    }
+
+    for (auto it = loadedEntries.cbegin(); it != loadedEntries.cend(); ++it)
+    {
+        entries_.insert(it.key(), it.value());
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::save()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::save(QString const& location) const
+{
+    QDir locationDir(location);
+    QString const locationPath = locationDir.absolutePath() + QLatin1Char('/');
+
+    QByteArray payload;
+    QDataStream payloadStream(&payload, QIODevice::WriteOnly);
+    payloadStream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 entryCount = 0;
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it)
+    {
+        if (it.key().startsWith(locationPath))
+        {
+            entryCount++;
+        }
+    }
+
+    payloadStream << entryCount;
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it)
+    {
+        if (it.key().startsWith(locationPath) == false)
+        {
+            continue;
+        }
+
+        Entry const& entry = it.value();
+        payloadStream << locationDir.relativeFilePath(it.key()) << entry.size << entry.lastModified <<
+            entry.contentHash << entry.notice;
+        writeVLNV(payloadStream, entry.vlnv);
+
+        payloadStream << entry.dependenciesKnown << static_cast<quint32>(entry.dependencies.size());
+        for (VLNV const& dependency : entry.dependencies)
+        {
+            writeVLNV(payloadStream, dependency);
+        }
+    }
+
+    return ChecksummedFile::write(indexFilePath(location), INDEX_MAGIC, INDEX_VERSION, payload);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::clear()
+//-----------------------------------------------------------------------------
+void LibraryIndex::clear()
+{
+    entries_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::count()
+//-----------------------------------------------------------------------------
+int LibraryIndex::count() const
+{
+    return entries_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::findUpToDateEntry()
+//-----------------------------------------------------------------------------
+LibraryIndex::Entry const* LibraryIndex::findUpToDateEntry(QFileInfo const& fileInfo) const
+{
+    auto it = entries_.constFind(fileInfo.absoluteFilePath());
+    if (it == entries_.cend() || it->size != fileInfo.size() ||
+        it->lastModified != fileInfo.lastModified().toMSecsSinceEpoch())
+    {
+        return nullptr;
+    }
+
+    return &it.value();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::entry()
+//-----------------------------------------------------------------------------
+LibraryIndex::Entry LibraryIndex::entry(QString const& path) const
+{
+    return entries_.value(path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::insert()
+//-----------------------------------------------------------------------------
+void LibraryIndex::insert(QString const& path, Entry const& entry)
+{
+    entries_.insert(path, entry);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::setDependencies()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::setDependencies(QString const& path, QList<VLNV> const& dependencies)
+{
+    auto it = entries_.find(path);
+    if (it == entries_.end() || (it->dependenciesKnown && it->dependencies == dependencies))
+    {
+        return false;
+    }
+
+    it->dependencies = dependencies;
+    it->dependenciesKnown = true;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::calculateHash()
+//-----------------------------------------------------------------------------
+QByteArray LibraryIndex::calculateHash(QString const& path)
+{
+    QFile file(path);
+    if (file.open(QIODevice::ReadOnly) == false)
+    {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+
+    return hash.result();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::indexFilePath()
+//-----------------------------------------------------------------------------
+QString LibraryIndex::indexFilePath(QString const& location)
+{
+    return ChecksummedFile::cacheFilePath(QStringLiteral("libraryIndex"), QDir(location).absolutePath(),
+        QStringLiteral(".idx"));
+}
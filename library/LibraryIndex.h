@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------
+// File: LibraryIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Persistent index of the IP-XACT documents found in the library locations.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYINDEX_H
+#define LIBRARYINDEX_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QString>
+
+class QFileInfo;
+
+//-----------------------------------------------------------------------------
+//! Persistent index of the IP-XACT documents found in the library locations.
+//
+// The index is stored separately for each library location in the user cache directory. A file whose size
+// and modification time match the indexed values does not need to be read again on startup.
+//-----------------------------------------------------------------------------
+class LibraryIndex
+{
+public:
+
+    //! Indexed information of a single file.
+    struct Entry
+    {
+        qint64 size = -1;                   //!< The file size in bytes.
+        qint64 lastModified = 0;            //!< The modification time in ms since epoch.
+        QByteArray contentHash;             //!< Hash of the file content.
+        QString notice;                     //!< The reason for skipping the file, empty if not skipped.
+        VLNV vlnv;                          //!< The VLNV of the document, invalid if not IP-XACT.
+        QList<VLNV> dependencies;           //!< The VLNVs the document depends on.
+        bool dependenciesKnown = false;     //!< Flag for dependencies read from the document.
+    };
+
+	//! The constructor.
+    LibraryIndex() = default;
+
+	//! The destructor.
+    ~LibraryIndex() = default;
+
+    /*! Loads the stored index of the given library location.
+     *
+     *  A missing, outdated or corrupted index is discarded and the location will be scanned in full.
+     *
+     *      @param [in] location    The library location whose index to load.
+     *
+     *      @return True, if the index was loaded, otherwise false.
+     */
+    bool load(QString const& location);
+
+    /*! Stores the index entries within the given library location.
+     *
+     *      @param [in] location    The library location whose index to store.
+     *
+     *      @return True, if the index was stored, otherwise false.
+     */
+    bool save(QString const& location) const;
+
+    //! Removes all entries from the index.
+    void clear();
+
+    //! Gets the number of entries in the index.
+    int count() const;
+
+    /*! Finds the entry for the given file, if the file has not changed since indexing.
+     *
+     *      @param [in] fileInfo    The current information of the file.
+     *
+     *      @return Pointer to the entry or nullptr, if the file is not indexed or has changed.
+     */
+    Entry const* findUpToDateEntry(QFileInfo const& fileInfo) const;
+
+    /*! Gets the entry for the given file regardless of its state on the disk.
+     *
+     *      @param [in] path    The absolute path to the file.
+     *
+     *      @return The indexed entry, or an empty entry if the file is not indexed.
+     */
+    Entry entry(QString const& path) const;
+
+    /*! Adds or replaces the entry for the given file.
+     *
+     *      @param [in] path    The absolute path to the file.
+     *      @param [in] entry   The entry to store.
+     */
+    void insert(QString const& path, Entry const& entry);
+
+    /*! Sets the dependencies of an indexed file.
+     *
+     *      @param [in] path            The absolute path to the file.
+     *      @param [in] dependencies    The VLNVs the document in the file depends on.
+     *
+     *      @return True, if the indexed dependencies changed, otherwise false.
+     */
+    bool setDependencies(QString const& path, QList<VLNV> const& dependencies);
+
+    /*! Calculates the content hash for the given file.
+     *
+     *      @param [in] path    The path to the file.
+     *
+     *      @return The content hash, or empty if the file could not be read.
+     */
+    static QByteArray calculateHash(QString const& path);
+
+private:
+
+    /*! Gets the path to the index file of the given library location.
+     *
+     *      @param [in] location    The library location.
+     *
+     *      @return Path to the index file.
+     */
+    static QString indexFilePath(QString const& location);
+
+    //! The indexed entries by absolute file path.
+    QHash<QString, Entry> entries_;
+};
+
+#endif // LIBRARYINDEX_H
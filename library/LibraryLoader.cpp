@@ -11,18 +11,29 @@
 
 #include "LibraryLoader.h"
 
+#include <QDateTime>
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
 #include <QSettings>
 #include <QXmlStreamReader>
 
+#include <QtConcurrent>
+
+namespace
+{
+    //! Number of scanned files between progress reports.
+    const int PROGRESS_INTERVAL = 256;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::LibraryLoader()
 //-----------------------------------------------------------------------------
 LibraryLoader::LibraryLoader(MessageMediator* messageChannel) : 
     messageChannel_(messageChannel),
-    fileAccess_(messageChannel)
+    fileAccess_(messageChannel),
+    cancelRequested_(0),
+    indexDirty_(false)
 {
 
 }
@@ -30,32 +41,136 @@ LibraryLoader::LibraryLoader(MessageMediator* messageChannel) :
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::parseLibrary()
 //-----------------------------------------------------------------------------
-QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary()
+QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(ProgressCallback const& reportProgress)
 {
-    QVector<LoadTarget> vlnvPaths;
-    QStringList xmlFilter(QLatin1String("*.xml"));
+    cancelRequested_.storeRelease(0);
+
+    QStringList locations = QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList();
 
-    QStringList locations = QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList();    
+    index_.clear();
     for (QString const& location : locations)
-    {        
-        QDirIterator fileIterator(location, xmlFilter, QDir::Files,
-            QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+    {
+        index_.load(location);
+    }
 
-        while (fileIterator.hasNext())
+    QStringList filePaths = findDocumentFiles(locations);
+
+    // The files are read in the global thread pool, but the results are collected in the order of the paths.
+    DocumentScanner scanner;
+    scanner.index = &index_;
+    QFuture<ScanResult> scan = QtConcurrent::mapped(filePaths, scanner);
+
+    QVector<LoadTarget> vlnvPaths;
+    LibraryIndex updatedIndex;
+    int changedCount = 0;
+
+    int const fileCount = filePaths.size();
+    for (int i = 0; i < fileCount; ++i)
+    {
+        if (i % PROGRESS_INTERVAL == 0 && reportProgress && reportProgress(i, fileCount) == false)
         {
-            QString filePath(fileIterator.next());
+            cancelScan();
+        }
 
-            VLNV vlnv = getDocumentVLNV(filePath);
-            if (vlnv.isValid())
+        if (cancelRequested_.loadAcquire() != 0)
+        {
+            scan.cancel();
+            scan.waitForFinished();
+            return vlnvPaths;
+        }
+
+        ScanResult const result = scan.resultAt(i);
+        if (result.error.isEmpty() == false)
+        {
+            messageChannel_->showError(result.error);
+        }
+        else
+        {
+            updatedIndex.insert(result.target.path, result.entry);
+
+            if (result.indexed == false)
             {
-                vlnvPaths.append(LoadTarget(vlnv, filePath));
+                changedCount++;
             }
         }
+
+        if (result.notice.isEmpty() == false)
+        {
+            messageChannel_->showMessage(result.notice);
+        }
+
+        if (result.target.vlnv.isValid())
+        {
+            vlnvPaths.append(result.target);
+        }
+    }
+
+    // The index is rewritten only if files were added, changed or removed. Files no longer in the library
+    // and files that could not be read are dropped from the index. As the unchanged entries are taken from
+    // the old index, it has changed only if new entries were added or old ones left out.
+    indexDirty_ = indexDirty_ || changedCount != 0 || updatedIndex.count() != index_.count();
+    index_ = updatedIndex;
+    saveIndex();
+
+    if (reportProgress)
+    {
+        reportProgress(fileCount, fileCount);
     }
 
     return vlnvPaths;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::cancelScan()
+//-----------------------------------------------------------------------------
+void LibraryLoader::cancelScan()
+{
+    cancelRequested_.storeRelease(1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::setDependencies()
+//-----------------------------------------------------------------------------
+void LibraryLoader::setDependencies(QString const& path, QList<VLNV> const& dependencies)
+{
+    if (index_.setDependencies(path, dependencies))
+    {
+        indexDirty_ = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::findDependencies()
+//-----------------------------------------------------------------------------
+bool LibraryLoader::findDependencies(QString const& path, QList<VLNV>& dependencies) const
+{
+    LibraryIndex::Entry const indexed = index_.entry(path);
+    if (indexed.dependenciesKnown)
+    {
+        dependencies = indexed.dependencies;
+    }
+
+    return indexed.dependenciesKnown;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::saveIndex()
+//-----------------------------------------------------------------------------
+void LibraryLoader::saveIndex()
+{
+    if (indexDirty_ == false)
+    {
+        return;
+    }
+
+    for (QString const& location : QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList())
+    {
+        index_.save(location);
+    }
+
+    indexDirty_ = false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::clean()
 //-----------------------------------------------------------------------------
@@ -69,16 +184,89 @@ void LibraryLoader::clean(QStringList const& changedDirectories) const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::findDocumentFiles()
+//-----------------------------------------------------------------------------
+QStringList LibraryLoader::findDocumentFiles(QStringList const& locations) const
+{
+    QStringList filePaths;
+    QStringList xmlFilter(QLatin1String("*.xml"));
+
+    for (QString const& location : locations)
+    {
+        QStringList locationPaths;
+
+        QDirIterator fileIterator(location, xmlFilter, QDir::Files,
+            QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+
+        while (fileIterator.hasNext())
+        {
+            fileIterator.next();
+            locationPaths.append(fileIterator.fileInfo().absoluteFilePath());
+        }
+
+        // Iteration order depends on the file system, so sort to find duplicate VLNVs in a fixed order.
+        locationPaths.sort();
+        filePaths.append(locationPaths);
+    }
+
+    return filePaths;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::DocumentScanner::operator()()
+//-----------------------------------------------------------------------------
+LibraryLoader::ScanResult LibraryLoader::DocumentScanner::operator()(QString const& path) const
+{
+    QFileInfo fileInfo(path);
+
+    // Unchanged files are taken from the index without opening them. Skipped files are reported again.
+    LibraryIndex::Entry const* indexedEntry = index->findUpToDateEntry(fileInfo);
+    if (indexedEntry != nullptr)
+    {
+        ScanResult result;
+        result.target = LoadTarget(indexedEntry->vlnv, path);
+        result.notice = indexedEntry->notice;
+        result.entry = *indexedEntry;
+        result.indexed = true;
+        return result;
+    }
+
+    ScanResult result = getDocumentVLNV(path);
+    if (result.error.isEmpty())
+    {
+        result.target.path = path;
+        result.entry.size = fileInfo.size();
+        result.entry.lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
+        result.entry.contentHash = LibraryIndex::calculateHash(path);
+        result.entry.vlnv = result.target.vlnv;
+        result.entry.notice = result.notice;
+
+        // A touched but otherwise unchanged file keeps its known dependencies.
+        LibraryIndex::Entry previousEntry = index->entry(path);
+        if (previousEntry.dependenciesKnown && previousEntry.contentHash == result.entry.contentHash &&
+            previousEntry.vlnv == result.entry.vlnv)
+        {
+            result.entry.dependencies = previousEntry.dependencies;
+            result.entry.dependenciesKnown = true;
+        }
+    }
+
+    return result;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::getDocumentVLNV()
 //-----------------------------------------------------------------------------
-VLNV LibraryLoader::getDocumentVLNV(QString const& path)
+LibraryLoader::ScanResult LibraryLoader::getDocumentVLNV(QString const& path)
 {
+    ScanResult result;
+
     QFile documentFile(path);
     if (!documentFile.open(QFile::ReadOnly))
     {
-        messageChannel_->showError(QObject::tr("File %1 could not be read.").arg(path));
-        return VLNV();
+        result.error = QObject::tr("File %1 could not be read.").arg(path);
+        return result;
     }
 
     QXmlStreamReader documentReader(&documentFile);
@@ -87,10 +275,10 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path)
     QString type = documentReader.qualifiedName().toString();
     if (type.startsWith(QLatin1String("spirit:")))
     {
-        messageChannel_->showMessage(QObject::tr("File %1 contains an IP-XACT description not compatible "
-            "with the 1685-2014 standard and could not be read.").arg(path));
+        result.notice = QObject::tr("File %1 contains an IP-XACT description not compatible "
+            "with the 1685-2014 standard and could not be read.").arg(path);
         documentFile.close();
-        return VLNV();
+        return result;
     }
 
     // Find the first element of the VLVN.
@@ -113,7 +301,8 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path)
     
     documentFile.close();
 
-    return VLNV(type, vendor, library, name, version);
+    result.target = LoadTarget(VLNV(type, vendor, library, name, version), path);
+    return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -13,12 +13,17 @@
 #define LIBRARYLOADER_H
 
 #include "DocumentFileAccess.h"
+#include "LibraryIndex.h"
 
 #include <common/ui/MessageMediator.h>
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QAtomicInt>
 #include <QObject>
+#include <QStringList>
+
+#include <functional>
 
 class LibraryLoader 
 {
@@ -50,21 +55,87 @@ public:
 	*/
     void clean(QStringList const& changedDirectories) const;
 
+    /*! Callback for reporting scan progress.
+    *
+    *      @param [in] scannedFiles    The number of files scanned so far.
+    *      @param [in] totalFiles      The total number of files to scan.
+    *
+    *      @return False, if the scan should be cancelled, otherwise true.
+    */
+    using ProgressCallback = std::function<bool(int scannedFiles, int totalFiles)>;
+
 	/*! Searches for IP-XACT files and returns any found targets.
 	*
-	*      @return The found IP-XACT targets.
+	*  The files are read concurrently, but the targets are always returned in the same order as
+	*  in a sequential scan of the sorted library locations.
+	*
+	*      @param [in] reportProgress  Optional callback for progress reporting and cancellation.
+	*
+	*      @return The found IP-XACT targets. If the scan is cancelled, the targets found so far.
 	*/
-    QVector<LoadTarget> parseLibrary();
+    QVector<LoadTarget> parseLibrary(ProgressCallback const& reportProgress = ProgressCallback());
+
+    /*! Requests an ongoing library scan to stop. Can be called from any thread.
+    */
+    void cancelScan();
+
+    /*! Sets the dependencies of a document in the library index.
+    *
+    *      @param [in] path            Path to the document file.
+    *      @param [in] dependencies    The VLNVs the document depends on.
+    */
+    void setDependencies(QString const& path, QList<VLNV> const& dependencies);
+
+    /*! Finds the dependencies of a document stored in the library index.
+    *
+    *      @param [in]  path            Path to the document file.
+    *      @param [out] dependencies    The VLNVs the document depends on.
+    *
+    *      @return True, if the dependencies were known, otherwise false.
+    */
+    bool findDependencies(QString const& path, QList<VLNV>& dependencies) const;
+
+    //! Stores the library index of the active library locations, if it has changed since it was stored.
+    void saveIndex();
 
 private:
 
-    /*! Finds the VLNV in the given file.
+    //! Result of reading the header of a single file.
+    struct ScanResult
+    {
+        LoadTarget target;          //!< The found target, if any.
+        QString error;              //!< Error encountered while reading the file.
+        QString notice;             //!< Notice to show for the file.
+        LibraryIndex::Entry entry;  //!< The index entry for the file.
+        bool indexed = false;       //!< Flag for a result taken from the index.
+    };
+
+    //! Function object for scanning a single file in the thread pool.
+    struct DocumentScanner
+    {
+        using result_type = ScanResult;
+
+        //! The library index to check for unchanged files. Only read during the scan.
+        LibraryIndex const* index = nullptr;
+
+        ScanResult operator()(QString const& path) const;
+    };
+
+    /*! Finds all the candidate IP-XACT files in the given locations.
+    *
+    *      @param [in] locations   The library locations to search.
+    *
+    *      @return Paths to the candidate files.
+    */
+    QStringList findDocumentFiles(QStringList const& locations) const;
+
+    /*! Finds the VLNV in the given file. Safe to call concurrently for different files.
     *
     *      @param [in]		path	The file path to search.
     *
-    *      @return The VLNV found in the given file.
+    *      @return The VLNV found in the given file with any messages for the user.
     */
-    VLNV getDocumentVLNV(QString const& path);
+    static ScanResult getDocumentVLNV(QString const& path);
 
     /*! Clear the empty directories from the disk within given path.
      *
@@ -87,6 +158,15 @@ private:
 
     //! Utilities for file access.
     DocumentFileAccess fileAccess_;
+
+    //! Index of the files in the library locations.
+    LibraryIndex index_;
+
+    //! Flag for requesting the ongoing scan to stop.
+    QAtomicInt cancelRequested_;
+
+    //! Flag for index changes not yet stored.
+    bool indexDirty_;
 };
 
 Q_DECLARE_TYPEINFO(LibraryLoader::LoadTarget, Q_MOVABLE_TYPE);
@@ -156,8 +156,8 @@ void parseProgrammableElementsV2(LibraryInterface* lh, VLNV designVLNV,
     {
         if (!instance->isDraft())
         {
-            QSharedPointer<Document> libComp = lh->getModel(*instance->getComponentRef());
-            QSharedPointer<Component> childComp = libComp.staticCast<Component>();
+            QSharedPointer<Document const> libComp = lh->getModelReadOnly(*instance->getComponentRef());
+            QSharedPointer<Component const> childComp = libComp.staticCast<Component const>();
 
             if (childComp)
             {
@@ -243,8 +243,8 @@ void addNewInstancesV2(LibraryInterface* lh, QList<QSharedPointer<ComponentInsta
             {
                 QSharedPointer<ConfigurableVLNVReference> ref = instance->getComponentRef();
 
-                QSharedPointer<Document> componentDoc = lh->getModel(*ref.data());
-                QSharedPointer<Component> swComponent = componentDoc.dynamicCast<Component>();
+                QSharedPointer<Document const> componentDoc = lh->getModelReadOnly(*ref.data());
+                QSharedPointer<Component const> swComponent = componentDoc.dynamicCast<Component const>();
 
                 // Only software components are applicable in this loop.
                 if (!instance->isDraft() &&
@@ -372,8 +372,8 @@ void updateSystemDesignV2(LibraryInterface* lh, VLNV const& hwDesignVLNV, Design
     {
         QSharedPointer<ConfigurableVLNVReference> ref = hwInstance->getComponentRef();
 
-        QSharedPointer<Document> componentDoc = lh->getModel(*ref.data());
-        QSharedPointer<Component> hwComponent = componentDoc.dynamicCast<Component>();
+        QSharedPointer<Document const> componentDoc = lh->getModelReadOnly(*ref.data());
+        QSharedPointer<Component const> hwComponent = componentDoc.dynamicCast<Component const>();
 
         // Only hardware components are applicable in this loop.
         if (!hwComponent || hwComponent->getImplementation() != KactusAttribute::HW)
@@ -430,8 +430,8 @@ void updateSystemDesignV2(LibraryInterface* lh, VLNV const& hwDesignVLNV, Design
     {
         QSharedPointer<ConfigurableVLNVReference> ref = swInstance->getComponentRef();
 
-        QSharedPointer<Document> componentDoc = lh->getModel(*ref.data());
-        QSharedPointer<Component> swComponent = componentDoc.dynamicCast<Component>();
+        QSharedPointer<Document const> componentDoc = lh->getModelReadOnly(*ref.data());
+        QSharedPointer<Component const> swComponent = componentDoc.dynamicCast<Component const>();
 
         // Only software components are applicable in this loop.
         if (!swInstance->isDraft() &&
@@ -477,8 +477,8 @@ void updateSystemDesignV2(LibraryInterface* lh, VLNV const& hwDesignVLNV, Design
             {
                 QSharedPointer<ConfigurableVLNVReference> ref = swInstance->getComponentRef();
 
-                QSharedPointer<Document> componentDoc = lh->getModel(*ref.data());
-                QSharedPointer<Component> swComponent = componentDoc.dynamicCast<Component>();
+                QSharedPointer<Document const> componentDoc = lh->getModelReadOnly(*ref.data());
+                QSharedPointer<Component const> swComponent = componentDoc.dynamicCast<Component const>();
 
                 // Only software components are applicable in this loop.
                 if (!swInstance->isDraft() &&
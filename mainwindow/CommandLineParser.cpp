@@ -14,9 +14,14 @@
 #include <common/ui/MessageMediator.h>
 #include <common/KactusAPI.h>
 
+#include <library/LibraryBatchValidator.h>
+#include <library/LibraryHandler.h>
+
 #include <QCoreApplication>
 #include <QCommandLineParser>
+#include <QFile>
 #include <QStringList>
+#include <QThread>
 
 //-----------------------------------------------------------------------------
 // Function: CommandLineParser::CommandLineParser()
@@ -29,6 +34,21 @@ CommandLineParser::CommandLineParser() : optionParser_(), preReadDone_(false)
     QCommandLineOption interactiveOption({ "c", "no-gui" }, "Run in command-line mode.");
 
     optionParser_.addOption(interactiveOption);
+
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("validate"),
+        QStringLiteral("Validate the library documents without user interface and exit.")));
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("vlnv"),
+        QStringLiteral("Validate only documents matching the VLNV prefix vendor[:library[:name[:version]]]."),
+        QStringLiteral("prefix")));
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("report-format"),
+        QStringLiteral("Format of the validation report: json or junit."), QStringLiteral("format"),
+        QStringLiteral("json")));
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("report"),
+        QStringLiteral("Write the validation report to the given file instead of standard output."),
+        QStringLiteral("file")));
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("jobs"),
+        QStringLiteral("Number of parallel validation workers."), QStringLiteral("count"),
+        QString::number(QThread::idealThreadCount())));
 }
 
 //-----------------------------------------------------------------------------
@@ -48,6 +68,14 @@ bool CommandLineParser::commandlineMode() const
     return optionParser_.isSet(QStringLiteral("no-gui"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::validationMode()
+//-----------------------------------------------------------------------------
+bool CommandLineParser::validationMode() const
+{
+    return optionParser_.isSet(QStringLiteral("validate"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: CommandLineParser::process()
 //-----------------------------------------------------------------------------
@@ -69,5 +97,75 @@ int CommandLineParser::process(QStringList const& arguments, MessageMediator* me
     }
 
     optionParser_.process(arguments);
+
+    if (validationMode())
+    {
+        return runValidation(messageChannel);
+    }
+
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::runValidation()
+//-----------------------------------------------------------------------------
+int CommandLineParser::runValidation(MessageMediator* messageChannel)
+{
+    QString const format = optionParser_.value(QStringLiteral("report-format")).toLower();
+    if (format != QLatin1String("json") && format != QLatin1String("junit"))
+    {
+        messageChannel->showError(QStringLiteral("Unknown report format %1.").arg(format));
+        return 1;
+    }
+
+    bool jobsValid = false;
+    int const jobs = optionParser_.value(QStringLiteral("jobs")).toInt(&jobsValid);
+    if (jobsValid == false || jobs < 1)
+    {
+        messageChannel->showError(QStringLiteral("Invalid number of jobs %1.").arg(
+            optionParser_.value(QStringLiteral("jobs"))));
+        return 1;
+    }
+
+    // The documents are validated in the batch, so only the index of the library is loaded.
+    LibraryHandler* library = LibraryHandler::getInstance();
+    library->loadLibraryIndex();
+
+    QList<VLNV> documents = LibraryBatchValidator::selectDocuments(library->getAllVLNVs(),
+        optionParser_.value(QStringLiteral("vlnv")));
+
+    LibraryBatchValidator validator(library);
+    QVector<LibraryBatchValidator::DocumentResult> results = validator.validate(documents, jobs);
+
+    QByteArray report = format == QLatin1String("junit") ?
+        LibraryBatchValidator::toJUnit(results) : LibraryBatchValidator::toJson(results);
+
+    QFile output;
+    QString const reportPath = optionParser_.value(QStringLiteral("report"));
+    if (reportPath.isEmpty())
+    {
+        output.open(stdout, QIODevice::WriteOnly);
+    }
+    else
+    {
+        output.setFileName(reportPath);
+        if (output.open(QIODevice::WriteOnly | QIODevice::Truncate) == false)
+        {
+            messageChannel->showError(QStringLiteral("Could not open file %1 for writing.").arg(reportPath));
+            return 1;
+        }
+    }
+
+    output.write(report);
+    output.close();
+
+    for (LibraryBatchValidator::DocumentResult const& result : results)
+    {
+        if (result.errors.isEmpty() == false)
+        {
+            return 1;
+        }
+    }
+
     return 0;
 }
@@ -46,6 +46,13 @@ public:
      */
     bool commandlineMode() const;
 
+    /*!
+     *  Checks if the batch validation option is set.
+     *
+     *      @return True, if batch validation option is set, otherwise false.
+     */
+    bool validationMode() const;
+
     /*!
      *  Processes the given command line arguments and executes accordingly.
      *
@@ -65,6 +72,15 @@ private:
      */
     QString helpText();
 
+    /*!
+     *  Validates the library documents selected with the command line options and writes the report.
+     *
+     *      @param [in] messageChannel  Interface for output and error messages.
+     *
+     *      @return 0 if all the selected documents are valid, otherwise 1.
+     */
+    int runValidation(MessageMediator* messageChannel);
+
     // Parser for command-line options.
     QCommandLineParser optionParser_;   
 
@@ -70,6 +70,8 @@ void DrawingBoard::addAndOpenDocument(TabDocument* doc)
 
     addTab(doc, doc->getTitle());
     setCurrentWidget(doc);
+
+    emit documentOpened(doc->getDocumentVLNV());
 }
 
 //-----------------------------------------------------------------------------
@@ -251,6 +253,7 @@ void DrawingBoard::closeAndRemoveDocument(int index)
     // Using removeTab() triggers showEvent() in the next tab before deleted() 
     // triggers MainWindow::onClearItemSelection. This wrong order of triggers would cause the instance 
     // details editor in design editor to appear empty for a previously selected component.
+    emit documentClosed(document->getDocumentVLNV());
     delete document;
     document = 0;
 
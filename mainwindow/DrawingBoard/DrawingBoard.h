@@ -12,6 +12,8 @@
 #ifndef DRAWINGBOARD_H
 #define DRAWINGBOARD_H
 
+#include <IPXACTmodels/common/VLNV.h>
+
 #include <QTabWidget>
 
 class TabDocument;
@@ -116,6 +118,12 @@ signals:
     //! Emitted when the last document has been closed.
     void lastDocumentClosed();
 
+    //! Emitted when a document has been opened for editing.
+    void documentOpened(VLNV const& vlnv);
+
+    //! Emitted when a document is closed.
+    void documentClosed(VLNV const& vlnv);
+
 private slots:
 
     //! Called when the title of a document changes.
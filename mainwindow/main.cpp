@@ -103,12 +103,17 @@ namespace
     //-----------------------------------------------------------------------------
     // Function: createMessageMediator()
     //-----------------------------------------------------------------------------
-    MessageMediator* createMessageMediator(int argc)
+    MessageMediator* createMessageMediator(int argc, bool reportMode)
     {
         if (startGui(argc))
         {
             return new GraphicalMessageMediator();
         }
+        else if (reportMode)
+        {
+            // The report may be written to the standard output, so the messages must not go there.
+            return new ConsoleMediator(stderr);
+        }
         else
         {
             return new ConsoleMediator();
@@ -125,7 +130,16 @@ int main(int argc, char *argv[])
     Q_INIT_RESOURCE(kactus);
 
     QScopedPointer<QCoreApplication> application(createApplication(argc, argv));
-    QScopedPointer<MessageMediator> mediator(createMessageMediator(argc));
+
+    CommandLineParser parser;
+    bool reportMode = false;
+    if (!startGui(argc))
+    {
+        parser.readArguments(application->arguments());
+        reportMode = parser.validationMode();
+    }
+
+    QScopedPointer<MessageMediator> mediator(createMessageMediator(argc, reportMode));
 
     QSettings::setDefaultFormat(QSettings::IniFormat);
 
@@ -183,10 +197,14 @@ int main(int argc, char *argv[])
     else // Run console.
     {        
         QStringList arguments = application->arguments();
-        CommandLineParser parser;
 
-        parser.process(arguments, mediator.data());
-        
+        int const result = parser.process(arguments, mediator.data());
+
+        if (parser.validationMode())
+        {
+            return result;
+        }
+
         if (parser.commandlineMode())
         {
             library->searchForIPXactFiles();
@@ -921,6 +921,12 @@ void MainWindow::setupDrawBoard()
     connect(designTabs_, SIGNAL(documentContentChanged()), this, SLOT(updateMenuStrip()), Qt::UniqueConnection);
     connect(designTabs_, SIGNAL(documentEditStateChanged()), this, SLOT(updateMenuStrip()));
 
+    // Keep the documents open in editors in the library cache.
+    connect(designTabs_, SIGNAL(documentOpened(VLNV const&)),
+        libraryHandler_, SLOT(pinDocument(VLNV const&)), Qt::UniqueConnection);
+    connect(designTabs_, SIGNAL(documentClosed(VLNV const&)),
+        libraryHandler_, SLOT(unpinDocument(VLNV const&)), Qt::UniqueConnection);
+
     connect(designTabs_, SIGNAL(helpUrlRequested(QString const&)),
         this, SIGNAL(helpUrlRequested(QString const&)), Qt::UniqueConnection);
 
@@ -20,6 +20,7 @@ SUBDIRS += tst_CommandLineParser.pro \
 		   tst_ValueFormatter.pro \
 		   tst_ComponentParameterModel.pro \
 		   tst_ParameterReferenceTree.pro \
+		   tst_ComponentParameterReferenceCounter.pro \
 		   tst_VLNVComparator.pro \
 		   tst_ViewComparator.pro \
 		   tst_PortComparator.pro \
@@ -31,4 +32,8 @@ SUBDIRS += tst_CommandLineParser.pro \
 		   tst_HierarchicalSaveBuildStrategy.pro \
 		   tst_DocumentTreeBuilder.pro \
 		   tst_DocumentGenerator.pro \
-		   tst_MasterSlavePathSearch.pro
+		   tst_MasterSlavePathSearch.pro \
+		   tst_ComponentBenchmark.pro \
+		   tst_FileDependencyModel.pro \
+		   tst_FileAnalysisCache.pro \
+		   tst_FileDependencyItem.pro
@@ -0,0 +1,520 @@
+//-----------------------------------------------------------------------------
+// File: tst_ComponentBenchmark.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Benchmarks for expression parsing, validation, reference counting, copying and XML handling of large
+// components.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/common/ComponentParameterFinder.h>
+#include <editors/ComponentEditor/common/ExpressionFormatter.h>
+#include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/parameters/ParametersInterface.h>
+#include <editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/common/DirectionTypes.h>
+#include <IPXACTmodels/common/validators/ParameterValidator.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/ComponentReader.h>
+#include <IPXACTmodels/Component/ComponentWriter.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/validators/ComponentValidator.h>
+
+#include <QDomDocument>
+#include <QSharedPointer>
+#include <QXmlStreamWriter>
+
+class tst_ComponentBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ComponentBenchmark();
+
+private slots:
+
+    void benchmarkExpressionParsing();
+    void benchmarkExpressionParsing_data();
+
+    void benchmarkComponentValidation();
+    void benchmarkComponentValidation_data();
+
+    void benchmarkFindingComponentErrors();
+    void benchmarkFindingComponentErrors_data();
+
+    void benchmarkReferenceCountingByExpressionWalk();
+    void benchmarkReferenceCountingByExpressionWalk_data();
+
+    void benchmarkReferenceCountingByIndex();
+    void benchmarkReferenceCountingByIndex_data();
+
+    void benchmarkComponentWriting();
+    void benchmarkComponentWriting_data();
+
+    void benchmarkComponentReading();
+    void benchmarkComponentReading_data();
+
+    void benchmarkComponentCopying();
+    void benchmarkComponentCopying_data();
+
+private:
+
+    void addComponentSizes();
+
+    QSharedPointer<Component> createSyntheticComponent(int elementCount);
+
+    QByteArray writeComponent(QSharedPointer<Component> component);
+
+    QStringList sampleParameterIDs(int elementCount);
+};
+
+namespace
+{
+    //! The number of parameters referenced by all the other expressions.
+    const int BASE_PARAMETER_COUNT = 16;
+
+    //! The number of fields in each register.
+    const int FIELDS_PER_REGISTER = 8;
+
+    //! The number of registers in each address block.
+    const int REGISTERS_PER_BLOCK = 64;
+
+    //! The number of parameters whose references are counted in the reference counting benchmarks.
+    const int REFERENCE_SAMPLE_SIZE = 100;
+
+    //! Returns the ID of the parameter with the given index.
+    QString parameterID(int index)
+    {
+        return QStringLiteral("uuid_param_") + QString::number(index);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::tst_ComponentBenchmark()
+//-----------------------------------------------------------------------------
+tst_ComponentBenchmark::tst_ComponentBenchmark()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkExpressionParsing()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkExpressionParsing()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    IPXactSystemVerilogParser parser(finder);
+
+    QStringList expressions;
+    for (QSharedPointer<Parameter> parameter : *component->getParameters())
+    {
+        expressions.append(parameter->getValue());
+    }
+
+    for (QSharedPointer<Port> port : *component->getPorts())
+    {
+        expressions.append(port->getLeftBound());
+    }
+
+    int validCount = 0;
+    QBENCHMARK
+    {
+        validCount = 0;
+        for (QString const& expression : expressions)
+        {
+            bool isValid = false;
+            parser.parseExpression(expression, &isValid);
+            if (isValid)
+            {
+                validCount++;
+            }
+        }
+    }
+
+    QCOMPARE(validCount, expressions.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkExpressionParsing_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkExpressionParsing_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentValidation()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentValidation()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    QSharedPointer<ExpressionParser> parser(new IPXactSystemVerilogParser(finder));
+    ComponentValidator validator(parser, 0);
+
+    QBENCHMARK
+    {
+        validator.validate(component);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentValidation_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentValidation_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkFindingComponentErrors()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkFindingComponentErrors()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    QSharedPointer<ExpressionParser> parser(new IPXactSystemVerilogParser(finder));
+    ComponentValidator validator(parser, 0);
+
+    QBENCHMARK
+    {
+        QVector<QString> errors;
+        validator.findErrorsIn(errors, component);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkFindingComponentErrors_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkFindingComponentErrors_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkReferenceCountingByExpressionWalk()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkReferenceCountingByExpressionWalk()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+
+    QStringList const sampleIDs = sampleParameterIDs(elementCount);
+
+    int referenceCount = 0;
+    QBENCHMARK
+    {
+        referenceCount = 0;
+        for (QString const& id : sampleIDs)
+        {
+            referenceCount += counter.countReferencesInParameters(id, component->getParameters());
+            referenceCount += counter.countReferencesInMemoryMaps(id);
+            referenceCount += counter.countReferencesInPorts(id);
+        }
+    }
+
+    QVERIFY(referenceCount > 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkReferenceCountingByExpressionWalk_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkReferenceCountingByExpressionWalk_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkReferenceCountingByIndex()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkReferenceCountingByIndex()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+
+    QSharedPointer<ExpressionParser> parser(new IPXactSystemVerilogParser(finder));
+    QSharedPointer<ParameterValidator> validator(new ParameterValidator(parser, component->getChoices()));
+    QSharedPointer<ExpressionFormatter> formatter(new ExpressionFormatter(finder));
+
+    ParametersInterface parameterInterface(validator, parser, formatter);
+    parameterInterface.setParameters(component->getParameters());
+
+    QStringList const sampleIDs = sampleParameterIDs(elementCount);
+
+    QVector<QString> sampleNames;
+    for (QSharedPointer<Parameter> parameter : *component->getParameters())
+    {
+        if (sampleIDs.contains(parameter->getValueId()))
+        {
+            sampleNames.append(parameter->name());
+        }
+    }
+
+    int referenceCount = 0;
+    QBENCHMARK
+    {
+        // Each recalculation builds the index of the whole component.
+        counter.recalculateReferencesToParameters(sampleNames, &parameterInterface);
+
+        referenceCount = 0;
+        for (QString const& name : sampleNames)
+        {
+            referenceCount += parameterInterface.getUsageCount(name.toStdString());
+        }
+    }
+
+    QVERIFY(referenceCount > 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkReferenceCountingByIndex_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkReferenceCountingByIndex_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentWriting()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentWriting()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+
+    QByteArray output;
+    QBENCHMARK
+    {
+        output = writeComponent(component);
+    }
+
+    QVERIFY(output.isEmpty() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentWriting_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentWriting_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentReading()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentReading()
+{
+    QFETCH(int, elementCount);
+
+    QByteArray const content = writeComponent(createSyntheticComponent(elementCount));
+    ComponentReader reader;
+
+    QSharedPointer<Component> readComponent;
+    QBENCHMARK
+    {
+        QDomDocument document;
+        document.setContent(content);
+        readComponent = reader.createComponentFrom(document);
+    }
+
+    QVERIFY(readComponent.isNull() == false);
+    QCOMPARE(readComponent->getParameters()->size(), elementCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentReading_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentReading_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentCopying()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentCopying()
+{
+    QFETCH(int, elementCount);
+
+    QSharedPointer<Component> component = createSyntheticComponent(elementCount);
+
+    // The library makes this copy for every getModel() call, while getModelReadOnly() shares the model.
+    QSharedPointer<Document> copy;
+    QBENCHMARK
+    {
+        copy = component->clone();
+    }
+
+    QVERIFY(copy.isNull() == false);
+    QVERIFY(copy != component);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::benchmarkComponentCopying_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::benchmarkComponentCopying_data()
+{
+    addComponentSizes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::addComponentSizes()
+//-----------------------------------------------------------------------------
+void tst_ComponentBenchmark::addComponentSizes()
+{
+    QTest::addColumn<int>("elementCount");
+
+    QByteArray sizes = qgetenv("KACTUS2_BENCHMARK_SIZES");
+    if (sizes.isEmpty())
+    {
+        sizes = "10000";
+    }
+
+    for (QByteArray const& size : sizes.split(','))
+    {
+        int elementCount = size.trimmed().toInt();
+        if (elementCount >= BASE_PARAMETER_COUNT)
+        {
+            QTest::newRow(QByteArray::number(elementCount) + " elements") << elementCount;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::createSyntheticComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_ComponentBenchmark::createSyntheticComponent(int elementCount)
+{
+    QSharedPointer<Component> component(new Component(
+        VLNV(VLNV::COMPONENT, QStringLiteral("tuni.fi"), QStringLiteral("benchmark"),
+        QStringLiteral("synthetic"), QStringLiteral("1.0"))));
+
+    // The first parameters have constant values and all the other expressions refer to them.
+    for (int i = 0; i < elementCount; ++i)
+    {
+        QSharedPointer<Parameter> parameter(new Parameter());
+        parameter->setName(QStringLiteral("param_") + QString::number(i));
+        parameter->setValueId(parameterID(i));
+
+        if (i < BASE_PARAMETER_COUNT)
+        {
+            parameter->setValue(QString::number(i));
+        }
+        else
+        {
+            parameter->setValue(parameterID(i % BASE_PARAMETER_COUNT) + QStringLiteral("*2+") +
+                QString::number(i));
+        }
+
+        component->getParameters()->append(parameter);
+    }
+
+    for (int i = 0; i < elementCount; ++i)
+    {
+        QSharedPointer<Port> port(new Port(QStringLiteral("port_") + QString::number(i)));
+        port->setDirection(i % 2 == 0 ? DirectionTypes::IN : DirectionTypes::OUT);
+        port->setLeftBound(parameterID(7));
+        port->setRightBound(QStringLiteral("0"));
+
+        component->getPorts()->append(port);
+    }
+
+    // One field for each element, packed into 32-bit registers.
+    QSharedPointer<MemoryMap> memoryMap(new MemoryMap(QStringLiteral("memoryMap")));
+    component->getMemoryMaps()->append(memoryMap);
+
+    int const registerCount = qMax(1, elementCount / FIELDS_PER_REGISTER);
+    int const blockSize = REGISTERS_PER_BLOCK * 4;
+
+    QSharedPointer<AddressBlock> block;
+    for (int registerIndex = 0; registerIndex < registerCount; ++registerIndex)
+    {
+        if (registerIndex % REGISTERS_PER_BLOCK == 0)
+        {
+            int const blockIndex = registerIndex / REGISTERS_PER_BLOCK;
+            block = QSharedPointer<AddressBlock>(new AddressBlock(QStringLiteral("block_") +
+                QString::number(blockIndex), QString::number(blockIndex * blockSize)));
+            block->setRange(QString::number(blockSize));
+            block->setWidth(QStringLiteral("32"));
+
+            memoryMap->getMemoryBlocks()->append(block);
+        }
+
+        QSharedPointer<Register> targetRegister(new Register(QStringLiteral("register_") +
+            QString::number(registerIndex), QString::number((registerIndex % REGISTERS_PER_BLOCK) * 4)));
+        targetRegister->setSize(QStringLiteral("32"));
+
+        for (int fieldIndex = 0; fieldIndex < FIELDS_PER_REGISTER; ++fieldIndex)
+        {
+            QSharedPointer<Field> field(new Field(QStringLiteral("field_") + QString::number(fieldIndex)));
+            field->setBitOffset(QString::number(fieldIndex * 4));
+            field->setBitWidth(parameterID(4));
+
+            targetRegister->getFields()->append(field);
+        }
+
+        block->getRegisterData()->append(targetRegister);
+    }
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::writeComponent()
+//-----------------------------------------------------------------------------
+QByteArray tst_ComponentBenchmark::writeComponent(QSharedPointer<Component> component)
+{
+    QByteArray output;
+    QXmlStreamWriter xmlWriter(&output);
+
+    ComponentWriter componentWriter;
+    componentWriter.writeComponent(xmlWriter, component);
+
+    return output;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentBenchmark::sampleParameterIDs()
+//-----------------------------------------------------------------------------
+QStringList tst_ComponentBenchmark::sampleParameterIDs(int elementCount)
+{
+    QStringList sampleIDs;
+
+    int const step = qMax(1, elementCount / REFERENCE_SAMPLE_SIZE);
+    for (int i = 0; i < elementCount && sampleIDs.size() < REFERENCE_SAMPLE_SIZE; i += step)
+    {
+        sampleIDs.append(parameterID(i));
+    }
+
+    return sampleIDs;
+}
+
+QTEST_GUILESS_MAIN(tst_ComponentBenchmark)
+
+#include "tst_ComponentBenchmark.moc"
@@ -0,0 +1,50 @@
+#-----------------------------------------------------------------------------
+# File: tst_ComponentBenchmark.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: Kactus2 team
+# Date: 18.10.2026
+#
+# Description:
+# Qt project file for benchmarking expression parsing, validation, reference counting, copying and XML
+# handling of large components. Not run as a part of the unit tests.
+#
+# The benchmark sizes are given as a comma-separated list in KACTUS2_BENCHMARK_SIZES. Use the QTest
+# output options for machine-readable results, e.g. -o results.xml,xml or -o results.csv,csv.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ComponentBenchmark
+
+DEFINES+=KACTUS2_EXPORTS
+
+QT += core xml testlib
+QT -= gui widgets
+CONFIG += c++11 console
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ComponentBenchmark.pri)
@@ -0,0 +1,260 @@
+//-----------------------------------------------------------------------------
+// File: tst_ComponentParameterReferenceCounter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class ComponentParameterReferenceCounter.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/common/ComponentParameterFinder.h>
+#include <editors/ComponentEditor/common/ExpressionFormatter.h>
+#include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/parameters/ParametersInterface.h>
+#include <editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/common/validators/ParameterValidator.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/MasterInterface.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/Register.h>
+
+#include <QSharedPointer>
+
+class tst_ComponentParameterReferenceCounter : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ComponentParameterReferenceCounter();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testRecalculatedCountMatchesExpressionWalk();
+    void testRecalculatedCountMatchesExpressionWalk_data();
+
+    void testPrefixReferencesAreCountedAsInExpressionWalk();
+
+    void testRecalculationFollowsChangedExpressions();
+
+private:
+
+    QSharedPointer<Parameter> addParameter(QString const& name, QString const& id, QString const& value);
+
+    int countRecalculatedReferences(QString const& parameterName);
+
+    int countWalkedReferences(QString const& parameterID);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The component whose references are counted.
+    QSharedPointer<Component> component_;
+
+    //! The reference counter being tested.
+    QSharedPointer<ComponentParameterReferenceCounter> counter_;
+
+    //! Interface receiving the recalculated usage counts.
+    QSharedPointer<ParametersInterface> parameterInterface_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::tst_ComponentParameterReferenceCounter()
+//-----------------------------------------------------------------------------
+tst_ComponentParameterReferenceCounter::tst_ComponentParameterReferenceCounter():
+component_(),
+counter_(),
+parameterInterface_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::init()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterReferenceCounter::init()
+{
+    component_ = QSharedPointer<Component>(new Component(VLNV(VLNV::COMPONENT, "tuni.fi", "test", "counted", "1.0")));
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component_));
+    counter_ = QSharedPointer<ComponentParameterReferenceCounter>(
+        new ComponentParameterReferenceCounter(finder, component_));
+
+    QSharedPointer<ExpressionParser> parser(new IPXactSystemVerilogParser(finder));
+    QSharedPointer<ParameterValidator> validator(new ParameterValidator(parser, component_->getChoices()));
+    QSharedPointer<ExpressionFormatter> formatter(new ExpressionFormatter(finder));
+
+    parameterInterface_ = QSharedPointer<ParametersInterface>(new ParametersInterface(validator, parser, formatter));
+    parameterInterface_->setParameters(component_->getParameters());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::cleanup()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterReferenceCounter::cleanup()
+{
+    parameterInterface_.clear();
+    counter_.clear();
+    component_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::testRecalculatedCountMatchesExpressionWalk()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterReferenceCounter::testRecalculatedCountMatchesExpressionWalk()
+{
+    QFETCH(QString, parameterName);
+    QFETCH(QString, parameterID);
+    QFETCH(int, expectedCount);
+
+    addParameter("width", "uuid_width", "8");
+    addParameter("depth", "uuid_depth", "uuid_width*2");
+    addParameter("size", "uuid_size", "uuid_width*uuid_depth-1");
+    addParameter("unused", "uuid_unused", "4");
+
+    QSharedPointer<Port> port(new Port("data"));
+    port->setLeftBound("uuid_width-1");
+    port->setRightBound("0");
+    port->setArrayLeft("uuid_depth");
+    port->setArrayRight("0");
+    component_->getPorts()->append(port);
+
+    QSharedPointer<Field> field(new Field("enable"));
+    field->setBitOffset("0");
+    field->setBitWidth("uuid_width");
+
+    QSharedPointer<Register> control(new Register("control", "uuid_depth", "uuid_width"));
+    control->getFields()->append(field);
+
+    QSharedPointer<AddressBlock> block(new AddressBlock("registers", "uuid_width*4"));
+    block->setRange("uuid_size");
+    block->setWidth("32");
+    block->getRegisterData()->append(control);
+
+    QSharedPointer<MemoryMap> memoryMap(new MemoryMap("map"));
+    memoryMap->getMemoryBlocks()->append(block);
+    component_->getMemoryMaps()->append(memoryMap);
+
+    QSharedPointer<MasterInterface> master(new MasterInterface());
+    master->setBaseAddress("uuid_depth");
+
+    QSharedPointer<BusInterface> busInterface(new BusInterface());
+    busInterface->setName("bus");
+    busInterface->setMaster(master);
+    component_->getBusInterfaces()->append(busInterface);
+
+    QCOMPARE(countWalkedReferences(parameterID), expectedCount);
+    QCOMPARE(countRecalculatedReferences(parameterName), expectedCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::testRecalculatedCountMatchesExpressionWalk_data()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterReferenceCounter::testRecalculatedCountMatchesExpressionWalk_data()
+{
+    QTest::addColumn<QString>("parameterName");
+    QTest::addColumn<QString>("parameterID");
+    QTest::addColumn<int>("expectedCount");
+
+    QTest::newRow("references in parameters, port bounds and registers") << "width" << "uuid_width" << 6;
+    QTest::newRow("references in parameter, port array, register and bus interface") << "depth" <<
+        "uuid_depth" << 4;
+    QTest::newRow("reference in address block range") << "size" << "uuid_size" << 1;
+    QTest::newRow("parameter with constant value") << "unused" << "uuid_unused" << 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::testPrefixReferencesAreCountedAsInExpressionWalk()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterReferenceCounter::testPrefixReferencesAreCountedAsInExpressionWalk()
+{
+    addParameter("first", "uuid_1", "1");
+    addParameter("tenth", "uuid_10", "10");
+    addParameter("sum", "uuid_sum", "uuid_10+uuid_10");
+
+    // The IDs are counted as substrings, so the references to uuid_10 also count for uuid_1.
+    QCOMPARE(countWalkedReferences("uuid_1"), 2);
+    QCOMPARE(countWalkedReferences("uuid_10"), 2);
+
+    QCOMPARE(countRecalculatedReferences("first"), 2);
+    QCOMPARE(countRecalculatedReferences("tenth"), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::testRecalculationFollowsChangedExpressions()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterReferenceCounter::testRecalculationFollowsChangedExpressions()
+{
+    addParameter("width", "uuid_width", "8");
+    QSharedPointer<Parameter> depth = addParameter("depth", "uuid_depth", "uuid_width");
+
+    QCOMPARE(countRecalculatedReferences("width"), 1);
+
+    depth->setValue("uuid_width+uuid_width");
+    QCOMPARE(countRecalculatedReferences("width"), 2);
+
+    depth->setValue("2");
+    QCOMPARE(countRecalculatedReferences("width"), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::addParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> tst_ComponentParameterReferenceCounter::addParameter(QString const& name,
+    QString const& id, QString const& value)
+{
+    QSharedPointer<Parameter> parameter(new Parameter());
+    parameter->setName(name);
+    parameter->setValueId(id);
+    parameter->setValue(value);
+
+    component_->getParameters()->append(parameter);
+    return parameter;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::countRecalculatedReferences()
+//-----------------------------------------------------------------------------
+int tst_ComponentParameterReferenceCounter::countRecalculatedReferences(QString const& parameterName)
+{
+    counter_->recalculateReferencesToParameters(QVector<QString>({ parameterName }), parameterInterface_.data());
+
+    return parameterInterface_->getUsageCount(parameterName.toStdString());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterReferenceCounter::countWalkedReferences()
+//-----------------------------------------------------------------------------
+int tst_ComponentParameterReferenceCounter::countWalkedReferences(QString const& parameterID)
+{
+    int referenceCount = 0;
+    referenceCount += counter_->countReferencesInFileSets(parameterID);
+    referenceCount += counter_->countReferencesInParameters(parameterID, component_->getParameters());
+    referenceCount += counter_->countReferencesInMemoryMaps(parameterID);
+    referenceCount += counter_->countReferencesInAddressSpaces(parameterID);
+    referenceCount += counter_->countReferencesInInstantiations(parameterID);
+    referenceCount += counter_->countReferencesInPorts(parameterID);
+    referenceCount += counter_->countReferencesInBusInterfaces(parameterID);
+    referenceCount += counter_->countReferencesInRemapStates(parameterID);
+    referenceCount += counter_->countReferencesInIndirectInterfaces(parameterID);
+
+    return referenceCount;
+}
+
+QTEST_APPLESS_MAIN(tst_ComponentParameterReferenceCounter)
+
+#include "tst_ComponentParameterReferenceCounter.moc"
@@ -0,0 +1,32 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
+    ../../editors/ComponentEditor/common/ExpressionFormatter.h \
+    ../../editors/ComponentEditor/common/ExpressionParser.h \
+    ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
+    ../../editors/ComponentEditor/common/ParameterCache.h \
+    ../../editors/ComponentEditor/common/ParameterFinder.h \
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../editors/ComponentEditor/common/interfaces/CommonInterface.h \
+    ../../editors/ComponentEditor/common/interfaces/NameGroupInterface.h \
+    ../../editors/ComponentEditor/common/interfaces/ParameterizableInterface.h \
+    ../../editors/ComponentEditor/parameters/AbstractParameterInterface.h \
+    ../../editors/ComponentEditor/parameters/ParametersInterface.h \
+    ../../editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.h \
+    ../../editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.h \
+    ../../editors/ComponentEditor/referenceCounter/ReferenceCounter.h
+SOURCES += ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
+    ../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
+    ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
+    ../../editors/ComponentEditor/common/ParameterCache.cpp \
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../editors/ComponentEditor/common/interfaces/CommonInterface.cpp \
+    ../../editors/ComponentEditor/common/interfaces/NameGroupInterface.cpp \
+    ../../editors/ComponentEditor/common/interfaces/ParameterizableInterface.cpp \
+    ../../editors/ComponentEditor/parameters/AbstractParameterInterface.cpp \
+    ../../editors/ComponentEditor/parameters/ParametersInterface.cpp \
+    ../../editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.cpp \
+    ../../editors/ComponentEditor/referenceCounter/ParameterReferenceCounter.cpp \
+    ./tst_ComponentParameterReferenceCounter.cpp
@@ -0,0 +1,46 @@
+#-----------------------------------------------------------------------------
+# File: tst_ComponentParameterReferenceCounter.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: Kactus2 team
+# Date: 18.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for ComponentParameterReferenceCounter.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ComponentParameterReferenceCounter
+
+DEFINES+=KACTUS2_EXPORTS
+
+QT += core xml testlib
+QT -= gui widgets
+CONFIG += c++11 testcase console
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ComponentParameterReferenceCounter.pri)
@@ -0,0 +1,515 @@
+//-----------------------------------------------------------------------------
+// File: tst_FileAnalysisCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class FileAnalysisCache.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.h>
+
+#include <common/ChecksummedFile.h>
+
+#include <QTemporaryDir>
+
+namespace
+{
+    //! The analyzers used for the files.
+    const QString VHDL_ANALYZER = QStringLiteral("VHDL analyzer/1.0");
+    const QString VERILOG_ANALYZER = QStringLiteral("Verilog analyzer/1.0");
+}
+
+class tst_FileAnalysisCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_FileAnalysisCache();
+
+private slots:
+
+    void initTestCase();
+
+    void init();
+    void cleanup();
+
+    void testSavedCacheIsLoaded();
+    void testMissingCacheIsNotLoaded();
+    void testCacheOfOtherComponentIsNotLoaded();
+    void testCorruptedCacheIsDiscarded();
+    void testTruncatedCacheIsDiscarded();
+
+    void testUnchangedFileIsReused();
+    void testModifiedFileIsNotReused();
+    void testFileOfOtherAnalyzerIsNotReused();
+
+    void testDependenciesAreKeptForUnchangedFiles();
+    void testModifiedFileDropsDependenciesOfItsAnalyzerOnly();
+    void testAddedFileDropsDependenciesOfItsAnalyzerOnly();
+    void testRemovedFileDropsDependenciesOfItsAnalyzerOnly();
+    void testChangedAnalyzerDropsDependenciesOfBothAnalyzers();
+
+private:
+
+    QString createFile(QString const& name, QByteArray const& content);
+
+    FileAnalysisCache::Entry createEntry(QString const& path, QString const& analyzer,
+        QString const& dependency) const;
+
+    void populateCache(FileAnalysisCache& cache);
+
+    QString cacheFilePath() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The directory of the analyzed files.
+    QSharedPointer<QTemporaryDir> directory_;
+
+    //! Identifier of the analyzed component in each test.
+    QString componentKey_;
+
+    //! The analyzed VHDL files.
+    QString firstVhdl_;
+    QString secondVhdl_;
+
+    //! The analyzed Verilog file.
+    QString verilog_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::tst_FileAnalysisCache()
+//-----------------------------------------------------------------------------
+tst_FileAnalysisCache::tst_FileAnalysisCache():
+directory_(),
+componentKey_(),
+firstVhdl_(),
+secondVhdl_(),
+verilog_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::init()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::init()
+{
+    directory_ = QSharedPointer<QTemporaryDir>(new QTemporaryDir());
+    QVERIFY(directory_->isValid());
+
+    // The cache is stored by the component, so each test uses its own component.
+    componentKey_ = QStringLiteral("tuni.fi:test:analyzed:1.0|") + directory_->path() + "/analyzed.xml";
+
+    firstVhdl_ = createFile("first.vhd", "entity first is end;");
+    secondVhdl_ = createFile("second.vhd", "entity second is end;");
+    verilog_ = createFile("top.v", "module top; endmodule");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::cleanup()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::cleanup()
+{
+    QFile::remove(cacheFilePath());
+    directory_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testSavedCacheIsLoaded()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testSavedCacheIsLoaded()
+{
+    FileAnalysisCache savedCache;
+    QCOMPARE(savedCache.load(componentKey_), false);
+
+    FileAnalysisCache::Entry savedEntry = createEntry(firstVhdl_, VHDL_ANALYZER, "second.vhd");
+    savedEntry.dependencies.first().description = QStringLiteral("Instance of second");
+    savedCache.insert(firstVhdl_, savedEntry);
+    savedCache.insert(verilog_, createEntry(verilog_, VERILOG_ANALYZER, QString()));
+    QVERIFY(savedCache.save());
+
+    FileAnalysisCache loadedCache;
+    QVERIFY(loadedCache.load(componentKey_));
+
+    FileAnalysisCache::Entry const* loadedEntry =
+        loadedCache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER);
+    QVERIFY(loadedEntry != nullptr);
+    QCOMPARE(loadedEntry->size, savedEntry.size);
+    QCOMPARE(loadedEntry->lastModified, savedEntry.lastModified);
+    QCOMPARE(loadedEntry->analyzer, VHDL_ANALYZER);
+    QCOMPARE(loadedEntry->hash, savedEntry.hash);
+    QCOMPARE(loadedEntry->dependenciesKnown, true);
+    QCOMPARE(loadedEntry->dependencies.size(), 1);
+    QCOMPARE(loadedEntry->dependencies.first().filename, QString("second.vhd"));
+    QCOMPARE(loadedEntry->dependencies.first().description, QString("Instance of second"));
+
+    FileAnalysisCache::Entry const* verilogEntry =
+        loadedCache.findUpToDateEntry(QFileInfo(verilog_), VERILOG_ANALYZER);
+    QVERIFY(verilogEntry != nullptr);
+    QVERIFY(verilogEntry->dependencies.isEmpty());
+
+    QVERIFY(loadedCache.findUpToDateEntry(QFileInfo(secondVhdl_), VHDL_ANALYZER) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testMissingCacheIsNotLoaded()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testMissingCacheIsNotLoaded()
+{
+    FileAnalysisCache cache;
+    cache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, QString()));
+
+    // Loading discards the previous entries even when there is nothing to load.
+    QCOMPARE(cache.load(componentKey_), false);
+    QVERIFY(cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) == nullptr);
+
+    // An empty cache can still be saved for the component.
+    QVERIFY(cache.save());
+    QVERIFY(cache.load(componentKey_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testCacheOfOtherComponentIsNotLoaded()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testCacheOfOtherComponentIsNotLoaded()
+{
+    FileAnalysisCache savedCache;
+    savedCache.load(componentKey_);
+    savedCache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, QString()));
+    QVERIFY(savedCache.save());
+
+    QString otherKey = componentKey_ + QStringLiteral(".other");
+
+    FileAnalysisCache otherCache;
+    QCOMPARE(otherCache.load(otherKey), false);
+    QVERIFY(otherCache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) == nullptr);
+
+    QFile::remove(ChecksummedFile::cacheFilePath(QStringLiteral("dependencyAnalysis"), otherKey,
+        QStringLiteral(".cache")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testCorruptedCacheIsDiscarded()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testCorruptedCacheIsDiscarded()
+{
+    FileAnalysisCache savedCache;
+    savedCache.load(componentKey_);
+    populateCache(savedCache);
+    QVERIFY(savedCache.save());
+
+    QFile cacheFile(cacheFilePath());
+    QVERIFY(cacheFile.open(QIODevice::ReadWrite));
+    QByteArray content = cacheFile.readAll();
+    QVERIFY(content.size() > 16);
+
+    // Flip the first byte of the payload following the magic, the version and the payload length.
+    content[12] = content.at(12) ^ 0x5A;
+    cacheFile.seek(0);
+    cacheFile.write(content);
+    cacheFile.close();
+
+    FileAnalysisCache loadedCache;
+    QCOMPARE(loadedCache.load(componentKey_), false);
+    QVERIFY(loadedCache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) == nullptr);
+    QVERIFY(loadedCache.findUpToDateEntry(QFileInfo(verilog_), VERILOG_ANALYZER) == nullptr);
+
+    // The discarded cache is replaced on the next save.
+    loadedCache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, QString()));
+    QVERIFY(loadedCache.save());
+    QVERIFY(loadedCache.load(componentKey_));
+    QVERIFY(loadedCache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testTruncatedCacheIsDiscarded()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testTruncatedCacheIsDiscarded()
+{
+    FileAnalysisCache savedCache;
+    savedCache.load(componentKey_);
+    populateCache(savedCache);
+    QVERIFY(savedCache.save());
+
+    QFile cacheFile(cacheFilePath());
+    QVERIFY(cacheFile.resize(cacheFile.size() / 2));
+
+    FileAnalysisCache loadedCache;
+    QCOMPARE(loadedCache.load(componentKey_), false);
+    QVERIFY(loadedCache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testUnchangedFileIsReused()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testUnchangedFileIsReused()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    cache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, "second.vhd"));
+
+    FileAnalysisCache::Entry const* entry = cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER);
+    QVERIFY(entry != nullptr);
+    QCOMPARE(entry->hash, QString("hash of first.vhd"));
+
+    // The entry is found through any path to the file.
+    entry = cache.findUpToDateEntry(QFileInfo(directory_->path() + "/./first.vhd"), VHDL_ANALYZER);
+    QVERIFY(entry != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testModifiedFileIsNotReused()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testModifiedFileIsNotReused()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    cache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, QString()));
+    cache.insert(secondVhdl_, createEntry(secondVhdl_, VHDL_ANALYZER, QString()));
+
+    // A different size.
+    createFile("first.vhd", "entity first is port (clk : in std_logic); end;");
+    QVERIFY(cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) == nullptr);
+
+    // The same size with a different modification time.
+    QFile secondFile(secondVhdl_);
+    QVERIFY(secondFile.open(QIODevice::ReadWrite));
+    QVERIFY(secondFile.setFileTime(QFileInfo(secondVhdl_).lastModified().addSecs(10),
+        QFileDevice::FileModificationTime));
+    secondFile.close();
+
+    QVERIFY(cache.findUpToDateEntry(QFileInfo(secondVhdl_), VHDL_ANALYZER) == nullptr);
+
+    // A removed file.
+    QVERIFY(QFile::remove(firstVhdl_));
+    QVERIFY(cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testFileOfOtherAnalyzerIsNotReused()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testFileOfOtherAnalyzerIsNotReused()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    cache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, QString()));
+
+    QVERIFY(cache.findUpToDateEntry(QFileInfo(firstVhdl_), QStringLiteral("VHDL analyzer/1.1")) == nullptr);
+    QVERIFY(cache.findUpToDateEntry(QFileInfo(firstVhdl_), QString()) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testDependenciesAreKeptForUnchangedFiles()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testDependenciesAreKeptForUnchangedFiles()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    populateCache(cache);
+
+    QMap<QString, QString> analyzedFiles;
+    analyzedFiles.insert(firstVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(secondVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(verilog_, VERILOG_ANALYZER);
+
+    QCOMPARE(cache.invalidateDependenciesIfChanged(analyzedFiles), false);
+
+    for (auto it = analyzedFiles.cbegin(); it != analyzedFiles.cend(); ++it)
+    {
+        FileAnalysisCache::Entry const* entry = cache.findUpToDateEntry(QFileInfo(it.key()), it.value());
+        QVERIFY(entry != nullptr);
+        QCOMPARE(entry->dependenciesKnown, true);
+        QCOMPARE(entry->dependencies.size(), 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testModifiedFileDropsDependenciesOfItsAnalyzerOnly()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testModifiedFileDropsDependenciesOfItsAnalyzerOnly()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    populateCache(cache);
+
+    createFile("first.vhd", "entity first is port (clk : in std_logic); end;");
+
+    QMap<QString, QString> analyzedFiles;
+    analyzedFiles.insert(firstVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(secondVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(verilog_, VERILOG_ANALYZER);
+
+    QCOMPARE(cache.invalidateDependenciesIfChanged(analyzedFiles), true);
+
+    // The unchanged VHDL file may depend on the definitions in the modified one. Its hash is still valid.
+    FileAnalysisCache::Entry const* secondEntry = cache.findUpToDateEntry(QFileInfo(secondVhdl_), VHDL_ANALYZER);
+    QVERIFY(secondEntry != nullptr);
+    QCOMPARE(secondEntry->hash, QString("hash of second.vhd"));
+    QCOMPARE(secondEntry->dependenciesKnown, false);
+    QVERIFY(secondEntry->dependencies.isEmpty());
+
+    FileAnalysisCache::Entry const* verilogEntry = cache.findUpToDateEntry(QFileInfo(verilog_), VERILOG_ANALYZER);
+    QVERIFY(verilogEntry != nullptr);
+    QCOMPARE(verilogEntry->dependenciesKnown, true);
+    QCOMPARE(verilogEntry->dependencies.first().filename, QString("top_pkg.v"));
+
+    // Nothing more is dropped until the files change again.
+    FileAnalysisCache::Entry firstEntry = createEntry(firstVhdl_, VHDL_ANALYZER, "second.vhd");
+    cache.insert(firstVhdl_, firstEntry);
+    cache.insert(secondVhdl_, createEntry(secondVhdl_, VHDL_ANALYZER, "first.vhd"));
+
+    QCOMPARE(cache.invalidateDependenciesIfChanged(analyzedFiles), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testAddedFileDropsDependenciesOfItsAnalyzerOnly()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testAddedFileDropsDependenciesOfItsAnalyzerOnly()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    populateCache(cache);
+
+    QString addedVerilog = createFile("top_pkg.v", "module top_pkg; endmodule");
+
+    QMap<QString, QString> analyzedFiles;
+    analyzedFiles.insert(firstVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(secondVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(verilog_, VERILOG_ANALYZER);
+    analyzedFiles.insert(addedVerilog, VERILOG_ANALYZER);
+
+    QCOMPARE(cache.invalidateDependenciesIfChanged(analyzedFiles), true);
+
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(verilog_), VERILOG_ANALYZER)->dependenciesKnown, false);
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER)->dependenciesKnown, true);
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(secondVhdl_), VHDL_ANALYZER)->dependenciesKnown, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testRemovedFileDropsDependenciesOfItsAnalyzerOnly()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testRemovedFileDropsDependenciesOfItsAnalyzerOnly()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    populateCache(cache);
+
+    QMap<QString, QString> analyzedFiles;
+    analyzedFiles.insert(firstVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(verilog_, VERILOG_ANALYZER);
+
+    QCOMPARE(cache.invalidateDependenciesIfChanged(analyzedFiles), true);
+
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER)->dependenciesKnown, false);
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(verilog_), VERILOG_ANALYZER)->dependenciesKnown, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::testChangedAnalyzerDropsDependenciesOfBothAnalyzers()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::testChangedAnalyzerDropsDependenciesOfBothAnalyzers()
+{
+    FileAnalysisCache cache;
+    cache.load(componentKey_);
+    populateCache(cache);
+
+    QString thirdVhdl = createFile("third.vhd", "entity third is end;");
+    cache.insert(thirdVhdl, createEntry(thirdVhdl, VHDL_ANALYZER, "first.vhd"));
+
+    QString otherAnalyzer = QStringLiteral("Other analyzer/1.0");
+    QString otherFile = createFile("other.src", "other");
+    cache.insert(otherFile, createEntry(otherFile, otherAnalyzer, "other.h"));
+
+    // The second file is now analyzed as Verilog.
+    QMap<QString, QString> analyzedFiles;
+    analyzedFiles.insert(firstVhdl_, VHDL_ANALYZER);
+    analyzedFiles.insert(secondVhdl_, VERILOG_ANALYZER);
+    analyzedFiles.insert(thirdVhdl, VHDL_ANALYZER);
+    analyzedFiles.insert(verilog_, VERILOG_ANALYZER);
+    analyzedFiles.insert(otherFile, otherAnalyzer);
+
+    QCOMPARE(cache.invalidateDependenciesIfChanged(analyzedFiles), true);
+
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(firstVhdl_), VHDL_ANALYZER)->dependenciesKnown, false);
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(thirdVhdl), VHDL_ANALYZER)->dependenciesKnown, false);
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(verilog_), VERILOG_ANALYZER)->dependenciesKnown, false);
+    QCOMPARE(cache.findUpToDateEntry(QFileInfo(otherFile), otherAnalyzer)->dependenciesKnown, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::createFile()
+//-----------------------------------------------------------------------------
+QString tst_FileAnalysisCache::createFile(QString const& name, QByteArray const& content)
+{
+    QString path = QFileInfo(directory_->path() + "/" + name).absoluteFilePath();
+
+    QFile file(path);
+    file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    file.write(content);
+    file.close();
+
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::createEntry()
+//-----------------------------------------------------------------------------
+FileAnalysisCache::Entry tst_FileAnalysisCache::createEntry(QString const& path, QString const& analyzer,
+    QString const& dependency) const
+{
+    QFileInfo fileInfo(path);
+
+    FileAnalysisCache::Entry entry;
+    entry.size = fileInfo.size();
+    entry.lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
+    entry.analyzer = analyzer;
+    entry.hash = QStringLiteral("hash of ") + fileInfo.fileName();
+    entry.dependenciesKnown = true;
+
+    if (dependency.isEmpty() == false)
+    {
+        FileDependencyDesc dependencyDesc;
+        dependencyDesc.filename = dependency;
+        entry.dependencies.append(dependencyDesc);
+    }
+
+    return entry;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::populateCache()
+//-----------------------------------------------------------------------------
+void tst_FileAnalysisCache::populateCache(FileAnalysisCache& cache)
+{
+    cache.insert(firstVhdl_, createEntry(firstVhdl_, VHDL_ANALYZER, "second.vhd"));
+    cache.insert(secondVhdl_, createEntry(secondVhdl_, VHDL_ANALYZER, "first.vhd"));
+    cache.insert(verilog_, createEntry(verilog_, VERILOG_ANALYZER, "top_pkg.v"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileAnalysisCache::cacheFilePath()
+//-----------------------------------------------------------------------------
+QString tst_FileAnalysisCache::cacheFilePath() const
+{
+    return ChecksummedFile::cacheFilePath(QStringLiteral("dependencyAnalysis"), componentKey_,
+        QStringLiteral(".cache"));
+}
+
+QTEST_APPLESS_MAIN(tst_FileAnalysisCache)
+
+#include "tst_FileAnalysisCache.moc"
@@ -0,0 +1,9 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../common/ChecksummedFile.h \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.h
+SOURCES += ../../common/ChecksummedFile.cpp \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.cpp \
+    ./tst_FileAnalysisCache.cpp
@@ -0,0 +1,351 @@
+//-----------------------------------------------------------------------------
+// File: tst_FileDependencyItem.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for the path lookups of class FileDependencyItem.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/File.h>
+
+class tst_FileDependencyItem : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_FileDependencyItem();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testFolderIsFound();
+    void testFileIsFoundInItsFolder();
+    void testExternalFileIsFoundByPathEnd();
+    void testExternalFileIsMatchedOnWholeFileName();
+    void testFirstExternalFileInTreeIsFound();
+
+    void testRelocatedExternalFileIsFoundInNewLocation();
+    void testRemovedFolderIsNotFound();
+
+    void testFirstFolderWithDuplicatePathIsFound();
+    void testFileIsFoundInFolderWithDuplicatePath();
+    void testRemovedDuplicateFolderIsReplaced();
+
+private:
+
+    FileDependencyItem* addFile(FileDependencyItem* folder, QString const& path);
+
+    void moveItem(FileDependencyItem* item, FileDependencyItem* newParent);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The component containing the files.
+    QSharedPointer<Component> component_;
+
+    //! The root of the tested tree.
+    FileDependencyItem* root_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::tst_FileDependencyItem()
+//-----------------------------------------------------------------------------
+tst_FileDependencyItem::tst_FileDependencyItem():
+component_(),
+root_(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::init()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::init()
+{
+    component_ = QSharedPointer<Component>(new Component());
+    root_ = new FileDependencyItem();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::cleanup()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::cleanup()
+{
+    delete root_;
+    root_ = 0;
+
+    component_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testFolderIsFound()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testFolderIsFound()
+{
+    FileDependencyItem* sourceFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* includeFolder = root_->addFolder(component_, "inc");
+    FileDependencyItem* externalFolder = root_->addFolder(component_, "$External$");
+
+    QCOMPARE(root_->findFolder("src"), sourceFolder);
+    QCOMPARE(root_->findFolder("inc"), includeFolder);
+    QCOMPARE(root_->findFolder("$External$"), externalFolder);
+
+    QVERIFY(root_->findFolder("lib") == 0);
+    QVERIFY(root_->findFolder("src/") == 0);
+    QVERIFY(root_->findFolder(QString()) == 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testFileIsFoundInItsFolder()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testFileIsFoundInItsFolder()
+{
+    FileDependencyItem* sourceFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* includeFolder = root_->addFolder(component_, "inc");
+
+    FileDependencyItem* mainFile = addFile(sourceFolder, "src/main.c");
+    FileDependencyItem* headerFile = addFile(includeFolder, "inc/main.h");
+
+    QCOMPARE(root_->findFile("src/main.c", "src"), mainFile);
+    QCOMPARE(root_->findFile("inc/main.h", "inc"), headerFile);
+
+    // The file must be in the given folder.
+    QVERIFY(root_->findFile("src/main.c", "inc") == 0);
+    QVERIFY(root_->findFile("main.c", "src") == 0);
+    QVERIFY(root_->findFile("src/other.c", "src") == 0);
+
+    // Files are not external unless they are in an external folder.
+    QVERIFY(root_->findExternalFile("main.c") == 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testExternalFileIsFoundByPathEnd()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testExternalFileIsFoundByPathEnd()
+{
+    FileDependencyItem* unknownFolder = root_->addFolder(component_, "$External$");
+    FileDependencyItem* libraryFolder = root_->addFolder(component_, "$/opt/lib$");
+
+    FileDependencyItem* unknownFile = addFile(unknownFolder, "$External$/stdio.h");
+    FileDependencyItem* libraryFile = addFile(libraryFolder, "$/opt/lib$/include/vector.h");
+
+    QCOMPARE(root_->findExternalFile("stdio.h"), unknownFile);
+    QCOMPARE(root_->findExternalFile("vector.h"), libraryFile);
+    QCOMPARE(root_->findExternalFile("include/vector.h"), libraryFile);
+    QCOMPARE(root_->findExternalFile("$/opt/lib$/include/vector.h"), libraryFile);
+
+    QVERIFY(root_->findExternalFile("other/vector.h") == 0);
+    QVERIFY(root_->findExternalFile("stdlib.h") == 0);
+
+    // The external files are also found by their full path in their folder.
+    QCOMPARE(root_->findFile("$External$/stdio.h", "$External$"), unknownFile);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testExternalFileIsMatchedOnWholeFileName()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testExternalFileIsMatchedOnWholeFileName()
+{
+    FileDependencyItem* unknownFolder = root_->addFolder(component_, "$External$");
+    FileDependencyItem* fooFile = addFile(unknownFolder, "$External$/foo.h");
+
+    // A dependency on a file whose name only ends like an external file is not resolved to it.
+    QVERIFY(root_->findExternalFile("oo.h") == 0);
+    QVERIFY(root_->findExternalFile("o.h") == 0);
+    QVERIFY(root_->findExternalFile("xfoo.h") == 0);
+
+    QCOMPARE(root_->findExternalFile("foo.h"), fooFile);
+
+    // Once the shorter name is added, both files are found by their own names.
+    FileDependencyItem* ooFile = addFile(unknownFolder, "$External$/oo.h");
+
+    QCOMPARE(root_->findExternalFile("oo.h"), ooFile);
+    QCOMPARE(root_->findExternalFile("foo.h"), fooFile);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testFirstExternalFileInTreeIsFound()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testFirstExternalFileInTreeIsFound()
+{
+    FileDependencyItem* unknownFolder = root_->addFolder(component_, "$External$");
+    addFile(unknownFolder, "$External$/config.h");
+
+    FileDependencyItem* libraryFolder = root_->addFolder(component_, "$/opt/lib$");
+    FileDependencyItem* libraryFile = addFile(libraryFolder, "$/opt/lib$/config.h");
+
+    // The library folder precedes the unknown location in the tree.
+    QCOMPARE(root_->getChild(0), libraryFolder);
+    QCOMPARE(root_->findExternalFile("config.h"), libraryFile);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testRelocatedExternalFileIsFoundInNewLocation()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testRelocatedExternalFileIsFoundInNewLocation()
+{
+    FileDependencyItem* unknownFolder = root_->addFolder(component_, "$External$");
+    FileDependencyItem* headerFile = addFile(unknownFolder, "$External$/types.h");
+    FileDependencyItem* otherFile = addFile(unknownFolder, "$External$/other.h");
+
+    FileDependencyItem* libraryFolder = root_->addFolder(component_, "$/opt/lib$");
+
+    moveItem(headerFile, libraryFolder);
+
+    QCOMPARE(headerFile->getPath(), QString("$/opt/lib$/types.h"));
+    QCOMPARE(root_->findExternalFile("types.h"), headerFile);
+    QCOMPARE(root_->findFile("$/opt/lib$/types.h", "$/opt/lib$"), headerFile);
+    QVERIFY(root_->findFile("$External$/types.h", "$External$") == 0);
+
+    // The other files of the old location are not affected.
+    QCOMPARE(root_->findExternalFile("other.h"), otherFile);
+    QCOMPARE(root_->findFile("$External$/other.h", "$External$"), otherFile);
+
+    // Moving the file back restores the original lookups.
+    moveItem(headerFile, unknownFolder);
+
+    QCOMPARE(headerFile->getPath(), QString("$External$/types.h"));
+    QCOMPARE(root_->findExternalFile("types.h"), headerFile);
+    QCOMPARE(root_->findFile("$External$/types.h", "$External$"), headerFile);
+    QVERIFY(root_->findFile("$/opt/lib$/types.h", "$/opt/lib$") == 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testRemovedFolderIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testRemovedFolderIsNotFound()
+{
+    FileDependencyItem* sourceFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* sourceFile = addFile(sourceFolder, "src/main.c");
+
+    FileDependencyItem* libraryFolder = root_->addFolder(component_, "$/opt/lib$");
+    addFile(libraryFolder, "$/opt/lib$/vector.h");
+
+    root_->removeItem(libraryFolder);
+    delete libraryFolder;
+
+    QVERIFY(root_->findFolder("$/opt/lib$") == 0);
+    QVERIFY(root_->findFile("$/opt/lib$/vector.h", "$/opt/lib$") == 0);
+    QVERIFY(root_->findExternalFile("vector.h") == 0);
+
+    root_->removeItem(sourceFolder);
+
+    QVERIFY(root_->findFolder("src") == 0);
+    QVERIFY(root_->findFile("src/main.c", "src") == 0);
+
+    // A removed folder keeps its files, but they are no longer in the tree.
+    QCOMPARE(sourceFolder->getChild(0), sourceFile);
+    delete sourceFolder;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testFirstFolderWithDuplicatePathIsFound()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testFirstFolderWithDuplicatePathIsFound()
+{
+    FileDependencyItem* firstFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* secondFolder = root_->addFolder(component_, "src");
+
+    QCOMPARE(root_->getChild(0), firstFolder);
+    QCOMPARE(root_->getChild(1), secondFolder);
+
+    QCOMPARE(root_->findFolder("src"), firstFolder);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testFileIsFoundInFolderWithDuplicatePath()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testFileIsFoundInFolderWithDuplicatePath()
+{
+    FileDependencyItem* firstFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* secondFolder = root_->addFolder(component_, "src");
+
+    FileDependencyItem* firstMain = addFile(firstFolder, "src/main.c");
+    addFile(secondFolder, "src/main.c");
+    FileDependencyItem* secondUtil = addFile(secondFolder, "src/util.c");
+
+    // The file in the first folder is found, even though the other one was added later.
+    QCOMPARE(root_->findFile("src/main.c", "src"), firstMain);
+
+    // Files only in the second folder are found as well.
+    QCOMPARE(root_->findFile("src/util.c", "src"), secondUtil);
+
+    // Of duplicate files within a folder, the first one in the folder is found.
+    FileDependencyItem* duplicateUtil = addFile(secondFolder, "src/util.c");
+
+    QCOMPARE(secondFolder->getChild(1), secondUtil);
+    QCOMPARE(secondFolder->getChild(2), duplicateUtil);
+    QCOMPARE(root_->findFile("src/util.c", "src"), secondUtil);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::testRemovedDuplicateFolderIsReplaced()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::testRemovedDuplicateFolderIsReplaced()
+{
+    FileDependencyItem* firstFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* secondFolder = root_->addFolder(component_, "src");
+    FileDependencyItem* thirdFolder = root_->addFolder(component_, "src");
+
+    addFile(firstFolder, "src/main.c");
+    addFile(secondFolder, "src/main.c");
+    FileDependencyItem* thirdMain = addFile(thirdFolder, "src/main.c");
+
+    // Removing another than the found folder keeps the found one.
+    root_->removeItem(secondFolder);
+    delete secondFolder;
+
+    QCOMPARE(root_->findFolder("src"), firstFolder);
+
+    // The next folder in the tree takes the place of the removed one.
+    root_->removeItem(firstFolder);
+    delete firstFolder;
+
+    QCOMPARE(root_->findFolder("src"), thirdFolder);
+    QCOMPARE(root_->findFile("src/main.c", "src"), thirdMain);
+
+    root_->removeItem(thirdFolder);
+    delete thirdFolder;
+
+    QVERIFY(root_->findFolder("src") == 0);
+    QVERIFY(root_->findFile("src/main.c", "src") == 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::addFile()
+//-----------------------------------------------------------------------------
+FileDependencyItem* tst_FileDependencyItem::addFile(FileDependencyItem* folder, QString const& path)
+{
+    QList<QSharedPointer<File> > fileRefs;
+    if (folder->isExternal() == false)
+    {
+        fileRefs.append(QSharedPointer<File>(new File(path, "cSource")));
+    }
+
+    return folder->addFile(component_, path, fileRefs);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyItem::moveItem()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyItem::moveItem(FileDependencyItem* item, FileDependencyItem* newParent)
+{
+    // Relocate the item the same way as the dependency model.
+    item->getParent()->removeItem(item);
+    newParent->insertItem(item);
+}
+
+QTEST_APPLESS_MAIN(tst_FileDependencyItem)
+
+#include "tst_FileDependencyItem.moc"
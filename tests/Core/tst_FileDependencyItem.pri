@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.h
+SOURCES += ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.cpp \
+    ./tst_FileDependencyItem.cpp
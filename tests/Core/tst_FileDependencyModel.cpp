@@ -0,0 +1,428 @@
+//-----------------------------------------------------------------------------
+// File: tst_FileDependencyModel.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for the dependency analysis of class FileDependencyModel.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.h>
+#include <editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyModel.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/File.h>
+#include <IPXACTmodels/Component/FileSet.h>
+#include <IPXACTmodels/kactusExtensions/FileDependency.h>
+
+#include <Plugins/PluginSystem/ISourceAnalyzerPlugin.h>
+#include <Plugins/PluginSystem/PluginManager.h>
+
+#include <QAtomicInt>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QThreadPool>
+
+namespace
+{
+    //! The file type analyzed by the test analyzer.
+    const QString TEST_FILE_TYPE = QStringLiteral("kactus2TestSource");
+
+    //-----------------------------------------------------------------------------
+    //! Analyzer taking a given time for each file. Each line of a file is a dependency of the file.
+    //-----------------------------------------------------------------------------
+    class TestAnalyzerPlugin : public ISourceAnalyzerPlugin
+    {
+    public:
+
+        TestAnalyzerPlugin(): delays_(), beginCount_(0), endCount_(0), analyzedCount_(0), usedAfterEnd_(0) {}
+
+        virtual ~TestAnalyzerPlugin() = default;
+
+        virtual QString getName() const override { return QStringLiteral("Test analyzer"); }
+        virtual QString getVersion() const override { return QStringLiteral("1.0"); }
+        virtual QString getDescription() const override { return QString(); }
+        virtual QString getVendor() const override { return QString(); }
+        virtual QString getLicence() const override { return QString(); }
+        virtual QString getLicenceHolder() const override { return QString(); }
+        virtual QWidget* getSettingsWidget() override { return nullptr; }
+        virtual PluginSettingsModel* getSettingsModel() override { return nullptr; }
+
+        virtual QList<IPlugin::ExternalProgramRequirement> getProgramRequirements() override
+        {
+            return QList<IPlugin::ExternalProgramRequirement>();
+        }
+
+        virtual QStringList getSupportedFileTypes() const override
+        {
+            return QStringList(TEST_FILE_TYPE);
+        }
+
+        virtual QString calculateHash(QString const& filename) override
+        {
+            return QString::number(qHash(filename));
+        }
+
+        virtual void beginAnalysis(Component const* /*component*/, QString const& /*componentPath*/) override
+        {
+            beginCount_.ref();
+        }
+
+        virtual void endAnalysis(Component const* /*component*/, QString const& /*componentPath*/) override
+        {
+            endCount_.ref();
+        }
+
+        virtual QList<FileDependencyDesc> getFileDependencies(Component const* /*component*/,
+            QString const& /*componentPath*/, QString const& filename) override
+        {
+            if (endCount_.load() >= beginCount_.load())
+            {
+                usedAfterEnd_.ref();
+            }
+
+            QThread::msleep(delays_.value(QFileInfo(filename).fileName(), 0));
+
+            QList<FileDependencyDesc> dependencies;
+
+            QFile file(filename);
+            file.open(QIODevice::ReadOnly);
+            for (QString const& line : QString::fromUtf8(file.readAll()).split('\n', QString::SkipEmptyParts))
+            {
+                FileDependencyDesc dependency;
+                dependency.filename = line;
+                dependencies.append(dependency);
+            }
+
+            analyzedCount_.ref();
+            return dependencies;
+        }
+
+        //! The analysis time in milliseconds by file name. Not modified during an analysis.
+        QMap<QString, unsigned long> delays_;
+
+        //! The number of analyses begun.
+        QAtomicInt beginCount_;
+
+        //! The number of analyses ended.
+        QAtomicInt endCount_;
+
+        //! The number of files analyzed.
+        QAtomicInt analyzedCount_;
+
+        //! The number of files analyzed outside an analysis.
+        QAtomicInt usedAfterEnd_;
+    };
+}
+
+class tst_FileDependencyModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_FileDependencyModel();
+
+private slots:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void init();
+    void cleanup();
+
+    void testResultsAreAppliedInFileOrder();
+    void testProgressIsReportedForEveryFile();
+    void testAnalysisCanBeCancelledWhileRunning();
+
+private:
+
+    void createFiles(int fileCount, unsigned long delay, bool reverseDelays);
+
+    QString filePath(int fileIndex) const;
+
+    bool runAnalysis();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The analyzer used in the tests.
+    TestAnalyzerPlugin analyzer_;
+
+    //! The maximum number of threads in the global thread pool before the tests.
+    int originalThreadCount_;
+
+    //! The directory of the analyzed component.
+    QSharedPointer<QTemporaryDir> componentDirectory_;
+
+    //! The analyzed component.
+    QSharedPointer<Component> component_;
+
+    //! The model being tested.
+    QSharedPointer<FileDependencyModel> model_;
+
+    //! The first and the second file of the dependencies added by the model, in the order of addition.
+    QList<QPair<QString, QString> > addedDependencies_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::tst_FileDependencyModel()
+//-----------------------------------------------------------------------------
+tst_FileDependencyModel::tst_FileDependencyModel():
+analyzer_(),
+originalThreadCount_(0),
+componentDirectory_(),
+component_(),
+model_(),
+addedDependencies_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::initTestCase()
+{
+    // The analysis caches are written in the test locations.
+    QStandardPaths::setTestModeEnabled(true);
+
+    PluginManager::getInstance().addPlugin(&analyzer_);
+
+    // With two workers, the files after the first ones are still waiting when the analysis is cancelled.
+    originalThreadCount_ = QThreadPool::globalInstance()->maxThreadCount();
+    QThreadPool::globalInstance()->setMaxThreadCount(2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::cleanupTestCase()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::cleanupTestCase()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(originalThreadCount_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::init()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::init()
+{
+    componentDirectory_ = QSharedPointer<QTemporaryDir>(new QTemporaryDir());
+    QVERIFY(componentDirectory_->isValid());
+    QVERIFY(QDir(componentDirectory_->path()).mkpath("src"));
+
+    component_ = QSharedPointer<Component>(new Component(VLNV(VLNV::COMPONENT, "tuni.fi", "test", "analyzed",
+        "1.0")));
+
+    analyzer_.delays_.clear();
+    analyzer_.beginCount_.store(0);
+    analyzer_.endCount_.store(0);
+    analyzer_.analyzedCount_.store(0);
+    analyzer_.usedAfterEnd_.store(0);
+
+    addedDependencies_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::cleanup()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::cleanup()
+{
+    model_.clear();
+    component_.clear();
+    componentDirectory_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::testResultsAreAppliedInFileOrder()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::testResultsAreAppliedInFileOrder()
+{
+    const int fileCount = 8;
+
+    // The first files take the longest, so the later files are ready first.
+    createFiles(fileCount, 10, true);
+
+    QVERIFY(runAnalysis());
+
+    QCOMPARE(analyzer_.analyzedCount_.load(), fileCount);
+    QCOMPARE(addedDependencies_.count(), fileCount);
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        QCOMPARE(addedDependencies_.at(i).first, filePath(i));
+        QCOMPARE(addedDependencies_.at(i).second, QString("$External$/dependency%1.h").arg(i));
+
+        QCOMPARE(model_->findFileItem(filePath(i))->getStatus(), FileDependencyItem::FILE_DEPENDENCY_STATUS_OK);
+    }
+
+    // The external files are added in the order of the analyzed files.
+    FileDependencyItem* externalFolder = model_->findFolderItem("$External$");
+    QVERIFY(externalFolder != 0);
+    QCOMPARE(externalFolder->getChildCount(), fileCount);
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        QCOMPARE(externalFolder->getChild(i)->getPath(), QString("$External$/dependency%1.h").arg(i));
+    }
+
+    QCOMPARE(analyzer_.beginCount_.load(), 1);
+    QCOMPARE(analyzer_.endCount_.load(), 1);
+    QCOMPARE(analyzer_.usedAfterEnd_.load(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::testProgressIsReportedForEveryFile()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::testProgressIsReportedForEveryFile()
+{
+    const int fileCount = 6;
+    createFiles(fileCount, 5, false);
+
+    const int totalStepCount = model_->getTotalStepCount();
+    QCOMPARE(totalStepCount, fileCount + 1);
+
+    QSignalSpy progressSpy(model_.data(), SIGNAL(analysisProgressChanged(int)));
+
+    QVERIFY(runAnalysis());
+
+    QList<int> progressValues;
+    for (QList<QVariant> const& arguments : progressSpy)
+    {
+        progressValues.append(arguments.first().toInt());
+    }
+
+    QVERIFY2(progressValues.size() >= 3, "Expected the start, at least one step and the reset.");
+    QCOMPARE(progressValues.first(), 1);
+    QCOMPARE(progressValues.last(), 0);
+
+    // The progress only grows during the analysis and never passes the number of steps.
+    for (int i = 1; i < progressValues.size() - 1; ++i)
+    {
+        QVERIFY(progressValues.at(i) > progressValues.at(i - 1));
+        QVERIFY(progressValues.at(i) <= totalStepCount);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::testAnalysisCanBeCancelledWhileRunning()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::testAnalysisCanBeCancelledWhileRunning()
+{
+    const int fileCount = 40;
+    createFiles(fileCount, 20, false);
+
+    QSignalSpy progressSpy(model_.data(), SIGNAL(analysisProgressChanged(int)));
+    QSignalSpy resetSpy(model_.data(), SIGNAL(dependenciesReset()));
+
+    model_->startAnalysis();
+    QTRY_VERIFY_WITH_TIMEOUT(addedDependencies_.isEmpty() == false, 10000);
+
+    model_->stopAnalysis();
+
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(progressSpy.last().first().toInt(), 0);
+    QCOMPARE(analyzer_.endCount_.load(), 1);
+    QVERIFY(analyzer_.analyzedCount_.load() < fileCount);
+
+    // No results are applied after the analysis has been stopped.
+    const int appliedCount = addedDependencies_.count();
+    QTest::qWait(100);
+    QCOMPARE(addedDependencies_.count(), appliedCount);
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(analyzer_.usedAfterEnd_.load(), 0);
+
+    // The applied results are the first files in order.
+    for (int i = 0; i < fileCount; ++i)
+    {
+        FileDependencyItem::FileDependencyStatus expectedStatus = i < appliedCount ?
+            FileDependencyItem::FILE_DEPENDENCY_STATUS_OK : FileDependencyItem::FILE_DEPENDENCY_STATUS_UNKNOWN;
+
+        QCOMPARE(model_->findFileItem(filePath(i))->getStatus(), expectedStatus);
+    }
+
+    // A new analysis completes the remaining files.
+    QVERIFY(runAnalysis());
+
+    QCOMPARE(addedDependencies_.count(), fileCount);
+    for (int i = 0; i < fileCount; ++i)
+    {
+        QCOMPARE(model_->findFileItem(filePath(i))->getStatus(), FileDependencyItem::FILE_DEPENDENCY_STATUS_OK);
+    }
+
+    QCOMPARE(analyzer_.beginCount_.load(), 2);
+    QCOMPARE(analyzer_.endCount_.load(), 2);
+    QCOMPARE(analyzer_.usedAfterEnd_.load(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::createFiles()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyModel::createFiles(int fileCount, unsigned long delay, bool reverseDelays)
+{
+    QSharedPointer<FileSet> fileSet(new FileSet("sources"));
+    component_->getFileSets()->append(fileSet);
+
+    QList<QSharedPointer<File> > files;
+    for (int i = 0; i < fileCount; ++i)
+    {
+        QString absolutePath = componentDirectory_->path() + "/" + filePath(i);
+
+        QFile sourceFile(absolutePath);
+        QVERIFY(sourceFile.open(QIODevice::WriteOnly));
+        sourceFile.write(QString("dependency%1.h\n").arg(i).toUtf8());
+        sourceFile.close();
+
+        analyzer_.delays_.insert(QFileInfo(absolutePath).fileName(),
+            reverseDelays ? delay * (fileCount - i) : delay);
+
+        QSharedPointer<File> file(new File(filePath(i), TEST_FILE_TYPE));
+        fileSet->addFile(file);
+        files.append(file);
+    }
+
+    model_ = QSharedPointer<FileDependencyModel>(new FileDependencyModel(component_,
+        componentDirectory_->path() + "/"));
+
+    model_->beginReset();
+
+    FileDependencyItem* folderItem = model_->addFolder("src");
+    for (int i = 0; i < fileCount; ++i)
+    {
+        folderItem->addFile(component_, filePath(i), QList<QSharedPointer<File> >() << files.at(i));
+    }
+
+    model_->endReset();
+
+    connect(model_.data(), &FileDependencyModel::dependencyAdded, [this](FileDependency* dependency)
+    {
+        addedDependencies_.append(qMakePair(dependency->getFile1(), dependency->getFile2()));
+    });
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::filePath()
+//-----------------------------------------------------------------------------
+QString tst_FileDependencyModel::filePath(int fileIndex) const
+{
+    return QString("src/file%1.src").arg(fileIndex);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyModel::runAnalysis()
+//-----------------------------------------------------------------------------
+bool tst_FileDependencyModel::runAnalysis()
+{
+    QSignalSpy finishedSpy(model_.data(), SIGNAL(dependenciesReset()));
+    model_->startAnalysis();
+
+    return finishedSpy.wait(30000);
+}
+
+QTEST_MAIN(tst_FileDependencyModel)
+
+#include "tst_FileDependencyModel.moc"
@@ -0,0 +1,18 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../common/ChecksummedFile.h \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.h \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyColumns.h \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.h \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyModel.h \
+    ../../Plugins/PluginSystem/IPlugin.h \
+    ../../Plugins/PluginSystem/ISourceAnalyzerPlugin.h \
+    ../../Plugins/PluginSystem/PluginManager.h
+SOURCES += ../../common/ChecksummedFile.cpp \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileAnalysisCache.cpp \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyItem.cpp \
+    ../../editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyModel.cpp \
+    ../../Plugins/PluginSystem/PluginManager.cpp \
+    ./tst_FileDependencyModel.cpp
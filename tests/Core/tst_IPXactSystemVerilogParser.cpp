@@ -27,6 +27,55 @@
 
 #include <IPXACTmodels/common/Parameter.h>
 
+#include <QAbstractListModel>
+
+//-----------------------------------------------------------------------------
+//! Minimal parameter model for testing the invalidation of the parameter cache.
+//-----------------------------------------------------------------------------
+class TestParameterModel : public QAbstractListModel
+{
+public:
+
+    TestParameterModel(QSharedPointer<QList<QSharedPointer<Parameter> > > parameters):
+    QAbstractListModel(0),
+    parameters_(parameters)
+    {
+
+    }
+
+    virtual int rowCount(QModelIndex const& parent = QModelIndex()) const
+    {
+        if (parent.isValid())
+        {
+            return 0;
+        }
+
+        return parameters_->count();
+    }
+
+    virtual QVariant data(QModelIndex const& /*index*/, int /*role*/ = Qt::DisplayRole) const
+    {
+        return QVariant();
+    }
+
+    void notifyEdited(int row)
+    {
+        emit dataChanged(index(row), index(row));
+    }
+
+    void appendParameter(QSharedPointer<Parameter> parameter)
+    {
+        beginInsertRows(QModelIndex(), parameters_->count(), parameters_->count());
+        parameters_->append(parameter);
+        endInsertRows();
+    }
+
+private:
+
+    //! The parameters of the model.
+    QSharedPointer<QList<QSharedPointer<Parameter> > > parameters_;
+};
+
 
 class tst_IPXactSystemVerilogParser : public QObject
 {
@@ -58,6 +107,14 @@ private slots:
 
     void testLoopTerminatesEventually();
 
+    void testSameExpressionFollowsParameterValues();
+    void testChangedParameterUpdatesDependentValues();
+    void testParametersAddedAfterInvalidationAreFound();
+    void testParameterCacheFollowsModelChanges();
+    void testKeptValuesInvalidateOnlyDependents();
+    void testKeptValuesFollowAddedParameters();
+    void testValuesInReferenceRingAreNotKept();
+
     void testReferenceToStringInExpression();
 
     void testGetBaseForExpression();
@@ -384,6 +441,291 @@ void tst_IPXactSystemVerilogParser::testLoopTerminatesEventually()
     QTRY_COMPARE_WITH_TIMEOUT(parser.parseExpression("second"), QString("x"), 3000);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testSameExpressionFollowsParameterValues()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testSameExpressionFollowsParameterValues()
+{
+    QSharedPointer<Component> firstComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("width");
+    firstParameter->setValue("2");
+    firstComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Component> secondComponent(new Component());
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("width");
+    secondParameter->setValue("5");
+    secondComponent->getParameters()->append(secondParameter);
+
+    IPXactSystemVerilogParser firstParser(
+        QSharedPointer<ParameterFinder>(new ComponentParameterFinder(firstComponent)));
+    IPXactSystemVerilogParser secondParser(
+        QSharedPointer<ParameterFinder>(new ComponentParameterFinder(secondComponent)));
+
+    QCOMPARE(firstParser.parseExpression("width*4"), QString("8"));
+    QCOMPARE(secondParser.parseExpression("width*4"), QString("20"));
+
+    firstParameter->setValue("3");
+    QCOMPARE(firstParser.parseExpression("width*4"), QString("12"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testChangedParameterUpdatesDependentValues()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testChangedParameterUpdatesDependentValues()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("2*first");
+    testComponent->getParameters()->append(secondParameter);
+
+    QSharedPointer<Parameter> thirdParameter(new Parameter());
+    thirdParameter->setValueId("third");
+    thirdParameter->setValue("second + first");
+    testComponent->getParameters()->append(thirdParameter);
+
+    QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(testComponent));
+    IPXactSystemVerilogParser parser(finder);
+
+    QCOMPARE(parser.parseExpression("third"), QString("3"));
+
+    firstParameter->setValue("5");
+    QCOMPARE(parser.parseExpression("third"), QString("15"));
+    QCOMPARE(parser.parseExpression("second"), QString("10"));
+
+    secondParameter->setValue("first - 1");
+    QCOMPARE(parser.parseExpression("third"), QString("9"));
+
+    testComponent->getParameters()->removeOne(firstParameter);
+    finder->invalidateIndex();
+
+    bool valid = true;
+    parser.parseExpression("third", &valid);
+    QCOMPARE(valid, false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testParametersAddedAfterInvalidationAreFound()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testParametersAddedAfterInvalidationAreFound()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(testComponent));
+    IPXactSystemVerilogParser parser(finder);
+
+    QCOMPARE(parser.parseExpression("first"), QString("1"));
+
+    QSharedPointer<BusInterface> testBus(new BusInterface());
+    QSharedPointer<Parameter> busParameter(new Parameter());
+    busParameter->setValueId("busParameter");
+    busParameter->setValue("first + 1");
+    testBus->getParameters()->append(busParameter);
+    testComponent->getBusInterfaces()->append(testBus);
+
+    // Direct edits of the component are not seen until the index is invalidated.
+    QCOMPARE(finder->hasId("busParameter"), false);
+
+    finder->invalidateIndex();
+    QCOMPARE(parser.parseExpression("busParameter"), QString("2"));
+
+    firstParameter->setValueId("renamed");
+    finder->invalidateIndex();
+    QCOMPARE(finder->hasId("first"), false);
+    QCOMPARE(parser.parseExpression("renamed*4"), QString("4"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testParameterCacheFollowsModelChanges()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testParameterCacheFollowsModelChanges()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("2");
+    testComponent->getParameters()->append(secondParameter);
+
+    TestParameterModel model(testComponent->getParameters());
+
+    QSharedPointer<ParameterCache> cache(new ParameterCache(testComponent));
+    cache->registerParameterModel(&model);
+
+    IPXactSystemVerilogParser parser(cache);
+    QCOMPARE(parser.parseExpression("first + second"), QString("3"));
+
+    // Editing an ID through the model makes the old ID miss and the new ID hit.
+    firstParameter->setValueId("renamed");
+    model.notifyEdited(0);
+
+    QCOMPARE(cache->hasId("first"), false);
+    QCOMPARE(cache->hasId("renamed"), true);
+    QCOMPARE(parser.parseExpression("renamed*4"), QString("4"));
+
+    // Replacing an entry keeps the number of parameters but must still be seen.
+    QSharedPointer<Parameter> replacement(new Parameter());
+    replacement->setValueId("second");
+    replacement->setValue("7");
+    (*testComponent->getParameters())[1] = replacement;
+    model.notifyEdited(1);
+
+    QCOMPARE(cache->getNumberOfParameters(), 2);
+    QCOMPARE(cache->getParameterWithID("second"), replacement);
+    QCOMPARE(parser.parseExpression("second"), QString("7"));
+
+    QSharedPointer<Parameter> thirdParameter(new Parameter());
+    thirdParameter->setValueId("third");
+    thirdParameter->setValue("second + renamed");
+    model.appendParameter(thirdParameter);
+
+    QCOMPARE(parser.parseExpression("third"), QString("8"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testKeptValuesInvalidateOnlyDependents()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testKeptValuesInvalidateOnlyDependents()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("first*2");
+    testComponent->getParameters()->append(secondParameter);
+
+    QSharedPointer<Parameter> thirdParameter(new Parameter());
+    thirdParameter->setValueId("third");
+    thirdParameter->setValue("second + 1");
+    testComponent->getParameters()->append(thirdParameter);
+
+    QSharedPointer<Parameter> otherParameter(new Parameter());
+    otherParameter->setValueId("other");
+    otherParameter->setValue("7");
+    testComponent->getParameters()->append(otherParameter);
+
+    QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(testComponent));
+    QCOMPARE(finder->findChangedParameterIds().count(), 4);
+
+    IPXactSystemVerilogParser parser(finder);
+    parser.setKeepSymbolValues(true);
+
+    QCOMPARE(parser.parseExpression("third"), QString("3"));
+    QCOMPARE(parser.parseExpression("other"), QString("7"));
+
+    firstParameter->setValue("3");
+    otherParameter->setValue("8");
+
+    // Invalidating the first parameter reaches its transitive dependents, but not the unrelated value.
+    parser.invalidateSymbols(QStringList("first"));
+    QCOMPARE(parser.parseExpression("third"), QString("7"));
+    QCOMPARE(parser.parseExpression("second"), QString("6"));
+    QCOMPARE(parser.parseExpression("other"), QString("7"));
+
+    QStringList changedIds = finder->findChangedParameterIds();
+    changedIds.sort();
+    QCOMPARE(changedIds, QStringList({"first", "other"}));
+    QCOMPARE(finder->findChangedParameterIds(), QStringList());
+
+    parser.invalidateSymbols(changedIds);
+    QCOMPARE(parser.parseExpression("other"), QString("8"));
+    QCOMPARE(parser.parseExpression("third"), QString("7"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testKeptValuesFollowAddedParameters()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testKeptValuesFollowAddedParameters()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("later + 1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(testComponent));
+    finder->findChangedParameterIds();
+
+    IPXactSystemVerilogParser parser(finder);
+    parser.setKeepSymbolValues(true);
+
+    bool valid = true;
+    parser.parseExpression("first", &valid);
+    QCOMPARE(valid, false);
+
+    // The value depends on the missing identifier, so adding a parameter with that ID invalidates it.
+    QSharedPointer<Parameter> laterParameter(new Parameter());
+    laterParameter->setValueId("later");
+    laterParameter->setValue("4");
+    testComponent->getParameters()->append(laterParameter);
+    finder->invalidateIndex();
+
+    QCOMPARE(finder->findChangedParameterIds(), QStringList("later"));
+    parser.invalidateSymbols(QStringList("later"));
+    QCOMPARE(parser.parseExpression("first"), QString("5"));
+
+    testComponent->getParameters()->removeOne(laterParameter);
+    finder->invalidateIndex();
+
+    parser.invalidateSymbols(finder->findChangedParameterIds());
+    parser.parseExpression("first", &valid);
+    QCOMPARE(valid, false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testValuesInReferenceRingAreNotKept()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testValuesInReferenceRingAreNotKept()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("1 ? 5 : second");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("first");
+    testComponent->getParameters()->append(secondParameter);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(testComponent));
+
+    // The value of a ring member depends on where the ring is entered.
+    IPXactSystemVerilogParser firstAlone(finder);
+    IPXactSystemVerilogParser secondAlone(finder);
+    QString const firstValue = firstAlone.parseExpression("first");
+    QString const secondValue = secondAlone.parseExpression("second");
+
+    IPXactSystemVerilogParser firstEntered(finder);
+    firstEntered.setKeepSymbolValues(true);
+    QCOMPARE(firstEntered.parseExpression("first"), firstValue);
+    QCOMPARE(firstEntered.parseExpression("second"), secondValue);
+
+    IPXactSystemVerilogParser secondEntered(finder);
+    secondEntered.setKeepSymbolValues(true);
+    QCOMPARE(secondEntered.parseExpression("second"), secondValue);
+    QCOMPARE(secondEntered.parseExpression("first"), firstValue);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_IPXactSystemVerilogParser::testReferenceToString()
 //-----------------------------------------------------------------------------
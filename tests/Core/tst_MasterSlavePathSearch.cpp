@@ -49,6 +49,8 @@ private slots:
 
     void testContainedConnectionsAreNotExamined();
 
+    void testConnectionsAddedAfterSearchAreFound();
+
 private:
 
     QSharedPointer<ConnectivityGraph> testGraph_;
@@ -295,6 +297,61 @@ void tst_MasterSlavePathSearch::testContainedConnectionsAreNotExamined()
     QCOMPARE(paths.first().at(2), QSharedPointer<ConnectivityInterface const>(mapInterface1));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_MasterSlavePathSearch::testConnectionsAddedAfterSearchAreFound()
+//-----------------------------------------------------------------------------
+void tst_MasterSlavePathSearch::testConnectionsAddedAfterSearchAreFound()
+{
+    QSharedPointer<ConnectivityComponent> spaceComponent(new ConnectivityComponent("spaceComponent"));
+    QSharedPointer<ConnectivityComponent> mapComponent1(new ConnectivityComponent("mapComponent1"));
+    QSharedPointer<ConnectivityComponent> mapComponent2(new ConnectivityComponent("mapComponent2"));
+
+    QSharedPointer<ConnectivityInterface> spaceInterface =
+        createInterfaceWithMemoryItem("spaceInterface", PathSearchSpace::MASTERMODE, spaceComponent, false);
+
+    QSharedPointer<ConnectivityInterface> mapInterface1 =
+        createInterfaceWithMemoryItem("mapInterface1", PathSearchSpace::SLAVEMODE, mapComponent1, false);
+
+    QSharedPointer<ConnectivityInterface> mapInterface2 =
+        createInterfaceWithMemoryItem("mapInterface2", PathSearchSpace::SLAVEMODE, mapComponent2, false);
+
+    testGraph_->getInstances().append(spaceComponent);
+    testGraph_->getInstances().append(mapComponent1);
+    testGraph_->getInstances().append(mapComponent2);
+
+    testGraph_->getInterfaces().append(spaceInterface);
+    testGraph_->getInterfaces().append(mapInterface1);
+    testGraph_->getInterfaces().append(mapInterface2);
+
+    testGraph_->getConnections().append(QSharedPointer<ConnectivityConnection>(
+        new ConnectivityConnection("spaceToMap1", spaceInterface, mapInterface1)));
+
+    QVector<QVector<QSharedPointer<ConnectivityInterface const> > > paths =
+        pathSearcher_.findMasterSlavePaths(testGraph_);
+
+    QCOMPARE(paths.count(), 1);
+    QCOMPARE(testGraph_->getConnectionsFor(mapInterface2).count(), 0);
+
+    QSharedPointer<ConnectivityConnection> secondConnection(
+        new ConnectivityConnection("spaceToMap2", spaceInterface, mapInterface2));
+    testGraph_->getConnections().append(secondConnection);
+
+    QCOMPARE(testGraph_->getConnectionsFor(spaceInterface).count(), 2);
+    QCOMPARE(testGraph_->getConnectionsFor(mapInterface2).count(), 1);
+
+    paths = pathSearcher_.findMasterSlavePaths(testGraph_);
+
+    QCOMPARE(paths.count(), 2);
+    QCOMPARE(paths.first().last(), QSharedPointer<ConnectivityInterface const>(mapInterface1));
+    QCOMPARE(paths.last().last(), QSharedPointer<ConnectivityInterface const>(mapInterface2));
+
+    testGraph_->getConnections().removeLast();
+    testGraph_->invalidateConnectionIndex();
+
+    QCOMPARE(testGraph_->getConnectionsFor(spaceInterface).count(), 1);
+    QCOMPARE(pathSearcher_.findMasterSlavePaths(testGraph_).count(), 1);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MasterSlavePathSearch::createInterfaceWithMemoryItem()
 //-----------------------------------------------------------------------------
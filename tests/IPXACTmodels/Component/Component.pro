@@ -78,4 +78,5 @@ SUBDIRS += tst_AddressSpaceReader.pro \
 		   tst_MemoryMapValidator.pro \  
 		   tst_ComponentWriter.pro \
 		   tst_ComponentReader.pro \
-		   tst_ComponentValidator.pro 
+		   tst_ComponentValidator.pro \
+		   tst_ValidationCache.pro
@@ -17,6 +17,7 @@
 #include <IPXACTmodels/Component/validators/FieldValidator.h>
 #include <IPXACTmodels/Component/validators/EnumeratedValueValidator.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
+#include <IPXACTmodels/common/validators/ValidationCache.h>
 
 #include <IPXACTmodels/Component/AddressBlock.h>
 #include <IPXACTmodels/Component/Register.h>
@@ -64,6 +65,8 @@ private slots:
     void testRegisterOverlapping_data();
     void testRegisterIsOverlappingTwoOtherRegisters();
 
+    void testCachedResultIsKeptUntilInvalidated();
+
 private:
     
     bool errorIsNotFoundInErrorList(QString const& expectedError, QVector<QString> errorList);
@@ -950,6 +953,44 @@ bool tst_AddressBlockValidator::errorIsNotFoundInErrorList(QString const& expect
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockValidator::testCachedResultIsKeptUntilInvalidated()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockValidator::testCachedResultIsKeptUntilInvalidated()
+{
+    QSharedPointer<Field> testField (new Field("testField"));
+    testField->setBitOffset("0");
+    testField->setBitWidth("8");
+
+    QSharedPointer<Register> testRegister (new Register("testRegister", "0", "32"));
+    testRegister->getFields()->append(testField);
+
+    QSharedPointer<AddressBlock> testBlock (new AddressBlock("testBlock", "0"));
+    testBlock->setRange("16");
+    testBlock->setWidth("32");
+    testBlock->getRegisterData()->append(testRegister);
+
+    QSharedPointer<AddressBlockValidator> validator = createValidator();
+    QSharedPointer<ValidationCache> cache(new ValidationCache(
+        QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser())));
+    validator->setValidationCache(cache);
+
+    QVERIFY(validator->validate(testBlock, "8"));
+
+    testRegister->setName("");
+    QVERIFY(validator->validate(testBlock, "8"));
+
+    // The register was validated as a part of the block, so the block result is removed as well.
+    cache->invalidate(testRegister.data());
+    QVERIFY(!validator->validate(testBlock, "8"));
+
+    testRegister->setName("testRegister");
+    QVERIFY(!validator->validate(testBlock, "8"));
+
+    // A different context is validated again.
+    QVERIFY(validator->validate(testBlock, "16"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_AddressBlockValidator::createValidator()
 //-----------------------------------------------------------------------------
@@ -140,6 +140,8 @@ private slots:
     void testHasValidAssertions();
     void testHasValidAssertions_data();
 
+    void testElementGroupsFindAllErrorsInOrder();
+
 private:
 
     bool errorIsNotFoundInErrorList(QString const& expectedError, QVector<QString> errorList);
@@ -1616,6 +1618,38 @@ void tst_ComponentValidator::testHasValidAssertions_data()
     QTest::newRow("Assertions with the same name is not valid") << "Onibocho" << "1" << true << false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidator::testElementGroupsFindAllErrorsInOrder()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidator::testElementGroupsFindAllErrorsInOrder()
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(VLNV::COMPONENT, "", "Toppa", "Gurren", "")));
+    testComponent->getBusInterfaces()->append(QSharedPointer<BusInterface>(new BusInterface()));
+    testComponent->getMemoryMaps()->append(QSharedPointer<MemoryMap>(new MemoryMap()));
+    testComponent->getViews()->append(QSharedPointer<View>(new View()));
+    testComponent->getPorts()->append(QSharedPointer<Port>(new Port()));
+    testComponent->getFileSets()->append(QSharedPointer<FileSet>(new FileSet()));
+
+    LibraryMock* mockLibrary(new LibraryMock(this));
+
+    QVector<QString> sequentialErrors;
+    createComponentValidator(mockLibrary)->findErrorsIn(sequentialErrors, testComponent);
+
+    QVector<QString> groupErrors;
+    for (int group = ComponentValidator::INTERFACE_ELEMENTS; group < ComponentValidator::ELEMENT_GROUP_COUNT;
+        ++group)
+    {
+        QVector<QString> errors;
+        createComponentValidator(mockLibrary)->findErrorsIn(errors, testComponent,
+            static_cast<ComponentValidator::ElementGroup>(group));
+
+        QVERIFY(errors.isEmpty() == false);
+        groupErrors.append(errors);
+    }
+
+    QCOMPARE(groupErrors, sequentialErrors);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ComponentValidator::errorIsNotFoundInErrorList()
 //-----------------------------------------------------------------------------
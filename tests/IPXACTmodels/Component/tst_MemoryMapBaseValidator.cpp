@@ -42,6 +42,7 @@ private slots:
     void testAddressBlocksAreValid();
     void testAddressBlocksOverlap();
     void testAddressBlocksOverlap_data();
+    void testOverlapsAreFoundBetweenUnorderedBlocks();
 
 private:
 
@@ -300,6 +301,76 @@ void tst_MemoryMapBaseValidator::testAddressBlocksOverlap_data()
         "10" << "5" << "10" << true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapBaseValidator::testOverlapsAreFoundBetweenUnorderedBlocks()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapBaseValidator::testOverlapsAreFoundBetweenUnorderedBlocks()
+{
+    QSharedPointer<AddressBlock> highBlock (new AddressBlock("high", "40"));
+    highBlock->setRange("10");
+    highBlock->setWidth("8");
+
+    QSharedPointer<AddressBlock> lowBlock (new AddressBlock("low", "0"));
+    lowBlock->setRange("41");
+    lowBlock->setWidth("8");
+
+    QSharedPointer<AddressBlock> middleBlock (new AddressBlock("middle", "20"));
+    middleBlock->setRange("4");
+    middleBlock->setWidth("8");
+
+    QSharedPointer<AddressBlock> hiddenBlock (new AddressBlock("hidden", "20"));
+    hiddenBlock->setRange("4");
+    hiddenBlock->setWidth("8");
+    hiddenBlock->setIsPresent("0");
+
+    QSharedPointer<MemoryMapBase> testMap (new MemoryMapBase("testMap"));
+    testMap->getMemoryBlocks()->append(highBlock);
+    testMap->getMemoryBlocks()->append(lowBlock);
+    testMap->getMemoryBlocks()->append(hiddenBlock);
+    testMap->getMemoryBlocks()->append(middleBlock);
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<ParameterValidator> parameterValidator (new ParameterValidator(parser,
+        QSharedPointer<QList<QSharedPointer<Choice> > > ()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator (new EnumeratedValueValidator(parser));
+    QSharedPointer<FieldValidator> fieldValidator (new FieldValidator(parser, enumValidator, parameterValidator));
+    QSharedPointer<RegisterValidator> registerValidator (
+        new RegisterValidator(parser, fieldValidator, parameterValidator));
+    QSharedPointer<RegisterFileValidator> registerFileValidator (
+        new RegisterFileValidator(parser, registerValidator, parameterValidator));
+    QSharedPointer<AddressBlockValidator> addressBlockValidator (
+        new AddressBlockValidator(parser, registerValidator, registerFileValidator, parameterValidator));
+    MemoryMapBaseValidator validator(parser, addressBlockValidator);
+
+    QCOMPARE(validator.hasValidMemoryBlocks(testMap, ""), false);
+
+    QVector<QString> foundErrors;
+    validator.findErrorsIn(foundErrors, testMap, "", "test");
+
+    QStringList overlapErrors;
+    for (QString const& error : foundErrors)
+    {
+        if (error.contains("overlap"))
+        {
+            overlapErrors.append(error);
+        }
+    }
+
+    QCOMPARE(overlapErrors.size(), 2);
+    QCOMPARE(overlapErrors.first(), QObject::tr("Memory blocks %1 and %2 overlap in %3")
+        .arg(highBlock->name()).arg(lowBlock->name()).arg("test"));
+    QCOMPARE(overlapErrors.last(), QObject::tr("Memory blocks %1 and %2 overlap in %3")
+        .arg(lowBlock->name()).arg(middleBlock->name()).arg("test"));
+
+    hiddenBlock->setIsPresent("1");
+    hiddenBlock->setName("visible");
+    highBlock->setBaseAddress("50");
+    lowBlock->setBaseAddress("60");
+    middleBlock->setBaseAddress("30");
+
+    QCOMPARE(validator.hasValidMemoryBlocks(testMap, ""), true);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapBaseValidator::errorIsNotFoundInErrorList()
 //-----------------------------------------------------------------------------
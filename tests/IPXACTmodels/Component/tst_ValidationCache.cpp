@@ -0,0 +1,364 @@
+//-----------------------------------------------------------------------------
+// File: tst_ValidationCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class ValidationCache.
+//-----------------------------------------------------------------------------
+
+#include <IPXACTmodels/common/validators/ValidationCache.h>
+#include <IPXACTmodels/common/validators/ParameterValidator.h>
+#include <IPXACTmodels/common/Parameter.h>
+
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/validators/EnumeratedValueValidator.h>
+#include <IPXACTmodels/Component/validators/FieldValidator.h>
+
+#include <editors/ComponentEditor/common/ExpressionParser.h>
+#include <editors/ComponentEditor/common/SystemVerilogExpressionParser.h>
+
+#include <QtTest>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Parser evaluating identifiers to the values set in the test.
+    //-----------------------------------------------------------------------------
+    class TestParser : public ExpressionParser
+    {
+    public:
+
+        virtual ~TestParser() = default;
+
+        virtual QString parseExpression(QString const& expression, bool* validExpression = nullptr) const override
+        {
+            if (validExpression)
+            {
+                *validExpression = true;
+            }
+
+            return values_.value(expression, expression);
+        }
+
+        virtual bool isPlainValue(QString const& expression) const override
+        {
+            bool isNumber = false;
+            expression.toInt(&isNumber);
+            return isNumber;
+        }
+
+        virtual int baseForExpression(QString const& /*expression*/) const override
+        {
+            return 10;
+        }
+
+        //! The values of the identifiers.
+        QMap<QString, QString> values_;
+    };
+
+    //! Deleter for elements whose storage is owned by the test.
+    void keepStorage(int*)
+    {
+
+    }
+}
+
+class tst_ValidationCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ValidationCache();
+
+private slots:
+
+    void init();
+
+    void testResultIsReusedUntilInvalidated();
+    void testEditedFieldIsStaleUntilInvalidated();
+    void testParameterChangeRevalidates();
+    void testContextChangeRevalidates();
+
+    void testInvalidatingContainedElementInvalidatesContainers();
+    void testParameterChangeInContainedElementRevalidatesContainers();
+    void testUnknownElementClearsAllResults();
+
+    void testFreedAddressIsNotReused();
+
+private:
+
+    bool validateWidth(QSharedPointer<const void> element, QString const& context = QString());
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The parser evaluating the identifiers.
+    QSharedPointer<TestParser> parser_;
+
+    //! The cache being tested.
+    QSharedPointer<ValidationCache> cache_;
+
+    //! The number of times the validator has been run.
+    int validationCount_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::tst_ValidationCache()
+//-----------------------------------------------------------------------------
+tst_ValidationCache::tst_ValidationCache():
+parser_(),
+cache_(),
+validationCount_(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::init()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::init()
+{
+    parser_ = QSharedPointer<TestParser>(new TestParser());
+    parser_->values_.insert("width", "8");
+
+    cache_ = QSharedPointer<ValidationCache>(new ValidationCache(parser_));
+    validationCount_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testResultIsReusedUntilInvalidated()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testResultIsReusedUntilInvalidated()
+{
+    QSharedPointer<int> element(new int(0));
+
+    QVERIFY(validateWidth(element));
+    QVERIFY(validateWidth(element));
+    QCOMPARE(validationCount_, 1);
+
+    cache_->invalidate(element.data());
+
+    QVERIFY(validateWidth(element));
+    QCOMPARE(validationCount_, 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testEditedFieldIsStaleUntilInvalidated()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testEditedFieldIsStaleUntilInvalidated()
+{
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<ValidationCache> cache(new ValidationCache(parser));
+
+    QSharedPointer<ParameterValidator> parameterValidator(new ParameterValidator(cache->getRecordingParser(),
+        QSharedPointer<QList<QSharedPointer<Choice> > >()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator(
+        new EnumeratedValueValidator(cache->getRecordingParser()));
+    FieldValidator validator(cache->getRecordingParser(), enumValidator, parameterValidator);
+    validator.setValidationCache(cache);
+
+    QSharedPointer<Field> field(new Field("data"));
+    field->setBitOffset("0");
+    field->setBitWidth("8");
+
+    QVERIFY(validator.validate(field));
+
+    // Edits of the element itself are not detected by the cache, only through invalidation.
+    field->setName("");
+    QVERIFY(validator.validate(field));
+
+    cache->invalidate(field.data());
+    QVERIFY(!validator.validate(field));
+
+    field->setName("data");
+    QVERIFY(!validator.validate(field));
+
+    cache->invalidate(field.data());
+    QVERIFY(validator.validate(field));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testParameterChangeRevalidates()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testParameterChangeRevalidates()
+{
+    QSharedPointer<int> element(new int(0));
+
+    QVERIFY(validateWidth(element));
+
+    parser_->values_.insert("width", "0");
+    QVERIFY(!validateWidth(element));
+    QCOMPARE(validationCount_, 2);
+
+    QVERIFY(!validateWidth(element));
+    QCOMPARE(validationCount_, 2);
+
+    // An unrelated parameter does not affect the result.
+    parser_->values_.insert("depth", "4");
+    QVERIFY(!validateWidth(element));
+    QCOMPARE(validationCount_, 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testContextChangeRevalidates()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testContextChangeRevalidates()
+{
+    QSharedPointer<int> element(new int(0));
+
+    QVERIFY(validateWidth(element, "8"));
+    QVERIFY(validateWidth(element, "16"));
+    QCOMPARE(validationCount_, 2);
+
+    QVERIFY(validateWidth(element, "16"));
+    QCOMPARE(validationCount_, 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testInvalidatingContainedElementInvalidatesContainers()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testInvalidatingContainedElementInvalidatesContainers()
+{
+    QSharedPointer<int> memoryMap(new int(0));
+    QSharedPointer<int> addressBlock(new int(0));
+    QSharedPointer<int> registerElement(new int(0));
+    QSharedPointer<int> otherRegister(new int(0));
+
+    int mapValidations = 0;
+    int blockValidations = 0;
+
+    auto validateBlock = [this, &blockValidations, &addressBlock, &registerElement, &otherRegister]()
+    {
+        return cache_->validate(addressBlock, QString(), [this, &blockValidations, &registerElement,
+            &otherRegister]()
+        {
+            blockValidations++;
+            return validateWidth(registerElement) && validateWidth(otherRegister);
+        });
+    };
+
+    auto validateMap = [this, &mapValidations, &memoryMap, &validateBlock]()
+    {
+        return cache_->validate(memoryMap, QString(), [&mapValidations, &validateBlock]()
+        {
+            mapValidations++;
+            return validateBlock();
+        });
+    };
+
+    QVERIFY(validateMap());
+    QCOMPARE(mapValidations, 1);
+    QCOMPARE(blockValidations, 1);
+    QCOMPARE(validationCount_, 2);
+
+    cache_->invalidate(registerElement.data());
+
+    // The register, the block and the map are validated again, the other register is reused.
+    QVERIFY(validateMap());
+    QCOMPARE(mapValidations, 2);
+    QCOMPARE(blockValidations, 2);
+    QCOMPARE(validationCount_, 3);
+
+    // Validating the block directly still uses the result stored while validating the map.
+    QVERIFY(validateBlock());
+    QCOMPARE(blockValidations, 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testParameterChangeInContainedElementRevalidatesContainers()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testParameterChangeInContainedElementRevalidatesContainers()
+{
+    QSharedPointer<int> addressBlock(new int(0));
+    QSharedPointer<int> registerElement(new int(0));
+
+    int blockValidations = 0;
+    auto validateBlock = [this, &blockValidations, &addressBlock, &registerElement]()
+    {
+        return cache_->validate(addressBlock, QString(), [this, &blockValidations, &registerElement]()
+        {
+            blockValidations++;
+            return validateWidth(registerElement);
+        });
+    };
+
+    QVERIFY(validateBlock());
+
+    // The block itself evaluates no expressions, but the references of the register apply to it as well.
+    parser_->values_.insert("width", "0");
+    QVERIFY(!validateBlock());
+    QCOMPARE(blockValidations, 2);
+
+    QVERIFY(!validateBlock());
+    QCOMPARE(blockValidations, 2);
+
+    // Reusing the stored register result still passes its references to the block.
+    cache_->invalidate(addressBlock.data());
+    QVERIFY(!validateBlock());
+    QCOMPARE(blockValidations, 3);
+    QCOMPARE(validationCount_, 2);
+
+    parser_->values_.insert("width", "8");
+    QVERIFY(validateBlock());
+    QCOMPARE(blockValidations, 4);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testUnknownElementClearsAllResults()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testUnknownElementClearsAllResults()
+{
+    QSharedPointer<int> first(new int(0));
+    QSharedPointer<int> second(new int(0));
+    QSharedPointer<int> unknown(new int(0));
+
+    QVERIFY(validateWidth(first));
+    QVERIFY(validateWidth(second));
+
+    cache_->invalidate(unknown.data());
+
+    QVERIFY(validateWidth(first));
+    QVERIFY(validateWidth(second));
+    QCOMPARE(validationCount_, 4);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::testFreedAddressIsNotReused()
+//-----------------------------------------------------------------------------
+void tst_ValidationCache::testFreedAddressIsNotReused()
+{
+    // The storage outlives the elements, so the second element gets the address of the first one.
+    static int storage = 0;
+
+    QSharedPointer<int> first(&storage, keepStorage);
+    QVERIFY(validateWidth(first));
+
+    first.clear();
+
+    QSharedPointer<int> second(&storage, keepStorage);
+    QVERIFY(validateWidth(second));
+    QCOMPARE(validationCount_, 2);
+
+    QVERIFY(validateWidth(second));
+    QCOMPARE(validationCount_, 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ValidationCache::validateWidth()
+//-----------------------------------------------------------------------------
+bool tst_ValidationCache::validateWidth(QSharedPointer<const void> element, QString const& context)
+{
+    return cache_->validate(element, context, [this]()
+    {
+        validationCount_++;
+        return cache_->getRecordingParser()->parseExpression("width").toInt() > 0;
+    });
+}
+
+QTEST_APPLESS_MAIN(tst_ValidationCache)
+
+#include "tst_ValidationCache.moc"
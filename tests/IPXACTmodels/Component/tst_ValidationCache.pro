@@ -0,0 +1,41 @@
+#-----------------------------------------------------------------------------
+# File: tst_ValidationCache.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: Kactus2 team
+# Date: 18.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for ValidationCache.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ValidationCache
+
+QT += core gui xml testlib
+
+CONFIG += c++11 testcase console
+
+linux-g++ | linux-g++-64 | linux-g++-32 {
+ LIBS += -L../../../executable \
+     -lIPXACTmodels
+
+}
+win64 | win32 {
+ LIBS += -L../../../x64/executable \
+     -lIPXACTmodelsd
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ValidationCache.pri)
@@ -59,6 +59,10 @@ private slots:
 
     void testExpressionsWithoutReferences();
 
+    void testAddressesAboveTwoGigabytes();
+
+    void testInvalidValuesAreWrittenAsGiven();
+
     void testIsPresent();
 
     void testRemapOnBusComponent();
@@ -479,6 +483,79 @@ void tst_MemoryViewGenerator::testExpressionsWithoutReferences()
     ));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryViewGenerator::testAddressesAboveTwoGigabytes()
+//-----------------------------------------------------------------------------
+void tst_MemoryViewGenerator::testAddressesAboveTwoGigabytes()
+{
+    VLNV masterVLNV(VLNV::COMPONENT, "tut.fi", "TestLib", "TestMaster", "1.0");
+    VLNV slaveVLNV(VLNV::COMPONENT, "tut.fi", "TestLib", "TestSlave", "1.0");
+
+    createMasterComponent(masterVLNV);
+
+    QSharedPointer<Component> slaveComponent = createSlaveComponent(slaveVLNV);
+
+    QSharedPointer<MemoryMap> slaveMemoryMap(new MemoryMap("slaveMemoryMap"));
+    slaveComponent->getMemoryMaps()->append(slaveMemoryMap);
+
+    QSharedPointer<AddressBlock> slaveAddressBlock =
+        addAddressBlock("slaveBlock", "'hC0000000", "8", "32", slaveMemoryMap);
+
+    QSharedPointer<Register> firstRegister(new Register("firstRegister", "'h4", "32"));
+    slaveAddressBlock->getRegisterData()->append(firstRegister);
+
+    QSharedPointer<Field> firstField(new Field("firstField"));
+    firstField->setBitWidth("8");
+    firstField->setBitOffset("8");
+    firstRegister->getFields()->append(firstField);
+
+    createMasterAndSlaveInstances(masterVLNV, slaveVLNV);
+    connectMasterAndSlaveInstance();
+
+    QString output = runGenerator();
+
+    QCOMPARE(output, QString("Identifier;Type;Address;Range (AUB);Width (bits);Size (bits);Offset (bits);\n"
+        "tut.fi.TestLib.TestMaster.1.0.masterID.masterInstance.masterIf_space;addressSpace;0x0;;;;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap;memoryMap;0x0;;;;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap.slaveBlock;addressBlock;0xc0000000;8;32;;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap.slaveBlock.firstRegister;register;0xc0000004;;;32;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap.slaveBlock.firstRegister.firstField;field;0xc0000005;;8;;8;\n"
+    ));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryViewGenerator::testInvalidValuesAreWrittenAsGiven()
+//-----------------------------------------------------------------------------
+void tst_MemoryViewGenerator::testInvalidValuesAreWrittenAsGiven()
+{
+    VLNV masterVLNV(VLNV::COMPONENT, "tut.fi", "TestLib", "TestMaster", "1.0");
+    VLNV slaveVLNV(VLNV::COMPONENT, "tut.fi", "TestLib", "TestSlave", "1.0");
+
+    createMasterComponent(masterVLNV);
+
+    QSharedPointer<Component> slaveComponent = createSlaveComponent(slaveVLNV);
+
+    QSharedPointer<MemoryMap> slaveMemoryMap(new MemoryMap("slaveMemoryMap"));
+    slaveComponent->getMemoryMaps()->append(slaveMemoryMap);
+
+    QSharedPointer<AddressBlock> slaveAddressBlock = addAddressBlock("slaveBlock", "0", "8", "0xff", slaveMemoryMap);
+
+    QSharedPointer<Register> firstRegister(new Register("firstRegister", "0", "0xff"));
+    slaveAddressBlock->getRegisterData()->append(firstRegister);
+
+    createMasterAndSlaveInstances(masterVLNV, slaveVLNV);
+    connectMasterAndSlaveInstance();
+
+    QString output = runGenerator();
+
+    QCOMPARE(output, QString("Identifier;Type;Address;Range (AUB);Width (bits);Size (bits);Offset (bits);\n"
+        "tut.fi.TestLib.TestMaster.1.0.masterID.masterInstance.masterIf_space;addressSpace;0x0;;;;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap;memoryMap;0x0;;;;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap.slaveBlock;addressBlock;0x0;8;x;;;\n"
+        "tut.fi.TestLib.TestSlave.1.0.slaveID.slaveInstance.slaveMemoryMap.slaveBlock.firstRegister;register;0x0;;;x;;\n"
+    ));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryViewGenerator::testIsPresent()
 //-----------------------------------------------------------------------------
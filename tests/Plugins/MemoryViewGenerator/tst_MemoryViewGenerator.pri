@@ -12,6 +12,7 @@ HEADERS += ../../../editors/common/ComponentInstanceParameterFinder.h \
     ../../../editors/ComponentEditor/common/ExpressionFormatter.h \
     ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.h \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../../editors/MemoryDesigner/MasterSlavePathSearch.h \
@@ -20,6 +21,8 @@ HEADERS += ../../../editors/common/ComponentInstanceParameterFinder.h \
     ../../../Plugins/common/HDLParser/MetaComponent.h \
     ../../../Plugins/common/HDLParser/MetaDesign.h \
     ../../../Plugins/common/HDLParser/MetaInstance.h \
+    ../../../Plugins/common/HDLParser/MetaInstanceCache.h \
+    ../../../Plugins/common/HDLParser/MessageBuffer.h \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h \
     ../../../Plugins/PluginSystem/PluginUtilityAdapter.h \
@@ -37,6 +40,7 @@ SOURCES += ../../../editors/common/ComponentInstanceParameterFinder.cpp \
     ../../../editors/MemoryDesigner/ConnectivityInterface.cpp \
     ../../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../MockObjects/LibraryMock.cpp \
     ../../../editors/ComponentEditor/common/ListParameterFinder.cpp \
@@ -47,6 +51,8 @@ SOURCES += ../../../editors/common/ComponentInstanceParameterFinder.cpp \
     ../../../Plugins/common/HDLParser/MetaComponent.cpp \
     ../../../Plugins/common/HDLParser/MetaDesign.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
+    ../../../Plugins/common/HDLParser/MetaInstanceCache.cpp \
+    ../../../Plugins/common/HDLParser/MessageBuffer.cpp \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../../../editors/ComponentEditor/common/ParameterCache.cpp \
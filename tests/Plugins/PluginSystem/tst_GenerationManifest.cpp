@@ -0,0 +1,327 @@
+//-----------------------------------------------------------------------------
+// File: tst_GenerationManifest.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class GenerationManifest.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/OutputControl.h>
+
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace
+{
+    //! The name of the manifest file in the output directory.
+    const QString MANIFEST_FILE_NAME = QStringLiteral(".kactus2_generation_manifest.json");
+
+    //-----------------------------------------------------------------------------
+    //! Output with a fixed content that counts how many times it has been formatted.
+    //-----------------------------------------------------------------------------
+    struct TestOutput : public GenerationOutput
+    {
+        explicit TestOutput(QString const& content): content_(content) {}
+
+        virtual void write(QString const& /*outputDirectory*/) override
+        {
+            fileContent_ = content_;
+            writeCount_++;
+        }
+
+        virtual void getBodyHighlight(int& begin, int& end) const override
+        {
+            begin = -1;
+            end = -1;
+        }
+
+        //! The content to write.
+        QString content_;
+
+        //! The number of times the content has been formatted.
+        int writeCount_ = 0;
+    };
+}
+
+class tst_GenerationManifest : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_GenerationManifest();
+
+private slots:
+
+    void testSavedEntriesAreLoaded();
+    void testMissingManifestHasNoEntries();
+    void testCorruptManifestHasNoEntries();
+    void testManifestOfOtherVersionHasNoEntries();
+
+    void testNewFileIsWritten();
+    void testUnchangedInputsAndFileAreNotRewritten();
+    void testHandEditedFileIsRewritten();
+    void testChangedInputsAreRewritten();
+    void testIdenticalContentKeepsModificationTime();
+
+private:
+
+    void writeFile(QString const& filePath, QByteArray const& content);
+
+    QByteArray readFile(QString const& filePath);
+
+    void setModificationTime(QString const& filePath, QDateTime const& time);
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::tst_GenerationManifest()
+//-----------------------------------------------------------------------------
+tst_GenerationManifest::tst_GenerationManifest()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testSavedEntriesAreLoaded()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testSavedEntriesAreLoaded()
+{
+    QTemporaryDir outputDirectory;
+
+    GenerationManifest::Entry entry;
+    entry.inputHash = GenerationManifest::hash("inputs");
+    entry.contentHash = GenerationManifest::hash("content");
+
+    GenerationManifest manifest(outputDirectory.path());
+    manifest.setEntry("top.v", entry);
+    QVERIFY(manifest.save());
+
+    GenerationManifest loaded(outputDirectory.path());
+    loaded.load();
+
+    QCOMPARE(loaded.getEntry("top.v").inputHash, entry.inputHash);
+    QCOMPARE(loaded.getEntry("top.v").contentHash, entry.contentHash);
+    QVERIFY(loaded.getEntry("other.v").inputHash.isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testMissingManifestHasNoEntries()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testMissingManifestHasNoEntries()
+{
+    QTemporaryDir outputDirectory;
+
+    GenerationManifest manifest(outputDirectory.path());
+    manifest.load();
+
+    QVERIFY(manifest.getEntry("top.v").inputHash.isEmpty());
+    QVERIFY(manifest.getEntry("top.v").contentHash.isEmpty());
+
+    // Without a recorded generation, an existing file is rewritten.
+    QString const filePath = outputDirectory.filePath("top.v");
+    writeFile(filePath, "old content");
+
+    QSharedPointer<TestOutput> output(new TestOutput("new content"));
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, output,
+        outputDirectory.path(), GenerationManifest::hash("inputs"), manifest.getEntry("top.v"));
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::WRITTEN);
+    QCOMPARE(readFile(filePath), QByteArray("new content"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testCorruptManifestHasNoEntries()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testCorruptManifestHasNoEntries()
+{
+    QTemporaryDir outputDirectory;
+    writeFile(outputDirectory.filePath(MANIFEST_FILE_NAME), "{ \"version\": 1, \"files\": { \"top.v\": ");
+
+    GenerationManifest manifest(outputDirectory.path());
+    manifest.load();
+
+    QVERIFY(manifest.getEntry("top.v").inputHash.isEmpty());
+
+    // A corrupt manifest is replaced on the next save.
+    GenerationManifest::Entry entry;
+    entry.inputHash = GenerationManifest::hash("inputs");
+    manifest.setEntry("top.v", entry);
+    QVERIFY(manifest.save());
+
+    GenerationManifest loaded(outputDirectory.path());
+    loaded.load();
+    QCOMPARE(loaded.getEntry("top.v").inputHash, entry.inputHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testManifestOfOtherVersionHasNoEntries()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testManifestOfOtherVersionHasNoEntries()
+{
+    QTemporaryDir outputDirectory;
+    writeFile(outputDirectory.filePath(MANIFEST_FILE_NAME),
+        "{ \"version\": 999, \"files\": { \"top.v\": { \"inputs\": \"abc\", \"content\": \"def\" } } }");
+
+    GenerationManifest manifest(outputDirectory.path());
+    manifest.load();
+
+    QVERIFY(manifest.getEntry("top.v").inputHash.isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testNewFileIsWritten()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testNewFileIsWritten()
+{
+    QTemporaryDir outputDirectory;
+    QString const filePath = outputDirectory.filePath("top.v");
+
+    QSharedPointer<TestOutput> output(new TestOutput("module top;\nendmodule\n"));
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, output,
+        outputDirectory.path(), GenerationManifest::hash("inputs"), GenerationManifest::Entry());
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::WRITTEN);
+    QCOMPARE(readFile(filePath), QByteArray("module top;\nendmodule\n"));
+    QCOMPARE(result.contentHash, GenerationManifest::hash("module top;\nendmodule\n"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testUnchangedInputsAndFileAreNotRewritten()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testUnchangedInputsAndFileAreNotRewritten()
+{
+    QTemporaryDir outputDirectory;
+    QString const filePath = outputDirectory.filePath("top.v");
+
+    // The generated content differs, e.g. by a timestamp, but the file is not even formatted.
+    writeFile(filePath, "generated at 10:00");
+    QDateTime const writeTime = QDateTime::currentDateTime().addDays(-1);
+    setModificationTime(filePath, writeTime);
+
+    GenerationManifest::Entry recorded;
+    recorded.inputHash = GenerationManifest::hash("inputs");
+    recorded.contentHash = GenerationManifest::hash("generated at 10:00");
+
+    QSharedPointer<TestOutput> output(new TestOutput("generated at 11:00"));
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, output,
+        outputDirectory.path(), GenerationManifest::hash("inputs"), recorded);
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::UNCHANGED);
+    QCOMPARE(result.contentHash, recorded.contentHash);
+    QCOMPARE(output->writeCount_, 0);
+    QCOMPARE(readFile(filePath), QByteArray("generated at 10:00"));
+    QCOMPARE(QFileInfo(filePath).lastModified().toSecsSinceEpoch(), writeTime.toSecsSinceEpoch());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testHandEditedFileIsRewritten()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testHandEditedFileIsRewritten()
+{
+    QTemporaryDir outputDirectory;
+    QString const filePath = outputDirectory.filePath("top.v");
+
+    writeFile(filePath, "generated content with a manual edit");
+
+    GenerationManifest::Entry recorded;
+    recorded.inputHash = GenerationManifest::hash("inputs");
+    recorded.contentHash = GenerationManifest::hash("generated content");
+
+    QSharedPointer<TestOutput> output(new TestOutput("generated content"));
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, output,
+        outputDirectory.path(), GenerationManifest::hash("inputs"), recorded);
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::WRITTEN);
+    QCOMPARE(result.contentHash, recorded.contentHash);
+    QCOMPARE(readFile(filePath), QByteArray("generated content"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testChangedInputsAreRewritten()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testChangedInputsAreRewritten()
+{
+    QTemporaryDir outputDirectory;
+    QString const filePath = outputDirectory.filePath("top.v");
+
+    writeFile(filePath, "old content");
+
+    GenerationManifest::Entry recorded;
+    recorded.inputHash = GenerationManifest::hash("old inputs");
+    recorded.contentHash = GenerationManifest::hash("old content");
+
+    QSharedPointer<TestOutput> output(new TestOutput("new content"));
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, output,
+        outputDirectory.path(), GenerationManifest::hash("new inputs"), recorded);
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::WRITTEN);
+    QCOMPARE(output->writeCount_, 1);
+    QCOMPARE(readFile(filePath), QByteArray("new content"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::testIdenticalContentKeepsModificationTime()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::testIdenticalContentKeepsModificationTime()
+{
+    QTemporaryDir outputDirectory;
+    QString const filePath = outputDirectory.filePath("top.v");
+
+    writeFile(filePath, "module top;\nendmodule\n");
+    QDateTime const writeTime = QDateTime::currentDateTime().addDays(-1);
+    setModificationTime(filePath, writeTime);
+
+    // The inputs have changed, but they produce the same content.
+    GenerationManifest::Entry recorded;
+    recorded.inputHash = GenerationManifest::hash("old inputs");
+    recorded.contentHash = GenerationManifest::hash("module top;\nendmodule\n");
+
+    QSharedPointer<TestOutput> output(new TestOutput("module top;\nendmodule\n"));
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, output,
+        outputDirectory.path(), GenerationManifest::hash("new inputs"), recorded);
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::UNCHANGED);
+    QCOMPARE(result.contentHash, recorded.contentHash);
+    QCOMPARE(output->writeCount_, 1);
+    QCOMPARE(QFileInfo(filePath).lastModified().toSecsSinceEpoch(), writeTime.toSecsSinceEpoch());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::writeFile()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::writeFile(QString const& filePath, QByteArray const& content)
+{
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write(content);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::readFile()
+//-----------------------------------------------------------------------------
+QByteArray tst_GenerationManifest::readFile(QString const& filePath)
+{
+    QFile file(filePath);
+    file.open(QIODevice::ReadOnly);
+    return file.readAll();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GenerationManifest::setModificationTime()
+//-----------------------------------------------------------------------------
+void tst_GenerationManifest::setModificationTime(QString const& filePath, QDateTime const& time)
+{
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.setFileTime(time, QFileDevice::FileModificationTime));
+}
+
+QTEST_APPLESS_MAIN(tst_GenerationManifest)
+
+#include "tst_GenerationManifest.moc"
@@ -0,0 +1,9 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.h \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h
+SOURCES += ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
+    ./tst_GenerationManifest.cpp
@@ -22,4 +22,5 @@ SUBDIRS += VerilogGenerator/VerilogGenerator.pro \
 			MemoryMapHeaderGenerator/tst_MemoryMapHeaderGenerator.pro \
 #			MemoryViewGenerator/tst_MemoryViewGenerator.pro \
 			QuartusProjectGenerator/tst_QuartusProjectGenerator.pro \
-			LinuxDeviceTreeGenerator/tst_LinuxDeviceTreeGenerator.pro
+			LinuxDeviceTreeGenerator/tst_LinuxDeviceTreeGenerator.pro \
+			PluginSystem/tst_GenerationManifest.pro
@@ -21,6 +21,7 @@
 #include <Plugins/common/HDLParser/MetaComponent.h>
 #include <Plugins/VerilogImport/VerilogSyntax.h>
 #include <Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.h>
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
 #include <IPXACTmodels/AbstractionDefinition/PortAbstraction.h>
@@ -54,6 +55,8 @@ private slots:
 
     void testFileHeaderIsPrinted();
 
+    void testStreamedContentMatchesPreview();
+
     void testHierarchicalConnections();
     void testInstanceSlicedHierarchicalConnections();
     void testTopSlicedHierarchicalConnections();
@@ -91,6 +94,8 @@ private slots:
 
     void testDoNotWriteTransactionalConnections();
 
+    void testConcurrentAndSequentialGenerationAreIdentical();
+
 	void testGenerationWithImplementation();
 	void testGenerationWithImplementationWithTag();
 	void testGenerationWithImplementationWithPostModule();
@@ -148,6 +153,12 @@ private:
 
     QSharedPointer<Design> createDesignForComponent(QString const& designName, QSharedPointer<Component> component);
 
+    QSharedPointer<Design> createSubDesignForComponent(QString const& designName,
+        QSharedPointer<Component> component);
+
+    QStringList generateHierarchy(QSharedPointer<Component> topComponent, QSharedPointer<Design> topDesign,
+        bool concurrently);
+
     QSharedPointer<BusDefinition> createBusDefinition(QString const& definitionName);
 
     QSharedPointer<AbstractionDefinition> createAbstractionDefinition(QString const& definitionName);
@@ -407,6 +418,52 @@ void tst_VerilogWriterFactory::testFileHeaderIsPrinted()
         "//-----------------------------------------------------------------------------\n"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testStreamedContentMatchesPreview()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testStreamedContentMatchesPreview()
+{
+    QString const description = QString::fromUtf8("Non-ASCII description: \xc3\xa4\xc3\xb6 \xe2\x82\xac");
+    flatComponent_->getComponent()->setDescription(description);
+
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+    addPort("dataOut", 8, DirectionTypes::OUT, flatComponent_);
+    addParameter("dataWidth", "8", flatComponent_);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+
+    VerilogWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+
+    QTemporaryDir outputDirectory;
+    QSharedPointer<GenerationOutput> document = factory.prepareComponent(outputDirectory.path(), flatComponent_);
+
+    // Without preview formatting, the content is streamed to the file when the outputs are written.
+    QString const filePath = outputDirectory.filePath(document->fileName_);
+    GenerationManifest::WriteResult result = GenerationManifest::writeOutput(filePath, document,
+        outputDirectory.path(), QByteArray(), GenerationManifest::Entry());
+
+    QCOMPARE(result.status, GenerationManifest::WriteResult::WRITTEN);
+    QVERIFY(document->fileContent_.isEmpty());
+
+    QFile outputFile(filePath);
+    QVERIFY(outputFile.open(QIODevice::ReadOnly));
+    QString streamed = QString::fromUtf8(outputFile.readAll());
+
+    document->formatContent(outputDirectory.path());
+    QString preview = document->fileContent_;
+
+    // The files are written in UTF-8 regardless of the locale.
+    QVERIFY(streamed.contains(description));
+
+    // The creation time in the header may differ between the two.
+    QRegularExpression creationTime(QStringLiteral("^// Creation (date|time) : .*$"),
+        QRegularExpression::MultilineOption);
+    QCOMPARE(streamed.remove(creationTime), preview.remove(creationTime));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::testHierarchicalConnections()
 //-----------------------------------------------------------------------------
@@ -2097,6 +2154,127 @@ void tst_VerilogWriterFactory::testDoNotWriteTransactionalConnections()
         "        .wireOutPort         (TestRequirer_instance_wireOutPort));");
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testConcurrentAndSequentialGenerationAreIdentical()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testConcurrentAndSequentialGenerationAreIdentical()
+{
+    QSharedPointer<BusDefinition> busDefinition = createBusDefinition("dataBus");
+    QSharedPointer<AbstractionDefinition> abstractionDefinition = createAbstractionDefinition("dataAbstraction");
+
+    QSharedPointer<PortAbstraction> logicalData = addLogicalPortToAbstraction("DATA", abstractionDefinition,
+        General::MASTER, TransactionalTypes::INITIATIVE_INVALID, DirectionTypes::OUT);
+    addLogicalPortToAbstraction("DATA", abstractionDefinition, General::SLAVE,
+        TransactionalTypes::INITIATIVE_INVALID, DirectionTypes::IN);
+
+    // Not in the library, so each instance referring to it reports an error.
+    QSharedPointer<AbstractionDefinition> missingAbstraction(new AbstractionDefinition());
+    missingAbstraction->setVlnv(VLNV(VLNV::ABSTRACTIONDEFINITION, "Test", "TestLibrary", "missingAbstraction", "1.0"));
+
+    QSharedPointer<Component> sender = createComponent("sender");
+    QSharedPointer<BusInterface> senderBus = addBusInterfaceToComponent("dataOut", sender, General::MASTER,
+        busDefinition, abstractionDefinition);
+    mapPortsToBusInterface(senderBus, addPortToComponent("data_out", sender, TransactionalTypes::INITIATIVE_INVALID,
+        DirectionTypes::OUT), logicalData);
+
+    QSharedPointer<Component> receiver = createComponent("receiver");
+    QSharedPointer<BusInterface> receiverBus = addBusInterfaceToComponent("dataIn", receiver, General::SLAVE,
+        busDefinition, abstractionDefinition);
+    mapPortsToBusInterface(receiverBus, addPortToComponent("data_in", receiver,
+        TransactionalTypes::INITIATIVE_INVALID, DirectionTypes::IN), logicalData);
+
+    QSharedPointer<Component> broken = createComponent("broken");
+    addBusInterfaceToComponent("unknown", broken, General::MASTER, busDefinition, missingAbstraction);
+
+    // Third level of the hierarchy.
+    QSharedPointer<Component> lowComponent = createComponent("low");
+    QSharedPointer<Design> lowDesign = createSubDesignForComponent("lowDesign", lowComponent);
+    addInstanceToDesign(lowDesign, sender);
+    addInstanceToDesign(lowDesign, broken);
+
+    // Second level of the hierarchy.
+    QSharedPointer<Component> firstMiddle = createComponent("firstMiddle");
+    QSharedPointer<Design> firstMiddleDesign = createSubDesignForComponent("firstMiddleDesign", firstMiddle);
+    addInstanceToDesign(firstMiddleDesign, sender);
+    addInstanceToDesign(firstMiddleDesign, receiver);
+    addInstanceToDesign(firstMiddleDesign, broken);
+    addInterconnectionToDesign("firstConnection", firstMiddleDesign, "dataOut", "sender_instance", "dataIn",
+        "receiver_instance");
+
+    QSharedPointer<Component> secondMiddle = createComponent("secondMiddle");
+    QSharedPointer<Design> secondMiddleDesign = createSubDesignForComponent("secondMiddleDesign", secondMiddle);
+    addInstanceToDesign(secondMiddleDesign, sender);
+    addInstanceToDesign(secondMiddleDesign, receiver);
+    addInstanceToDesign(secondMiddleDesign, lowComponent);
+    addInterconnectionToDesign("secondConnection", secondMiddleDesign, "dataOut", "sender_instance", "dataIn",
+        "receiver_instance");
+
+    QSharedPointer<Component> topComponent = createComponent("top");
+    QSharedPointer<Design> topDesign = createDesignForComponent("topDesign", topComponent);
+    addInstanceToDesign(topDesign, firstMiddle);
+    addInstanceToDesign(topDesign, secondMiddle);
+
+    QStringList sequentialOutput = generateHierarchy(topComponent, topDesign, false);
+    QStringList sequentialMessages = errorMessages_;
+
+    QCOMPARE(sequentialOutput.size(), 4);
+    QCOMPARE(sequentialMessages.filter("missingAbstraction").size(), 2);
+
+    // Repeat the concurrent parsing, as the order of the threads varies.
+    for (int i = 0; i < 10; ++i)
+    {
+        errorMessages_.clear();
+
+        QCOMPARE(generateHierarchy(topComponent, topDesign, true), sequentialOutput);
+        QCOMPARE(errorMessages_, sequentialMessages);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::generateHierarchy()
+//-----------------------------------------------------------------------------
+QStringList tst_VerilogWriterFactory::generateHierarchy(QSharedPointer<Component> topComponent,
+    QSharedPointer<Design> topDesign, bool concurrently)
+{
+    MessagePasser messages;
+
+    connect(&messages, SIGNAL(errorMessage(const QString&)),
+        this, SLOT(gatherErrorMessage(QString const&)), Qt::UniqueConnection);
+
+    GenerationTuple input;
+    input.component = topComponent;
+    input.design = topDesign;
+    input.messages = &messages;
+
+    QList<QSharedPointer<MetaDesign> > designs =
+        MetaDesign::parseHierarchy(&library_, input, topComponent->getViews()->first(), concurrently);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    VerilogWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+
+    QStringList contents;
+    for (QSharedPointer<GenerationOutput> document : factory.prepareDesign(designs))
+    {
+        document->write(".");
+
+        // The creation time in the file header differs between the runs.
+        QStringList lines = document->fileContent_.split(QLatin1Char('\n'));
+        for (int i = lines.size() - 1; i >= 0; --i)
+        {
+            if (lines.at(i).startsWith(QLatin1String("// Creation")))
+            {
+                lines.removeAt(i);
+            }
+        }
+
+        contents.append(document->fileName_ + QLatin1Char('\n') + lines.join(QLatin1Char('\n')));
+    }
+
+    return contents;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::createComponent()
 //-----------------------------------------------------------------------------
@@ -2128,6 +2306,21 @@ QSharedPointer<Design> tst_VerilogWriterFactory::createDesignForComponent(QStrin
     return newDesign;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::createSubDesignForComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> tst_VerilogWriterFactory::createSubDesignForComponent(QString const& designName,
+    QSharedPointer<Component> component)
+{
+    QSharedPointer<Design> newDesign = createDesignForComponent(designName, component);
+
+    // Instances of the component refer to the design through the design instantiation.
+    component->getDesignInstantiations()->last()->setDesignReference(
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(newDesign->getVlnv())));
+
+    return newDesign;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::createBusDefinition()
 //-----------------------------------------------------------------------------
@@ -9,6 +9,7 @@ HEADERS += ../../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../../Plugins/VerilogGenerator/ComponentVerilogWriter/ComponentVerilogWriter.h \
     ../../../editors/ComponentEditor/common/ExpressionFormatter.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.h \
     ../../../Plugins/common/HDLParser/HDLParserCommon.h \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h \
@@ -17,6 +18,8 @@ HEADERS += ../../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../../Plugins/common/HDLParser/MetaComponent.h \
     ../../../Plugins/common/HDLParser/MetaDesign.h \
     ../../../Plugins/common/HDLParser/MetaInstance.h \
+    ../../../Plugins/common/HDLParser/MetaInstanceCache.h \
+    ../../../Plugins/common/HDLParser/MessageBuffer.h \
     ../../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.h \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h \
@@ -45,6 +48,7 @@ SOURCES += ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefault
     ../../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../../Plugins/VerilogGenerator/ComponentVerilogWriter/ComponentVerilogWriter.cpp \
     ../../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationManifest.cpp \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../../Plugins/common/PortSorter/InterfaceDirectionNameSorter.cpp \
     ../../MockObjects/LibraryMock.cpp \
@@ -53,6 +57,8 @@ SOURCES += ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefault
     ../../../Plugins/common/HDLParser/MetaComponent.cpp \
     ../../../Plugins/common/HDLParser/MetaDesign.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
+    ../../../Plugins/common/HDLParser/MetaInstanceCache.cpp \
+    ../../../Plugins/common/HDLParser/MessageBuffer.cpp \
     ../../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.cpp \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
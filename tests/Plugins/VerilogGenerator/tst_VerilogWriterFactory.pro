@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_VerilogWriterFactory
 
-QT += core xml gui testlib
+QT += core xml gui testlib concurrent
 CONFIG += c++11 testcase console
 
 DEFINES += VERILOGGENERATORPLUGIN_LIB
@@ -63,6 +63,7 @@ private slots:
     void testEmptyBounds();
     void testMasterToSlaveInterconnectionWithExpressions();
     void testMasterToMultipleSlavesInterconnections();
+    void testIdenticalInstancesDoNotShareParsedPorts();
     void testInterconnectionToVaryingSizeLogicalMaps();
     void testSlicedInterconnection();
     //void testAbsDefDefault();
@@ -1219,6 +1220,47 @@ void tst_HDLParser::testMasterToMultipleSlavesInterconnections()
     QCOMPARE(mWire->bounds_.second, QString("0"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_HDLParser::testIdenticalInstancesDoNotShareParsedPorts()
+//-----------------------------------------------------------------------------
+void tst_HDLParser::testIdenticalInstancesDoNotShareParsedPorts()
+{
+    VLNV senderVLNV(VLNV::COMPONENT, "Test", "TestLibrary", "TestSender", "1.0");
+    QSharedPointer<View> sendView = addSenderComponentToLibrary(senderVLNV, General::MASTER);
+    addInstanceToDesign("sender", senderVLNV, sendView);
+
+    VLNV receiverVLNV(VLNV::COMPONENT, "Test", "TestLibrary", "TestReceiver", "1.0");
+    QSharedPointer<View> recvView = addReceiverComponentToLibrary(receiverVLNV, General::SLAVE);
+    addInstanceToDesign("receiver1", receiverVLNV, recvView);
+    addInstanceToDesign("receiver2", receiverVLNV, recvView);
+
+    addConnectionToDesign("sender", "data_bus", "receiver1", "data_bus");
+
+    QList<QSharedPointer<MetaDesign> > designs = MetaDesign::parseHierarchy(&library_, input_, topView_);
+    QCOMPARE(designs.size(), 1);
+
+    QSharedPointer<MetaInstance> first = designs.first()->getInstances()->value("receiver1");
+    QSharedPointer<MetaInstance> second = designs.first()->getInstances()->value("receiver2");
+
+    // The instances share the component, but each has its own parsed ports and interfaces.
+    QCOMPARE(first->getComponent(), second->getComponent());
+
+    QSharedPointer<MetaPort> firstPort = first->getPorts()->value("data_in");
+    QSharedPointer<MetaPort> secondPort = second->getPorts()->value("data_in");
+    QVERIFY(firstPort != secondPort);
+    QCOMPARE(first->getInterfaces()->value("data_bus")->ports_.value("data_in"), firstPort);
+    QCOMPARE(second->getInterfaces()->value("data_bus")->ports_.value("data_in"), secondPort);
+
+    QCOMPARE(secondPort->vectorBounds_, firstPort->vectorBounds_);
+
+    // Only the connected instance has its assignments attached to the interconnection.
+    QSharedPointer<MetaPortAssignment> connected = firstPort->upAssignments_.value("DATA");
+    QVERIFY(connected && connected->wire_);
+
+    QSharedPointer<MetaPortAssignment> unconnected = secondPort->upAssignments_.value("DATA");
+    QVERIFY(!unconnected || !unconnected->wire_);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_HDLParser::testInterconnectionToVaryingSizeLogicalMaps()
 //-----------------------------------------------------------------------------
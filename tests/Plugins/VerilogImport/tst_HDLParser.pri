@@ -10,6 +10,8 @@ HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../Plugins/common/HDLParser/MetaComponent.h \
     ../../../Plugins/common/HDLParser/MetaDesign.h \
     ../../../Plugins/common/HDLParser/MetaInstance.h \
+    ../../../Plugins/common/HDLParser/MetaInstanceCache.h \
+    ../../../Plugins/common/HDLParser/MessageBuffer.h \
     ../../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.h \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.h \
     ../../../editors/ComponentEditor/common/ParameterFinder.h \
@@ -29,6 +31,8 @@ SOURCES += ../../../editors/ComponentEditor/common/ComponentParameterFinder.cpp
     ../../../Plugins/common/HDLParser/MetaComponent.cpp \
     ../../../Plugins/common/HDLParser/MetaDesign.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
+    ../../../Plugins/common/HDLParser/MetaInstanceCache.cpp \
+    ../../../Plugins/common/HDLParser/MessageBuffer.cpp \
     ../../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
     ../../../editors/common/TopComponentParameterFinder.cpp \
@@ -0,0 +1,797 @@
+//-----------------------------------------------------------------------------
+// File: tst_DocumentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class DocumentStreamReader.
+//-----------------------------------------------------------------------------
+
+#include <library/DocumentStreamReader.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/ComponentReader.h>
+#include <IPXACTmodels/Component/ComponentWriter.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Model.h>
+#include <IPXACTmodels/Component/Register.h>
+
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/Design/DesignReader.h>
+#include <IPXACTmodels/Design/DesignWriter.h>
+
+#include <QBuffer>
+#include <QDomDocument>
+#include <QXmlStreamWriter>
+#include <QtTest>
+
+class tst_DocumentStreamReader : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_DocumentStreamReader();
+
+private slots:
+
+    void testDocumentIsEquivalentToDomReading();
+    void testDocumentIsEquivalentToDomReading_data();
+
+    void testComponentRoundTrip();
+    void testComponentRoundTrip_data();
+
+    void testDesignRoundTrip();
+
+    void testMemoryMapsAndPortsAreNotInDom();
+
+    void testDocumentTypeIsReadFromRoot();
+    void testDocumentTypeIsReadFromRoot_data();
+
+    void testMalformedDocumentFails();
+    void testMalformedDocumentFails_data();
+
+    void testEstimatedModelSizeIgnoresMarkup();
+
+private:
+
+    QDomDocument readWithStream(QString const& content) const;
+
+    QDomDocument readWithDom(QString const& content) const;
+
+    QSharedPointer<Component> readComponentWithStream(QString const& content) const;
+
+    void removeStreamedElements(QDomDocument& document) const;
+
+    QString writeComponent(QSharedPointer<Component> component) const;
+
+    QString writeDesign(QSharedPointer<Design> design) const;
+
+    void addDocumentRows() const;
+};
+
+namespace
+{
+    const QString DOCUMENT_START(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!-- Header comments -->\n"
+        "<?xml-stylesheet href=\"style.css\"?>\n"
+        "<ipxact:component "
+        "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+        "xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\" "
+        "xmlns:kactus2=\"http://kactus2.cs.tut.fi\" "
+        "xsi:schemaLocation=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014/ "
+        "http://www.accellera.org/XMLSchema/IPXACT/1685-2014/index.xsd\">\n"
+        "    <ipxact:vendor>TUT</ipxact:vendor>\n"
+        "    <ipxact:library>TestLibrary</ipxact:library>\n"
+        "    <ipxact:name>TestComponent</ipxact:name>\n"
+        "    <ipxact:version>1.0</ipxact:version>\n");
+
+    const QString DOCUMENT_END("</ipxact:component>\n");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::tst_DocumentStreamReader()
+//-----------------------------------------------------------------------------
+tst_DocumentStreamReader::tst_DocumentStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDocumentIsEquivalentToDomReading()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDocumentIsEquivalentToDomReading()
+{
+    QFETCH(QString, content);
+
+    QDomDocument expected = readWithDom(content);
+    QDomDocument streamed = readWithStream(content);
+
+    // Memory maps and ports are created directly from the stream.
+    removeStreamedElements(expected);
+
+    QCOMPARE(streamed.documentElement().toString(), expected.documentElement().toString());
+
+    // Nodes before the root element, apart from the XML declaration, must match as well.
+    QDomNodeList expectedNodes = expected.childNodes();
+    QStringList expectedProlog;
+    for (int i = 0; i < expectedNodes.size(); ++i)
+    {
+        QDomNode node = expectedNodes.at(i);
+        if (!node.isProcessingInstruction() || node.toProcessingInstruction().target() != QLatin1String("xml"))
+        {
+            QString text;
+            QTextStream stream(&text);
+            node.save(stream, 0);
+            expectedProlog.append(text);
+        }
+    }
+
+    QDomNodeList streamedNodes = streamed.childNodes();
+    QStringList streamedProlog;
+    for (int i = 0; i < streamedNodes.size(); ++i)
+    {
+        QString text;
+        QTextStream stream(&text);
+        streamedNodes.at(i).save(stream, 0);
+        streamedProlog.append(text);
+    }
+
+    QCOMPARE(streamedProlog, expectedProlog);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDocumentIsEquivalentToDomReading_data()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDocumentIsEquivalentToDomReading_data()
+{
+    addDocumentRows();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testComponentRoundTrip()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testComponentRoundTrip()
+{
+    QFETCH(QString, content);
+
+    ComponentReader reader;
+    QSharedPointer<Component> expected = reader.createComponentFrom(readWithDom(content));
+    QSharedPointer<Component> streamed = readComponentWithStream(content);
+
+    QCOMPARE(streamed->getTopComments(), expected->getTopComments());
+    QCOMPARE(streamed->getXmlProcessingInstructions(), expected->getXmlProcessingInstructions());
+    QCOMPARE(writeComponent(streamed), writeComponent(expected));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testComponentRoundTrip_data()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testComponentRoundTrip_data()
+{
+    addDocumentRows();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDesignRoundTrip()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDesignRoundTrip()
+{
+    QString content(
+        "<?xml version=\"1.0\"?>\n"
+        "<ipxact:design "
+        "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+        "xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\" "
+        "xmlns:kactus2=\"http://kactus2.cs.tut.fi\">\n"
+        "    <ipxact:vendor>TUT</ipxact:vendor>\n"
+        "    <ipxact:library>TestLibrary</ipxact:library>\n"
+        "    <ipxact:name>TestDesign</ipxact:name>\n"
+        "    <ipxact:version>1.0</ipxact:version>\n"
+        "    <ipxact:componentInstances>\n"
+        "        <ipxact:componentInstance>\n"
+        "            <ipxact:instanceName>instance0</ipxact:instanceName>\n"
+        "            <ipxact:componentRef vendor=\"TUT\" library=\"TestLibrary\" name=\"TestComponent\" "
+        "version=\"1.0\"/>\n"
+        "        </ipxact:componentInstance>\n"
+        "    </ipxact:componentInstances>\n"
+        "    <ipxact:interconnections>\n"
+        "        <ipxact:interconnection>\n"
+        "            <ipxact:name>connection</ipxact:name>\n"
+        "            <ipxact:activeInterface componentRef=\"instance0\" busRef=\"bus\"/>\n"
+        "            <ipxact:hierInterface busRef=\"top\"/>\n"
+        "        </ipxact:interconnection>\n"
+        "    </ipxact:interconnections>\n"
+        "</ipxact:design>\n");
+
+    DesignReader reader;
+    QSharedPointer<Design> expected = reader.createDesignFrom(readWithDom(content));
+    QSharedPointer<Design> streamed = reader.createDesignFrom(readWithStream(content));
+
+    QCOMPARE(writeDesign(streamed), writeDesign(expected));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testMemoryMapsAndPortsAreNotInDom()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testMemoryMapsAndPortsAreNotInDom()
+{
+    QString content(DOCUMENT_START +
+        "    <ipxact:memoryMaps>\n"
+        "        <ipxact:memoryMap>\n"
+        "            <ipxact:name>firstMap</ipxact:name>\n"
+        "            <ipxact:addressBlock>\n"
+        "                <ipxact:name>block</ipxact:name>\n"
+        "                <ipxact:register>\n"
+        "                    <ipxact:name>register</ipxact:name>\n"
+        "                </ipxact:register>\n"
+        "            </ipxact:addressBlock>\n"
+        "        </ipxact:memoryMap>\n"
+        "        <ipxact:memoryMap>\n"
+        "            <ipxact:name>secondMap</ipxact:name>\n"
+        "        </ipxact:memoryMap>\n"
+        "    </ipxact:memoryMaps>\n"
+        "    <ipxact:model>\n"
+        "        <ipxact:ports>\n"
+        "            <ipxact:port>\n"
+        "                <ipxact:name>clk</ipxact:name>\n"
+        "                <ipxact:wire>\n"
+        "                    <ipxact:direction>in</ipxact:direction>\n"
+        "                </ipxact:wire>\n"
+        "            </ipxact:port>\n"
+        "        </ipxact:ports>\n"
+        "    </ipxact:model>\n" +
+        DOCUMENT_END);
+
+    QByteArray data = content.toUtf8();
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+
+    DocumentStreamReader documentReader(&buffer);
+    documentReader.readDocumentType();
+    QVERIFY(documentReader.readDocument());
+
+    QDomDocument document = documentReader.getDocument();
+    QCOMPARE(document.elementsByTagName(QStringLiteral("ipxact:memoryMap")).count(), 0);
+    QCOMPARE(document.elementsByTagName(QStringLiteral("ipxact:register")).count(), 0);
+    QCOMPARE(document.elementsByTagName(QStringLiteral("ipxact:port")).count(), 0);
+
+    ComponentReader reader;
+    QSharedPointer<Component> component = reader.createComponentFrom(document);
+    documentReader.addStreamedItems(component);
+
+    QCOMPARE(component->getMemoryMaps()->count(), 2);
+    QCOMPARE(component->getMemoryMaps()->first()->name(), QString("firstMap"));
+    QCOMPARE(component->getMemoryMaps()->last()->name(), QString("secondMap"));
+
+    QSharedPointer<AddressBlock> block =
+        component->getMemoryMaps()->first()->getMemoryBlocks()->first().dynamicCast<AddressBlock>();
+    QVERIFY(block.isNull() == false);
+    QCOMPARE(block->getRegisterData()->count(), 1);
+    QCOMPARE(block->getRegisterData()->first()->name(), QString("register"));
+
+    QCOMPARE(component->getModel()->getPorts()->count(), 1);
+    QCOMPARE(component->getModel()->getPorts()->first()->name(), QString("clk"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDocumentTypeIsReadFromRoot()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDocumentTypeIsReadFromRoot()
+{
+    QFETCH(QString, content);
+    QFETCH(int, expectedType);
+
+    QByteArray data = content.toUtf8();
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+
+    DocumentStreamReader reader(&buffer);
+    QCOMPARE(static_cast<int>(reader.readDocumentType()), expectedType);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDocumentTypeIsReadFromRoot_data()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDocumentTypeIsReadFromRoot_data()
+{
+    QTest::addColumn<QString>("content");
+    QTest::addColumn<int>("expectedType");
+
+    QTest::newRow("component") << DOCUMENT_START + DOCUMENT_END << static_cast<int>(VLNV::COMPONENT);
+    QTest::newRow("bus definition") << QString("<ipxact:busDefinition></ipxact:busDefinition>") <<
+        static_cast<int>(VLNV::BUSDEFINITION);
+    QTest::newRow("unknown root") << QString("<?xml version=\"1.0\"?><project><name/></project>") <<
+        static_cast<int>(VLNV::INVALID);
+
+    // The type is known before the malformed content is reached.
+    QTest::newRow("type before error") << QString("<ipxact:design><ipxact:vendor></ipxact:design>") <<
+        static_cast<int>(VLNV::DESIGN);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testMalformedDocumentFails()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testMalformedDocumentFails()
+{
+    QFETCH(QString, content);
+
+    QDomDocument reference;
+    QVERIFY(reference.setContent(content) == false);
+
+    QByteArray data = content.toUtf8();
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+
+    DocumentStreamReader reader(&buffer);
+    reader.readDocumentType();
+
+    QCOMPARE(reader.readDocument(), false);
+    QVERIFY(reader.errorString().isEmpty() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testMalformedDocumentFails_data()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testMalformedDocumentFails_data()
+{
+    QTest::addColumn<QString>("content");
+
+    QTest::newRow("empty") << QString();
+    QTest::newRow("not XML") << QString("This is not XML.");
+    QTest::newRow("mismatched tags") << DOCUMENT_START + QString("<ipxact:description></ipxact:name>") +
+        DOCUMENT_END;
+    QTest::newRow("unterminated") << DOCUMENT_START;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testEstimatedModelSizeIgnoresMarkup()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testEstimatedModelSizeIgnoresMarkup()
+{
+    auto estimate = [](QString const& content)
+    {
+        QByteArray data = content.toUtf8();
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::ReadOnly);
+
+        DocumentStreamReader reader(&buffer);
+        reader.readDocumentType();
+        reader.readDocument();
+        return reader.getEstimatedModelSize();
+    };
+
+    qint64 const empty = estimate(DOCUMENT_START + DOCUMENT_END);
+    QVERIFY(empty > 0);
+
+    qint64 const described = estimate(DOCUMENT_START +
+        "    <ipxact:description>Description</ipxact:description>\n" + DOCUMENT_END);
+    QVERIFY(described > empty);
+
+    // Indentation and comments are not stored in the models.
+    QCOMPARE(estimate(DOCUMENT_START + "<ipxact:description>Description</ipxact:description>" + DOCUMENT_END),
+        described);
+    QCOMPARE(estimate(DOCUMENT_START + "    <!-- comment -->\n" + DOCUMENT_END), empty);
+
+    // Longer text takes more memory.
+    QVERIFY(estimate(DOCUMENT_START + "<ipxact:description>Longer description</ipxact:description>" +
+        DOCUMENT_END) > described);
+
+    // Memory maps created directly from the stream are estimated in the same way.
+    qint64 const mapped = estimate(DOCUMENT_START +
+        "    <ipxact:memoryMaps>\n"
+        "        <ipxact:memoryMap>\n"
+        "            <ipxact:name>map</ipxact:name>\n"
+        "            <!-- comment -->\n"
+        "        </ipxact:memoryMap>\n"
+        "    </ipxact:memoryMaps>\n" + DOCUMENT_END);
+    QVERIFY(mapped > empty);
+    QCOMPARE(estimate(DOCUMENT_START + "<ipxact:memoryMaps><ipxact:memoryMap><ipxact:name>map</ipxact:name>"
+        "</ipxact:memoryMap></ipxact:memoryMaps>" + DOCUMENT_END), mapped);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::readWithStream()
+//-----------------------------------------------------------------------------
+QDomDocument tst_DocumentStreamReader::readWithStream(QString const& content) const
+{
+    QByteArray data = content.toUtf8();
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+
+    DocumentStreamReader reader(&buffer);
+    reader.readDocumentType();
+    if (reader.readDocument() == false)
+    {
+        QTest::qFail(qPrintable(reader.errorString()), __FILE__, __LINE__);
+    }
+
+    return reader.getDocument();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::readWithDom()
+//-----------------------------------------------------------------------------
+QDomDocument tst_DocumentStreamReader::readWithDom(QString const& content) const
+{
+    QDomDocument document;
+    document.setContent(content.toUtf8());
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::readComponentWithStream()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_DocumentStreamReader::readComponentWithStream(QString const& content) const
+{
+    QByteArray data = content.toUtf8();
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+
+    DocumentStreamReader documentReader(&buffer);
+    documentReader.readDocumentType();
+    if (documentReader.readDocument() == false)
+    {
+        QTest::qFail(qPrintable(documentReader.errorString()), __FILE__, __LINE__);
+    }
+
+    ComponentReader reader;
+    QSharedPointer<Component> component = reader.createComponentFrom(documentReader.getDocument());
+    documentReader.addStreamedItems(component);
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::removeStreamedElements()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::removeStreamedElements(QDomDocument& document) const
+{
+    QDomElement rootElement = document.documentElement();
+
+    QList<QDomElement> removedElements;
+
+    QDomElement memoryMaps = rootElement.firstChildElement(QStringLiteral("ipxact:memoryMaps"));
+    for (QDomElement memoryMap = memoryMaps.firstChildElement(QStringLiteral("ipxact:memoryMap"));
+        memoryMap.isNull() == false; memoryMap = memoryMap.nextSiblingElement(QStringLiteral("ipxact:memoryMap")))
+    {
+        removedElements.append(memoryMap);
+    }
+
+    QDomElement ports = rootElement.firstChildElement(QStringLiteral("ipxact:model")).firstChildElement(
+        QStringLiteral("ipxact:ports"));
+    for (QDomElement port = ports.firstChildElement(QStringLiteral("ipxact:port"));
+        port.isNull() == false; port = port.nextSiblingElement(QStringLiteral("ipxact:port")))
+    {
+        removedElements.append(port);
+    }
+
+    for (QDomElement& element : removedElements)
+    {
+        element.parentNode().removeChild(element);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::writeComponent()
+//-----------------------------------------------------------------------------
+QString tst_DocumentStreamReader::writeComponent(QSharedPointer<Component> component) const
+{
+    QString output;
+    QXmlStreamWriter xmlStreamWriter(&output);
+
+    ComponentWriter writer;
+    writer.writeComponent(xmlStreamWriter, component);
+
+    return output;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::writeDesign()
+//-----------------------------------------------------------------------------
+QString tst_DocumentStreamReader::writeDesign(QSharedPointer<Design> design) const
+{
+    QString output;
+    QXmlStreamWriter xmlStreamWriter(&output);
+
+    DesignWriter writer;
+    writer.writeDesign(xmlStreamWriter, design);
+
+    return output;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::addDocumentRows()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::addDocumentRows() const
+{
+    QTest::addColumn<QString>("content");
+
+    QTest::newRow("header only") << DOCUMENT_START + DOCUMENT_END;
+
+    QTest::newRow("text with entities") << DOCUMENT_START +
+        "    <ipxact:description>Width &lt; 32 &amp;&amp; depth &gt; 8 &#x41;</ipxact:description>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("CDATA") << DOCUMENT_START +
+        "    <ipxact:description><![CDATA[if (a < b) { return; }]]></ipxact:description>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("comments inside") << DOCUMENT_START +
+        "    <!-- Comment inside the root element. -->\n"
+        "    <ipxact:description>Before<!-- inner -->After</ipxact:description>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("memory map") << DOCUMENT_START +
+        "    <ipxact:memoryMaps>\n"
+        "        <ipxact:memoryMap>\n"
+        "            <ipxact:name>memoryMap</ipxact:name>\n"
+        "            <ipxact:addressBlock>\n"
+        "                <ipxact:name>block</ipxact:name>\n"
+        "                <ipxact:baseAddress>'h0</ipxact:baseAddress>\n"
+        "                <ipxact:range>4096</ipxact:range>\n"
+        "                <ipxact:width>32</ipxact:width>\n"
+        "                <ipxact:register>\n"
+        "                    <ipxact:name>register</ipxact:name>\n"
+        "                    <ipxact:addressOffset>'h4</ipxact:addressOffset>\n"
+        "                    <ipxact:size>32</ipxact:size>\n"
+        "                    <ipxact:field>\n"
+        "                        <ipxact:name>field</ipxact:name>\n"
+        "                        <ipxact:bitOffset>0</ipxact:bitOffset>\n"
+        "                        <ipxact:bitWidth>8</ipxact:bitWidth>\n"
+        "                    </ipxact:field>\n"
+        "                </ipxact:register>\n"
+        "            </ipxact:addressBlock>\n"
+        "        </ipxact:memoryMap>\n"
+        "    </ipxact:memoryMaps>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("ports and parameters") << DOCUMENT_START +
+        "    <ipxact:model>\n"
+        "        <ipxact:ports>\n"
+        "            <ipxact:port>\n"
+        "                <ipxact:name>data</ipxact:name>\n"
+        "                <ipxact:wire>\n"
+        "                    <ipxact:direction>in</ipxact:direction>\n"
+        "                    <ipxact:vectors>\n"
+        "                        <ipxact:vector>\n"
+        "                            <ipxact:left>width - 1</ipxact:left>\n"
+        "                            <ipxact:right>0</ipxact:right>\n"
+        "                        </ipxact:vector>\n"
+        "                    </ipxact:vectors>\n"
+        "                </ipxact:wire>\n"
+        "            </ipxact:port>\n"
+        "        </ipxact:ports>\n"
+        "    </ipxact:model>\n"
+        "    <ipxact:parameters>\n"
+        "        <ipxact:parameter parameterId=\"width\" resolve=\"user\" type=\"longint\">\n"
+        "            <ipxact:name>width</ipxact:name>\n"
+        "            <ipxact:value>8</ipxact:value>\n"
+        "        </ipxact:parameter>\n"
+        "    </ipxact:parameters>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("memory map details") << DOCUMENT_START +
+        "    <ipxact:memoryMaps>\n"
+        "        <ipxact:memoryMap>\n"
+        "            <ipxact:name>memoryMap</ipxact:name>\n"
+        "            <ipxact:displayName>Memory map</ipxact:displayName>\n"
+        "            <ipxact:description>Map &lt; 4 GB<!-- comment --></ipxact:description>\n"
+        "            <ipxact:isPresent>1</ipxact:isPresent>\n"
+        "            <ipxact:addressBlock>\n"
+        "                <ipxact:name>block</ipxact:name>\n"
+        "                <ipxact:isPresent>1</ipxact:isPresent>\n"
+        "                <ipxact:baseAddress>'h1000</ipxact:baseAddress>\n"
+        "                <ipxact:typeIdentifier>blockType</ipxact:typeIdentifier>\n"
+        "                <ipxact:range>4096</ipxact:range>\n"
+        "                <ipxact:width>32</ipxact:width>\n"
+        "                <ipxact:usage>register</ipxact:usage>\n"
+        "                <ipxact:volatile>true</ipxact:volatile>\n"
+        "                <ipxact:access>read-write</ipxact:access>\n"
+        "                <ipxact:parameters>\n"
+        "                    <ipxact:parameter parameterId=\"blockParameter\" resolve=\"user\">\n"
+        "                        <ipxact:name>blockParameter</ipxact:name>\n"
+        "                        <ipxact:value>4</ipxact:value>\n"
+        "                    </ipxact:parameter>\n"
+        "                </ipxact:parameters>\n"
+        "                <ipxact:register>\n"
+        "                    <ipxact:name>re<!-- inner -->gister</ipxact:name>\n"
+        "                    <ipxact:isPresent>blockParameter &gt; 2</ipxact:isPresent>\n"
+        "                    <ipxact:dim>4</ipxact:dim>\n"
+        "                    <ipxact:addressOffset>'h4</ipxact:addressOffset>\n"
+        "                    <ipxact:typeIdentifier>registerType</ipxact:typeIdentifier>\n"
+        "                    <ipxact:size>32</ipxact:size>\n"
+        "                    <ipxact:volatile>false</ipxact:volatile>\n"
+        "                    <ipxact:access>read-only</ipxact:access>\n"
+        "                    <ipxact:field fieldID=\"fieldId\">\n"
+        "                        <ipxact:name>field</ipxact:name>\n"
+        "                        <ipxact:bitOffset>0</ipxact:bitOffset>\n"
+        "                        <ipxact:resets>\n"
+        "                            <ipxact:reset resetTypeRef=\"soft\">\n"
+        "                                <ipxact:value>'h0</ipxact:value>\n"
+        "                                <ipxact:mask>'hF</ipxact:mask>\n"
+        "                            </ipxact:reset>\n"
+        "                            <ipxact:reset>\n"
+        "                                <ipxact:value>1</ipxact:value>\n"
+        "                            </ipxact:reset>\n"
+        "                        </ipxact:resets>\n"
+        "                        <ipxact:typeIdentifier>fieldType</ipxact:typeIdentifier>\n"
+        "                        <ipxact:bitWidth>8</ipxact:bitWidth>\n"
+        "                        <ipxact:volatile>true</ipxact:volatile>\n"
+        "                        <ipxact:access>read-write</ipxact:access>\n"
+        "                        <ipxact:enumeratedValues>\n"
+        "                            <ipxact:enumeratedValue usage=\"read\">\n"
+        "                                <ipxact:name>enabled</ipxact:name>\n"
+        "                                <ipxact:value>1</ipxact:value>\n"
+        "                            </ipxact:enumeratedValue>\n"
+        "                        </ipxact:enumeratedValues>\n"
+        "                        <ipxact:modifiedWriteValue modify=\"mask\">oneToClear</ipxact:modifiedWriteValue>\n"
+        "                        <ipxact:writeValueConstraint>\n"
+        "                            <ipxact:minimum>0</ipxact:minimum>\n"
+        "                            <ipxact:maximum>100</ipxact:maximum>\n"
+        "                        </ipxact:writeValueConstraint>\n"
+        "                        <ipxact:readAction modify=\"all\">clear</ipxact:readAction>\n"
+        "                        <ipxact:testable testConstraint=\"restore\">true</ipxact:testable>\n"
+        "                        <ipxact:reserved>0</ipxact:reserved>\n"
+        "                        <ipxact:parameters>\n"
+        "                            <ipxact:parameter parameterId=\"fieldParameter\">\n"
+        "                                <ipxact:name>fieldParameter</ipxact:name>\n"
+        "                                <ipxact:value>1</ipxact:value>\n"
+        "                            </ipxact:parameter>\n"
+        "                        </ipxact:parameters>\n"
+        "                        <ipxact:vendorExtensions>\n"
+        "                            <fieldExtension>value</fieldExtension>\n"
+        "                        </ipxact:vendorExtensions>\n"
+        "                    </ipxact:field>\n"
+        "                    <ipxact:field>\n"
+        "                        <ipxact:name>constrained</ipxact:name>\n"
+        "                        <ipxact:bitOffset>8</ipxact:bitOffset>\n"
+        "                        <ipxact:bitWidth>1</ipxact:bitWidth>\n"
+        "                        <ipxact:writeValueConstraint>\n"
+        "                            <ipxact:writeAsRead>true</ipxact:writeAsRead>\n"
+        "                        </ipxact:writeValueConstraint>\n"
+        "                    </ipxact:field>\n"
+        "                    <ipxact:alternateRegisters>\n"
+        "                        <ipxact:alternateRegister>\n"
+        "                            <ipxact:name>alternate</ipxact:name>\n"
+        "                            <ipxact:alternateGroups>\n"
+        "                                <ipxact:alternateGroup>first</ipxact:alternateGroup>\n"
+        "                                <ipxact:alternateGroup>second</ipxact:alternateGroup>\n"
+        "                            </ipxact:alternateGroups>\n"
+        "                            <ipxact:volatile>true</ipxact:volatile>\n"
+        "                            <ipxact:field>\n"
+        "                                <ipxact:name>alternateField</ipxact:name>\n"
+        "                                <ipxact:bitOffset>0</ipxact:bitOffset>\n"
+        "                                <ipxact:bitWidth>32</ipxact:bitWidth>\n"
+        "                            </ipxact:field>\n"
+        "                        </ipxact:alternateRegister>\n"
+        "                    </ipxact:alternateRegisters>\n"
+        "                    <ipxact:parameters>\n"
+        "                        <ipxact:parameter parameterId=\"registerParameter\">\n"
+        "                            <ipxact:name>registerParameter</ipxact:name>\n"
+        "                            <ipxact:value>2</ipxact:value>\n"
+        "                        </ipxact:parameter>\n"
+        "                    </ipxact:parameters>\n"
+        "                    <ipxact:vendorExtensions>\n"
+        "                        <kactus2:ignored/>\n"
+        "                        <registerExtension attribute=\"value\"><inner>text</inner></registerExtension>\n"
+        "                    </ipxact:vendorExtensions>\n"
+        "                </ipxact:register>\n"
+        "                <ipxact:registerFile>\n"
+        "                    <ipxact:name>registerFile</ipxact:name>\n"
+        "                    <ipxact:dim>2</ipxact:dim>\n"
+        "                    <ipxact:addressOffset>'h100</ipxact:addressOffset>\n"
+        "                    <ipxact:range>16</ipxact:range>\n"
+        "                    <ipxact:register>\n"
+        "                        <ipxact:name>fileRegister</ipxact:name>\n"
+        "                        <ipxact:addressOffset>0</ipxact:addressOffset>\n"
+        "                        <ipxact:size>8</ipxact:size>\n"
+        "                    </ipxact:register>\n"
+        "                </ipxact:registerFile>\n"
+        "                <ipxact:vendorExtensions>\n"
+        "                    <blockExtension/>\n"
+        "                </ipxact:vendorExtensions>\n"
+        "            </ipxact:addressBlock>\n"
+        "            <ipxact:subspaceMap masterRef=\"master\">\n"
+        "                <ipxact:name>subspace</ipxact:name>\n"
+        "                <ipxact:baseAddress>'h2000</ipxact:baseAddress>\n"
+        "            </ipxact:subspaceMap>\n"
+        "            <ipxact:memoryRemap state=\"remapState\">\n"
+        "                <ipxact:name>remap</ipxact:name>\n"
+        "                <ipxact:addressBlock>\n"
+        "                    <ipxact:name>remapBlock</ipxact:name>\n"
+        "                    <ipxact:baseAddress>0</ipxact:baseAddress>\n"
+        "                    <ipxact:range>16</ipxact:range>\n"
+        "                    <ipxact:width>8</ipxact:width>\n"
+        "                </ipxact:addressBlock>\n"
+        "            </ipxact:memoryRemap>\n"
+        "            <ipxact:addressUnitBits>8</ipxact:addressUnitBits>\n"
+        "            <ipxact:shared>yes</ipxact:shared>\n"
+        "            <ipxact:vendorExtensions>\n"
+        "                <mapExtension>text</mapExtension>\n"
+        "            </ipxact:vendorExtensions>\n"
+        "        </ipxact:memoryMap>\n"
+        "    </ipxact:memoryMaps>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("port details") << DOCUMENT_START +
+        "    <ipxact:model>\n"
+        "        <ipxact:ports>\n"
+        "            <ipxact:port>\n"
+        "                <ipxact:name>data</ipxact:name>\n"
+        "                <ipxact:description><![CDATA[Data <bus>]]></ipxact:description>\n"
+        "                <ipxact:isPresent>1</ipxact:isPresent>\n"
+        "                <ipxact:wire allLogicalDirectionsAllowed=\"true\">\n"
+        "                    <ipxact:direction>out</ipxact:direction>\n"
+        "                    <ipxact:vectors>\n"
+        "                        <ipxact:vector>\n"
+        "                            <ipxact:left>7</ipxact:left>\n"
+        "                            <ipxact:right>0</ipxact:right>\n"
+        "                        </ipxact:vector>\n"
+        "                    </ipxact:vectors>\n"
+        "                    <ipxact:wireTypeDefs>\n"
+        "                        <ipxact:wireTypeDef>\n"
+        "                            <ipxact:typeName constrained=\"true\">std_logic_vector</ipxact:typeName>\n"
+        "                            <ipxact:typeDefinition>IEEE.std_logic_1164.all</ipxact:typeDefinition>\n"
+        "                            <ipxact:viewRef>rtl</ipxact:viewRef>\n"
+        "                        </ipxact:wireTypeDef>\n"
+        "                    </ipxact:wireTypeDefs>\n"
+        "                    <ipxact:drivers>\n"
+        "                        <ipxact:driver>\n"
+        "                            <ipxact:defaultValue>'h0</ipxact:defaultValue>\n"
+        "                        </ipxact:driver>\n"
+        "                    </ipxact:drivers>\n"
+        "                </ipxact:wire>\n"
+        "                <ipxact:arrays>\n"
+        "                    <ipxact:array>\n"
+        "                        <ipxact:left>3</ipxact:left>\n"
+        "                        <ipxact:right>0</ipxact:right>\n"
+        "                    </ipxact:array>\n"
+        "                </ipxact:arrays>\n"
+        "                <ipxact:vendorExtensions>\n"
+        "                    <kactus2:adHocVisible/>\n"
+        "                    <kactus2:position x=\"10\" y=\"20\"/>\n"
+        "                    <kactus2:portTags>data, bus</kactus2:portTags>\n"
+        "                    <portExtension>value</portExtension>\n"
+        "                </ipxact:vendorExtensions>\n"
+        "            </ipxact:port>\n"
+        "            <ipxact:port>\n"
+        "                <ipxact:name>transactionPort</ipxact:name>\n"
+        "                <ipxact:transactional allLogicalInitiativesAllowed=\"true\">\n"
+        "                    <ipxact:initiative>requires</ipxact:initiative>\n"
+        "                    <ipxact:kind custom=\"customKind\">custom</ipxact:kind>\n"
+        "                    <ipxact:busWidth>32</ipxact:busWidth>\n"
+        "                    <ipxact:protocol>\n"
+        "                        <ipxact:protocolType>tlm</ipxact:protocolType>\n"
+        "                    </ipxact:protocol>\n"
+        "                    <ipxact:transTypeDefs>\n"
+        "                        <ipxact:transTypeDef>\n"
+        "                            <ipxact:typeName exact=\"true\">socket</ipxact:typeName>\n"
+        "                        </ipxact:transTypeDef>\n"
+        "                    </ipxact:transTypeDefs>\n"
+        "                    <ipxact:connection>\n"
+        "                        <ipxact:maxConnections>2</ipxact:maxConnections>\n"
+        "                        <ipxact:minConnections>1</ipxact:minConnections>\n"
+        "                    </ipxact:connection>\n"
+        "                </ipxact:transactional>\n"
+        "            </ipxact:port>\n"
+        "        </ipxact:ports>\n"
+        "    </ipxact:model>\n" +
+        DOCUMENT_END;
+
+    QTest::newRow("vendor extensions") << DOCUMENT_START +
+        "    <ipxact:vendorExtensions>\n"
+        "        <kactus2:version>3.6.0</kactus2:version>\n"
+        "        <kactus2:kts_attributes>\n"
+        "            <kactus2:kts_productHier>Flat</kactus2:kts_productHier>\n"
+        "        </kactus2:kts_attributes>\n"
+        "        <testExtension testAttribute=\"value\">text<!-- comment --><inner/></testExtension>\n"
+        "    </ipxact:vendorExtensions>\n" +
+        DOCUMENT_END;
+}
+
+QTEST_APPLESS_MAIN(tst_DocumentStreamReader)
+
+#include "tst_DocumentStreamReader.moc"
@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../library/DocumentStreamReader.h
+SOURCES += ../../library/DocumentStreamReader.cpp \
+    ./tst_DocumentStreamReader.cpp
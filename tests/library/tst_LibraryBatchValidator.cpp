@@ -0,0 +1,226 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryBatchValidator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class LibraryBatchValidator.
+//-----------------------------------------------------------------------------
+
+#include <library/LibraryBatchValidator.h>
+
+#include <QDomDocument>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtTest>
+
+Q_DECLARE_METATYPE(QList<VLNV>)
+
+class tst_LibraryBatchValidator : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryBatchValidator();
+
+private slots:
+
+    void testSelectDocuments();
+    void testSelectDocuments_data();
+
+    void testJsonReport();
+    void testJsonReportWithoutDocuments();
+
+    void testJUnitReport();
+    void testJUnitReportWithoutDocuments();
+
+private:
+
+    QList<VLNV> createLibrary() const;
+
+    QVector<LibraryBatchValidator::DocumentResult> createResults() const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::tst_LibraryBatchValidator()
+//-----------------------------------------------------------------------------
+tst_LibraryBatchValidator::tst_LibraryBatchValidator()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::testSelectDocuments()
+//-----------------------------------------------------------------------------
+void tst_LibraryBatchValidator::testSelectDocuments()
+{
+    QFETCH(QString, prefix);
+    QFETCH(QList<VLNV>, expected);
+
+    QCOMPARE(LibraryBatchValidator::selectDocuments(createLibrary(), prefix), expected);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::testSelectDocuments_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryBatchValidator::testSelectDocuments_data()
+{
+    QTest::addColumn<QString>("prefix");
+    QTest::addColumn<QList<VLNV> >("expected");
+
+    VLNV const busV1(VLNV::BUSDEFINITION, "tut.fi", "interface", "bus", "1.0");
+    VLNV const busV2(VLNV::BUSDEFINITION, "tut.fi", "interface", "bus", "2.0");
+    VLNV const cpu(VLNV::COMPONENT, "tut.fi", "ip.hw", "cpu", "1.0");
+    VLNV const timer(VLNV::COMPONENT, "tut.fi", "ip.hw", "timer", "1.0");
+    VLNV const other(VLNV::COMPONENT, "other", "ip.hw", "cpu", "1.0");
+
+    QTest::newRow("empty prefix selects all in sorted order") << QString() <<
+        QList<VLNV>({ other, busV1, busV2, cpu, timer });
+    QTest::newRow("vendor") << QString("tut.fi") << QList<VLNV>({ busV1, busV2, cpu, timer });
+    QTest::newRow("vendor and library") << QString("tut.fi:ip.hw") << QList<VLNV>({ cpu, timer });
+    QTest::newRow("vendor, library and name") << QString("tut.fi:interface:bus") << QList<VLNV>({ busV1, busV2 });
+    QTest::newRow("full VLNV") << QString("tut.fi:interface:bus:2.0") << QList<VLNV>({ busV2 });
+    QTest::newRow("trailing separator is ignored") << QString("tut.fi:ip.hw:") << QList<VLNV>({ cpu, timer });
+    QTest::newRow("fields must match exactly") << QString("tut") << QList<VLNV>();
+    QTest::newRow("unknown library") << QString("tut.fi:ip.sw") << QList<VLNV>();
+    QTest::newRow("too many fields") << QString("tut.fi:ip.hw:cpu:1.0:extra") << QList<VLNV>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::testJsonReport()
+//-----------------------------------------------------------------------------
+void tst_LibraryBatchValidator::testJsonReport()
+{
+    QJsonParseError parseError;
+    QJsonDocument report = QJsonDocument::fromJson(LibraryBatchValidator::toJson(createResults()), &parseError);
+    QCOMPARE(parseError.error, QJsonParseError::NoError);
+
+    QJsonObject root = report.object();
+    QCOMPARE(root.value("documents").toInt(), 2);
+    QCOMPARE(root.value("failures").toInt(), 1);
+
+    QJsonArray results = root.value("results").toArray();
+    QCOMPARE(results.size(), 2);
+
+    QJsonObject valid = results.at(0).toObject();
+    QCOMPARE(valid.value("vlnv").toString(), QString("tut.fi:ip.hw:cpu:1.0"));
+    QCOMPARE(valid.value("type").toString(), QString("component"));
+    QCOMPARE(valid.value("path").toString(), QString("/library/cpu.1.0.xml"));
+    QCOMPARE(valid.value("valid").toBool(), true);
+    QCOMPARE(valid.value("elapsedMs").toInt(), 12);
+    QCOMPARE(valid.value("errors").toArray().size(), 0);
+
+    QJsonObject invalid = results.at(1).toObject();
+    QCOMPARE(invalid.value("vlnv").toString(), QString("tut.fi:interface:bus:1.0"));
+    QCOMPARE(invalid.value("type").toString(), QString("ipxact:busDefinition"));
+    QCOMPARE(invalid.value("valid").toBool(), false);
+    QCOMPARE(invalid.value("elapsedMs").toInt(), 1500);
+
+    QJsonArray errors = invalid.value("errors").toArray();
+    QCOMPARE(errors.size(), 2);
+    QCOMPARE(errors.at(0).toString(), QString("First error"));
+    QCOMPARE(errors.at(1).toString(), QString("Second error with <markup> & \"quotes\""));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::testJsonReportWithoutDocuments()
+//-----------------------------------------------------------------------------
+void tst_LibraryBatchValidator::testJsonReportWithoutDocuments()
+{
+    QJsonDocument report = QJsonDocument::fromJson(LibraryBatchValidator::toJson(
+        QVector<LibraryBatchValidator::DocumentResult>()));
+
+    QJsonObject root = report.object();
+    QCOMPARE(root.value("documents").toInt(), 0);
+    QCOMPARE(root.value("failures").toInt(), 0);
+    QCOMPARE(root.value("results").toArray().size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::testJUnitReport()
+//-----------------------------------------------------------------------------
+void tst_LibraryBatchValidator::testJUnitReport()
+{
+    QDomDocument report;
+    QVERIFY(report.setContent(LibraryBatchValidator::toJUnit(createResults())));
+
+    QDomElement suite = report.documentElement();
+    QCOMPARE(suite.tagName(), QString("testsuite"));
+    QCOMPARE(suite.attribute("tests"), QString("2"));
+    QCOMPARE(suite.attribute("failures"), QString("1"));
+    QCOMPARE(suite.attribute("time"), QString("1.512"));
+
+    QDomNodeList cases = suite.elementsByTagName("testcase");
+    QCOMPARE(cases.size(), 2);
+
+    QDomElement valid = cases.at(0).toElement();
+    QCOMPARE(valid.attribute("classname"), QString("component"));
+    QCOMPARE(valid.attribute("name"), QString("tut.fi:ip.hw:cpu:1.0"));
+    QCOMPARE(valid.attribute("file"), QString("/library/cpu.1.0.xml"));
+    QCOMPARE(valid.attribute("time"), QString("0.012"));
+    QVERIFY(valid.firstChildElement("failure").isNull());
+
+    QDomElement invalid = cases.at(1).toElement();
+    QCOMPARE(invalid.attribute("classname"), QString("ipxact:busDefinition"));
+    QCOMPARE(invalid.attribute("time"), QString("1.500"));
+
+    QDomElement failure = invalid.firstChildElement("failure");
+    QVERIFY(failure.isNull() == false);
+    QCOMPARE(failure.attribute("message"), QString("2 error(s) found"));
+    QCOMPARE(failure.text(), QString("First error\nSecond error with <markup> & \"quotes\""));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::testJUnitReportWithoutDocuments()
+//-----------------------------------------------------------------------------
+void tst_LibraryBatchValidator::testJUnitReportWithoutDocuments()
+{
+    QDomDocument report;
+    QVERIFY(report.setContent(LibraryBatchValidator::toJUnit(QVector<LibraryBatchValidator::DocumentResult>())));
+
+    QDomElement suite = report.documentElement();
+    QCOMPARE(suite.attribute("tests"), QString("0"));
+    QCOMPARE(suite.attribute("failures"), QString("0"));
+    QCOMPARE(suite.attribute("time"), QString("0.000"));
+    QCOMPARE(suite.elementsByTagName("testcase").size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::createLibrary()
+//-----------------------------------------------------------------------------
+QList<VLNV> tst_LibraryBatchValidator::createLibrary() const
+{
+    return QList<VLNV>({
+        VLNV(VLNV::COMPONENT, "tut.fi", "ip.hw", "timer", "1.0"),
+        VLNV(VLNV::BUSDEFINITION, "tut.fi", "interface", "bus", "2.0"),
+        VLNV(VLNV::COMPONENT, "other", "ip.hw", "cpu", "1.0"),
+        VLNV(VLNV::COMPONENT, "tut.fi", "ip.hw", "cpu", "1.0"),
+        VLNV(VLNV::BUSDEFINITION, "tut.fi", "interface", "bus", "1.0") });
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBatchValidator::createResults()
+//-----------------------------------------------------------------------------
+QVector<LibraryBatchValidator::DocumentResult> tst_LibraryBatchValidator::createResults() const
+{
+    LibraryBatchValidator::DocumentResult valid;
+    valid.vlnv = VLNV(VLNV::COMPONENT, "tut.fi", "ip.hw", "cpu", "1.0");
+    valid.path = "/library/cpu.1.0.xml";
+    valid.elapsedMs = 12;
+
+    LibraryBatchValidator::DocumentResult invalid;
+    invalid.vlnv = VLNV(VLNV::BUSDEFINITION, "tut.fi", "interface", "bus", "1.0");
+    invalid.path = "/library/bus.1.0.xml";
+    invalid.errors.append("First error");
+    invalid.errors.append("Second error with <markup> & \"quotes\"");
+    invalid.elapsedMs = 1500;
+
+    return QVector<LibraryBatchValidator::DocumentResult>({ valid, invalid });
+}
+
+QTEST_APPLESS_MAIN(tst_LibraryBatchValidator)
+
+#include "tst_LibraryBatchValidator.moc"
@@ -0,0 +1,26 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
+    ../../library/DocumentFileAccess.h \
+    ../../library/DocumentStreamReader.h \
+    ../../library/DocumentValidator.h \
+    ../../editors/ComponentEditor/common/ExpressionParser.h \
+    ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
+    ../../library/LibraryBatchValidator.h \
+    ../../library/LibraryInterface.h \
+    ../../editors/ComponentEditor/common/ListParameterFinder.h \
+    ../../common/ui/MessageMediator.h \
+    ../../editors/ComponentEditor/common/ParameterCache.h \
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h
+SOURCES += ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
+    ../../library/DocumentFileAccess.cpp \
+    ../../library/DocumentStreamReader.cpp \
+    ../../library/DocumentValidator.cpp \
+    ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
+    ../../library/LibraryBatchValidator.cpp \
+    ../../editors/ComponentEditor/common/ListParameterFinder.cpp \
+    ../../editors/ComponentEditor/common/ParameterCache.cpp \
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ./tst_LibraryBatchValidator.cpp
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryDependencyGraph.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class LibraryDependencyGraph.
+//-----------------------------------------------------------------------------
+
+#include <library/LibraryDependencyGraph.h>
+
+#include <QtTest>
+
+class tst_LibraryDependencyGraph : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryDependencyGraph();
+
+private slots:
+
+    void testAddDependencies();
+    void testEmptyDependenciesAreKnown();
+
+    void testDuplicateReferencesAreCountedOnce();
+    void testMultipleDependentsAreSorted();
+    void testInvalidAndSelfReferencesAreIgnored();
+
+    void testUpdateReplacesDependencies();
+
+    void testRemoveDocument();
+    void testRemoveDocumentKeepsReferencesToIt();
+    void testRemoveUnknownDocument();
+
+    void testClear();
+
+private:
+
+    VLNV component(QString const& name) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::tst_LibraryDependencyGraph()
+//-----------------------------------------------------------------------------
+tst_LibraryDependencyGraph::tst_LibraryDependencyGraph()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testAddDependencies()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testAddDependencies()
+{
+    VLNV const top = component("top");
+    VLNV const cpu = component("cpu");
+    VLNV const bus(VLNV::BUSDEFINITION, "tut.fi", "interface", "bus", "1.0");
+
+    LibraryDependencyGraph graph;
+    QVERIFY(graph.hasDependencies(top) == false);
+
+    graph.setDependencies(top, QList<VLNV>({ cpu, bus }));
+
+    QVERIFY(graph.hasDependencies(top));
+    QCOMPARE(graph.getDependencies(top), QList<VLNV>({ cpu, bus }));
+
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>({ top }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+    QCOMPARE(graph.dependentCount(bus), 1);
+
+    QVERIFY(graph.hasDependencies(cpu) == false);
+    QCOMPARE(graph.getDependents(top), QList<VLNV>());
+    QCOMPARE(graph.dependentCount(top), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testEmptyDependenciesAreKnown()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testEmptyDependenciesAreKnown()
+{
+    VLNV const leaf = component("leaf");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(leaf, QList<VLNV>());
+
+    QVERIFY(graph.hasDependencies(leaf));
+    QCOMPARE(graph.getDependencies(leaf), QList<VLNV>());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testDuplicateReferencesAreCountedOnce()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testDuplicateReferencesAreCountedOnce()
+{
+    VLNV const top = component("top");
+    VLNV const cpu = component("cpu");
+    VLNV const timer = component("timer");
+
+    // A design instantiating the same component several times references it once.
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ cpu, timer, cpu, cpu }));
+
+    QCOMPARE(graph.getDependencies(top), QList<VLNV>({ cpu, timer }));
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>({ top }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+
+    // Setting the same references again does not add to the count.
+    graph.setDependencies(top, QList<VLNV>({ cpu, cpu }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+    QCOMPARE(graph.dependentCount(timer), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testMultipleDependentsAreSorted()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testMultipleDependentsAreSorted()
+{
+    VLNV const cpu = component("cpu");
+    VLNV const first = component("a_system");
+    VLNV const second = component("b_system");
+    VLNV const third = component("c_system");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(third, QList<VLNV>({ cpu }));
+    graph.setDependencies(first, QList<VLNV>({ cpu }));
+    graph.setDependencies(second, QList<VLNV>({ cpu, cpu }));
+
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>({ first, second, third }));
+    QCOMPARE(graph.dependentCount(cpu), 3);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testInvalidAndSelfReferencesAreIgnored()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testInvalidAndSelfReferencesAreIgnored()
+{
+    VLNV const top = component("top");
+    VLNV const cpu = component("cpu");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ VLNV(), top, cpu }));
+
+    QCOMPARE(graph.getDependencies(top), QList<VLNV>({ cpu }));
+    QCOMPARE(graph.dependentCount(top), 0);
+    QCOMPARE(graph.dependentCount(VLNV()), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testUpdateReplacesDependencies()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testUpdateReplacesDependencies()
+{
+    VLNV const top = component("top");
+    VLNV const other = component("other");
+    VLNV const cpu = component("cpu");
+    VLNV const timer = component("timer");
+    VLNV const uart = component("uart");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ cpu, timer }));
+    graph.setDependencies(other, QList<VLNV>({ cpu }));
+
+    graph.setDependencies(top, QList<VLNV>({ timer, uart }));
+
+    QCOMPARE(graph.getDependencies(top), QList<VLNV>({ timer, uart }));
+
+    // The reference from the other document is kept.
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>({ other }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+
+    QCOMPARE(graph.getDependents(timer), QList<VLNV>({ top }));
+    QCOMPARE(graph.getDependents(uart), QList<VLNV>({ top }));
+
+    graph.setDependencies(other, QList<VLNV>());
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>());
+    QCOMPARE(graph.dependentCount(cpu), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testRemoveDocument()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testRemoveDocument()
+{
+    VLNV const top = component("top");
+    VLNV const other = component("other");
+    VLNV const cpu = component("cpu");
+    VLNV const timer = component("timer");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ cpu, timer }));
+    graph.setDependencies(other, QList<VLNV>({ cpu }));
+
+    graph.removeDocument(top);
+
+    QVERIFY(graph.hasDependencies(top) == false);
+    QCOMPARE(graph.getDependencies(top), QList<VLNV>());
+
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>({ other }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+    QCOMPARE(graph.dependentCount(timer), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testRemoveDocumentKeepsReferencesToIt()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testRemoveDocumentKeepsReferencesToIt()
+{
+    VLNV const top = component("top");
+    VLNV const cpu = component("cpu");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ cpu }));
+    graph.setDependencies(cpu, QList<VLNV>());
+
+    // The top component still references the removed document, e.g. as a missing instance.
+    graph.removeDocument(cpu);
+
+    QVERIFY(graph.hasDependencies(cpu) == false);
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>({ top }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testRemoveUnknownDocument()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testRemoveUnknownDocument()
+{
+    VLNV const top = component("top");
+    VLNV const cpu = component("cpu");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ cpu }));
+
+    graph.removeDocument(component("unknown"));
+
+    QCOMPARE(graph.getDependencies(top), QList<VLNV>({ cpu }));
+    QCOMPARE(graph.dependentCount(cpu), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::testClear()
+//-----------------------------------------------------------------------------
+void tst_LibraryDependencyGraph::testClear()
+{
+    VLNV const top = component("top");
+    VLNV const cpu = component("cpu");
+
+    LibraryDependencyGraph graph;
+    graph.setDependencies(top, QList<VLNV>({ cpu }));
+
+    graph.clear();
+
+    QVERIFY(graph.hasDependencies(top) == false);
+    QCOMPARE(graph.dependentCount(cpu), 0);
+    QCOMPARE(graph.getDependents(cpu), QList<VLNV>());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryDependencyGraph::component()
+//-----------------------------------------------------------------------------
+VLNV tst_LibraryDependencyGraph::component(QString const& name) const
+{
+    return VLNV(VLNV::COMPONENT, "tut.fi", "ip.hw", name, "1.0");
+}
+
+QTEST_APPLESS_MAIN(tst_LibraryDependencyGraph)
+
+#include "tst_LibraryDependencyGraph.moc"
@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../library/LibraryDependencyGraph.h
+SOURCES += ../../library/LibraryDependencyGraph.cpp \
+    ./tst_LibraryDependencyGraph.cpp
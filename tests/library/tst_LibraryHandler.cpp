@@ -11,12 +11,35 @@
 
 #include <QtTest>
 #include <QDebug>
+#include <QtConcurrent>
 
 #include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
 #include <library/LibraryHandler.h>
 
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/Field.h>
+
 void noMessageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg) {}
 
+//-----------------------------------------------------------------------------
+//! Message channel that records the status messages.
+//-----------------------------------------------------------------------------
+class StatusMessageRecorder : public MessagePasser
+{
+public:
+
+    virtual void showStatusMessage(QString const& status) const override
+    {
+        statusMessages_.append(status);
+    }
+
+    //! The recorded status messages.
+    mutable QStringList statusMessages_;
+};
+
 class tst_LibraryHandler : public QObject
 {
     Q_OBJECT
@@ -30,6 +53,14 @@ private:
     
     void setupTestLibrary();
 
+    QSharedPointer<Component> createMemoryMapComponent(VLNV const& vlnv, int blockCount, int registerCount);
+
+    QList<VLNV> writeCachedComponents(LibraryHandler* library, QString const& path, int count);
+
+    QList<VLNV> writeComponents(LibraryHandler* library, QString const& path, int count);
+
+    void notifyFileChanged(LibraryHandler* library, QString const& path);
+
     MessagePasser messageChannel_;
 
 private slots:
@@ -44,6 +75,27 @@ private slots:
 
     void testDocumentsInLocationAreRead();
 
+    void testGetModelReturnsCopy();
+
+    void testGetModelReadOnlySharesModel();
+
+    void testLeastRecentlyUsedDocumentIsEvicted();
+
+    void testPinnedDocumentIsNotEvicted();
+
+    void testConcurrentRequestsKeepCacheConsistent();
+
+    void testFileChangesAreAppliedInOneBatch();
+
+    void testManyFileChangesResetModels();
+
+    void testFileChangesDuringReadAreHandledInNextBatch();
+
+    void benchmarkGetModelLargeComponent();
+    void benchmarkGetModelLargeComponent_data();
+
+    void benchmarkGetModelReadOnlyLargeComponent();
+    void benchmarkGetModelReadOnlyLargeComponent_data();
 
 };
 
@@ -142,7 +194,414 @@ void tst_LibraryHandler::testDocumentsInLocationAreRead()
     QVERIFY(library->getAllVLNVs().count() == 1338);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testGetModelReturnsCopy()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testGetModelReturnsCopy()
+{
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:test:memoryMapCopy:1.0"));
+    library->writeModelToFile(libraryDirectory.path(), createMemoryMapComponent(componentVLNV, 2, 10));
+
+    QSharedPointer<Document> model = library->getModel(componentVLNV);
+
+    QVERIFY(model.isNull() == false);
+    QVERIFY(model != library->getModel(componentVLNV));
+    QVERIFY(model != library->getModelReadOnly(componentVLNV));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testGetModelReadOnlySharesModel()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testGetModelReadOnlySharesModel()
+{
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:test:memoryMapShare:1.0"));
+    library->writeModelToFile(libraryDirectory.path(), createMemoryMapComponent(componentVLNV, 2, 10));
+
+    QSharedPointer<Document const> model = library->getModelReadOnly(componentVLNV);
+
+    QVERIFY(model.isNull() == false);
+    QVERIFY(model == library->getModelReadOnly(componentVLNV));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testLeastRecentlyUsedDocumentIsEvicted()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testLeastRecentlyUsedDocumentIsEvicted()
+{
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    QList<VLNV> const components = writeCachedComponents(library.data(), libraryDirectory.path(), 3);
+
+    LibraryHandler::CacheStatistics const before = library->getCacheStatistics();
+    qint64 const documentSize = before.cachedSize / 3;
+    QVERIFY(documentSize > 0);
+
+    // Room for two and a half documents evicts only the least recently used one.
+    qint64 const budget = documentSize * 5 / 2;
+    library->setCacheBudget(budget);
+
+    LibraryHandler::CacheStatistics afterEviction = library->getCacheStatistics();
+    QCOMPARE(afterEviction.evictions - before.evictions, 1);
+    QCOMPARE(afterEviction.cachedSize, documentSize * 2);
+
+    QVERIFY(library->getModelReadOnly(components.last()).isNull() == false);
+    QVERIFY(library->getModelReadOnly(components.at(1)).isNull() == false);
+
+    LibraryHandler::CacheStatistics afterHits = library->getCacheStatistics();
+    QCOMPARE(afterHits.hits - afterEviction.hits, 2);
+    QCOMPARE(afterHits.misses, afterEviction.misses);
+
+    // The evicted document must be read again.
+    QVERIFY(library->getModelReadOnly(components.first()).isNull() == false);
+
+    LibraryHandler::CacheStatistics afterMiss = library->getCacheStatistics();
+    QCOMPARE(afterMiss.misses - afterHits.misses, 1);
+    QCOMPARE(afterMiss.hits, afterHits.hits);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testPinnedDocumentIsNotEvicted()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testPinnedDocumentIsNotEvicted()
+{
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    QList<VLNV> const components = writeCachedComponents(library.data(), libraryDirectory.path(), 3);
+    VLNV const pinnedComponent = components.first();
+
+    // Pins are counted, so the document stays pinned until every pin has been released.
+    library->pinDocument(pinnedComponent);
+    library->pinDocument(pinnedComponent);
+    library->unpinDocument(pinnedComponent);
+
+    LibraryHandler::CacheStatistics const before = library->getCacheStatistics();
+    library->setCacheBudget(1);
+
+    LibraryHandler::CacheStatistics afterEviction = library->getCacheStatistics();
+    QCOMPARE(afterEviction.evictions - before.evictions, 2);
+    QCOMPARE(afterEviction.cachedSize, before.cachedSize / 3);
+
+    QVERIFY(library->getModelReadOnly(pinnedComponent).isNull() == false);
+    QCOMPARE(library->getCacheStatistics().hits - afterEviction.hits, 1);
+
+    library->unpinDocument(pinnedComponent);
+    library->setCacheBudget(1);
+
+    LibraryHandler::CacheStatistics afterUnpin = library->getCacheStatistics();
+    QCOMPARE(afterUnpin.evictions - afterEviction.evictions, 1);
+    QCOMPARE(afterUnpin.cachedSize, qint64(0));
+
+    QVERIFY(library->getModelReadOnly(pinnedComponent).isNull() == false);
+    QCOMPARE(library->getCacheStatistics().misses - afterUnpin.misses, 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testConcurrentRequestsKeepCacheConsistent()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testConcurrentRequestsKeepCacheConsistent()
+{
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    QList<VLNV> const components = writeCachedComponents(library.data(), libraryDirectory.path(), 4);
+
+    // A budget of two documents makes the requests evict and read the documents concurrently.
+    LibraryHandler::CacheStatistics const before = library->getCacheStatistics();
+    qint64 const budget = before.cachedSize / 2;
+    library->setCacheBudget(budget);
+
+    QList<VLNV> requests;
+    for (int i = 0; i < 50; ++i)
+    {
+        requests.append(components);
+    }
+
+    QAtomicInt missingDocuments(0);
+    QtConcurrent::blockingMap(requests, [&library, &missingDocuments](VLNV const& vlnv)
+    {
+        if (library->getModelReadOnly(vlnv).isNull())
+        {
+            missingDocuments.ref();
+        }
+    });
+
+    QCOMPARE(missingDocuments.load(), 0);
+
+    LibraryHandler::CacheStatistics const after = library->getCacheStatistics();
+    QCOMPARE((after.hits - before.hits) + (after.misses - before.misses), requests.size());
+    QVERIFY(after.misses > before.misses);
+    QVERIFY(after.evictions > before.evictions);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testFileChangesAreAppliedInOneBatch()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testFileChangesAreAppliedInOneBatch()
+{
+    QTemporaryDir libraryDirectory;
+    StatusMessageRecorder messages;
+    QScopedPointer<LibraryHandler> library(new LibraryHandler(0, &messages, this));
+
+    QList<VLNV> const components = writeComponents(library.data(), libraryDirectory.path(), 5);
+
+    QList<VLNV> updatedComponents;
+    connect(library.data(), &LibraryHandler::updatedVLNV,
+        [&updatedComponents](VLNV const& vlnv) { updatedComponents.append(vlnv); });
+    QSignalSpy resetSpy(library->getTreeModel(), SIGNAL(modelReset()));
+
+    // Changes closer to each other than the delay keep postponing the batch.
+    for (VLNV const& componentVLNV : components)
+    {
+        notifyFileChanged(library.data(), library->getPath(componentVLNV));
+        QTest::qWait(50);
+    }
+
+    QVERIFY(updatedComponents.isEmpty());
+    QVERIFY(messages.statusMessages_.filter(QStringLiteral("Reading")).isEmpty());
+
+    QTRY_COMPARE(updatedComponents.size(), components.size());
+    QTest::qWait(500);
+
+    QCOMPARE(messages.statusMessages_.filter(QStringLiteral("Reading")),
+        QStringList(QStringLiteral("Reading 5 changed file(s). Please wait...")));
+    QCOMPARE(updatedComponents.size(), components.size());
+
+    for (VLNV const& componentVLNV : components)
+    {
+        QVERIFY(updatedComponents.contains(componentVLNV));
+    }
+
+    // A small batch updates the changed items instead of rebuilding the views.
+    QCOMPARE(resetSpy.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testManyFileChangesResetModels()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testManyFileChangesResetModels()
+{
+    QTemporaryDir libraryDirectory;
+    StatusMessageRecorder messages;
+    QScopedPointer<LibraryHandler> library(new LibraryHandler(0, &messages, this));
+
+    QList<VLNV> const components = writeComponents(library.data(), libraryDirectory.path(), 25);
+
+    QList<VLNV> updatedComponents;
+    connect(library.data(), &LibraryHandler::updatedVLNV,
+        [&updatedComponents](VLNV const& vlnv) { updatedComponents.append(vlnv); });
+    QSignalSpy resetSpy(library->getTreeModel(), SIGNAL(modelReset()));
+
+    for (VLNV const& componentVLNV : components)
+    {
+        notifyFileChanged(library.data(), library->getPath(componentVLNV));
+    }
+
+    QTRY_COMPARE(updatedComponents.size(), components.size());
+
+    QCOMPARE(messages.statusMessages_.filter(QStringLiteral("Reading")),
+        QStringList(QStringLiteral("Reading 25 changed file(s). Please wait...")));
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(messages.statusMessages_.last(), QStringLiteral("Ready."));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testFileChangesDuringReadAreHandledInNextBatch()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testFileChangesDuringReadAreHandledInNextBatch()
+{
+    QTemporaryDir libraryDirectory;
+    StatusMessageRecorder messages;
+    QScopedPointer<LibraryHandler> library(new LibraryHandler(0, &messages, this));
+
+    QList<VLNV> const components = writeComponents(library.data(), libraryDirectory.path(), 25);
+
+    QList<VLNV> updatedComponents;
+    connect(library.data(), &LibraryHandler::updatedVLNV,
+        [&updatedComponents](VLNV const& vlnv) { updatedComponents.append(vlnv); });
+
+    for (int i = 0; i < components.size() - 1; ++i)
+    {
+        notifyFileChanged(library.data(), library->getPath(components.at(i)));
+    }
+
+    // Start reading the first batch right away and change the last file while it is being read.
+    QVERIFY(QMetaObject::invokeMethod(library.data(), "handleFileChange", Qt::DirectConnection));
+    notifyFileChanged(library.data(), library->getPath(components.last()));
+
+    QTRY_COMPARE(updatedComponents.size(), components.size());
+
+    QCOMPARE(messages.statusMessages_.filter(QStringLiteral("Reading")), QStringList() <<
+        QStringLiteral("Reading 24 changed file(s). Please wait...") <<
+        QStringLiteral("Reading 1 changed file(s). Please wait..."));
+
+    QCOMPARE(updatedComponents.last(), components.last());
+    QCOMPARE(updatedComponents.count(components.last()), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::benchmarkGetModelLargeComponent()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::benchmarkGetModelLargeComponent()
+{
+    QFETCH(int, blockCount);
+    QFETCH(int, registerCount);
+
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:benchmark:memoryMapCopy:1.0"));
+    library->writeModelToFile(libraryDirectory.path(),
+        createMemoryMapComponent(componentVLNV, blockCount, registerCount));
+
+    // Every call copies the whole component.
+    QSharedPointer<Document> model;
+    QBENCHMARK
+    {
+        model = library->getModel(componentVLNV);
+    }
+
+    QVERIFY(model.isNull() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::benchmarkGetModelLargeComponent_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::benchmarkGetModelLargeComponent_data()
+{
+    QTest::addColumn<int>("blockCount");
+    QTest::addColumn<int>("registerCount");
+
+    QTest::newRow("1 block, 1000 registers") << 1 << 1000;
+    QTest::newRow("10 blocks, 1000 registers each") << 10 << 1000;
+    QTest::newRow("100 blocks, 1000 registers each") << 100 << 1000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::benchmarkGetModelReadOnlyLargeComponent()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::benchmarkGetModelReadOnlyLargeComponent()
+{
+    QFETCH(int, blockCount);
+    QFETCH(int, registerCount);
+
+    QTemporaryDir libraryDirectory;
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:benchmark:memoryMapShare:1.0"));
+    library->writeModelToFile(libraryDirectory.path(),
+        createMemoryMapComponent(componentVLNV, blockCount, registerCount));
+
+    // Every call shares the cached component regardless of its size.
+    QSharedPointer<Document const> model;
+    QBENCHMARK
+    {
+        model = library->getModelReadOnly(componentVLNV);
+    }
+
+    QVERIFY(model.isNull() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::benchmarkGetModelReadOnlyLargeComponent_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::benchmarkGetModelReadOnlyLargeComponent_data()
+{
+    benchmarkGetModelLargeComponent_data();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::createMemoryMapComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_LibraryHandler::createMemoryMapComponent(VLNV const& vlnv, int blockCount,
+    int registerCount)
+{
+    QSharedPointer<Component> component(new Component(vlnv));
+
+    QSharedPointer<MemoryMap> memoryMap(new MemoryMap(QStringLiteral("memoryMap")));
+    component->getMemoryMaps()->append(memoryMap);
+
+    for (int blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+    {
+        QSharedPointer<AddressBlock> block(new AddressBlock(QStringLiteral("block") +
+            QString::number(blockIndex), QString::number(blockIndex * registerCount * 4)));
+        block->setRange(QString::number(registerCount * 4));
+        block->setWidth(QStringLiteral("32"));
+        memoryMap->getMemoryBlocks()->append(block);
+
+        for (int registerIndex = 0; registerIndex < registerCount; ++registerIndex)
+        {
+            QSharedPointer<Register> testRegister(new Register(QStringLiteral("register") +
+                QString::number(registerIndex), QString::number(registerIndex * 4), QStringLiteral("32")));
+
+            QSharedPointer<Field> testField(new Field(QStringLiteral("field")));
+            testField->setBitOffset(QStringLiteral("0"));
+            testField->setBitWidth(QStringLiteral("32"));
+            testRegister->getFields()->append(testField);
+
+            block->getRegisterData()->append(testRegister);
+        }
+    }
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::writeCachedComponents()
+//-----------------------------------------------------------------------------
+QList<VLNV> tst_LibraryHandler::writeCachedComponents(LibraryHandler* library, QString const& path, int count)
+{
+    library->setCacheBudget(0);
+
+    QList<VLNV> components;
+    for (int i = 0; i < count; ++i)
+    {
+        VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:test:cached%1:1.0").arg(i));
+        library->writeModelToFile(path, createMemoryMapComponent(componentVLNV, 2, 10));
+        components.append(componentVLNV);
+    }
+
+    // Access the documents in order, so that the first one is the least recently used.
+    for (VLNV const& componentVLNV : components)
+    {
+        library->getModelReadOnly(componentVLNV);
+    }
+
+    return components;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::writeComponents()
+//-----------------------------------------------------------------------------
+QList<VLNV> tst_LibraryHandler::writeComponents(LibraryHandler* library, QString const& path, int count)
+{
+    QList<VLNV> components;
+    for (int i = 0; i < count; ++i)
+    {
+        VLNV componentVLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:test:changed%1:1.0").arg(i));
+        library->writeModelToFile(path, createMemoryMapComponent(componentVLNV, 1, 10));
+        components.append(componentVLNV);
+    }
+
+    return components;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::notifyFileChanged()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::notifyFileChanged(LibraryHandler* library, QString const& path)
+{
+    // Notify the change directly, as the file system watcher reports changes at its own pace.
+    QVERIFY(QMetaObject::invokeMethod(library, "onFileChangedOnDisk", Qt::DirectConnection, Q_ARG(QString, path)));
+}
 
-QTEST_APPLESS_MAIN(tst_LibraryHandler)
+QTEST_MAIN(tst_LibraryHandler)
 
 #include "tst_LibraryHandler.moc"
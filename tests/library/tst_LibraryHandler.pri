@@ -10,6 +10,7 @@ message("You are running qmake on a generated .pro file. This may not work!")
 HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../common/ui/ConsoleMediator.h \
     ../../library/DocumentFileAccess.h \
+    ../../library/DocumentStreamReader.h \
     ../../library/DocumentValidator.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
@@ -26,9 +27,12 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../common/widgets/vlnvEditor/VLNVDataTree.h \
     ../../common/widgets/assistedLineEdit/AssistedLineEdit.h \
     ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.h \
+    ../../library/LibraryDependencyGraph.h \
     ../../library/LibraryErrorModel.h \
     ../../library/LibraryHandler.h \
     ../../library/LibraryItem.h \
+    ../../library/LibraryIndex.h \
+    ../../common/ChecksummedFile.h \
     ../../library/LibraryLoader.h \
     ../../common/widgets/LibrarySelectorWidget/LibrarySelectorWidget.h \
     ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.h \
@@ -50,13 +54,17 @@ SOURCES += ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../common/ui/ConsoleMediator.cpp \
     ../../library/DocumentFileAccess.cpp \
+    ../../library/DocumentStreamReader.cpp \
     ../../library/DocumentValidator.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.cpp \
+    ../../library/LibraryDependencyGraph.cpp \
     ../../library/LibraryErrorModel.cpp \
     ../../library/LibraryHandler.cpp \
     ../../library/LibraryItem.cpp \
     ../../library/LibraryItemSelectionFactory.cpp \
+    ../../library/LibraryIndex.cpp \
+    ../../common/ChecksummedFile.cpp \
     ../../library/LibraryLoader.cpp \
     ../../common/widgets/LibrarySelectorWidget/LibrarySelectorWidget.cpp \
     ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.cpp \
@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_LibraryHandler
 
-QT += core xml gui testlib widgets
+QT += core xml gui testlib widgets concurrent
 CONFIG += testcase console c++14
 
 QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
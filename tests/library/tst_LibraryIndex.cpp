@@ -0,0 +1,447 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class LibraryIndex.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <library/LibraryIndex.h>
+
+#include <common/ChecksummedFile.h>
+
+#include <QTemporaryDir>
+
+class tst_LibraryIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryIndex();
+
+private slots:
+
+    void initTestCase();
+
+    void init();
+    void cleanup();
+
+    void testSavedIndexIsLoaded();
+    void testOnlyEntriesOfLocationAreSaved();
+    void testMissingIndexIsNotLoaded();
+    void testIndexWithOtherMagicIsDiscarded();
+    void testIndexWithOtherVersionIsDiscarded();
+    void testCorruptedIndexIsDiscarded();
+    void testTruncatedIndexIsDiscarded();
+
+    void testUnchangedFileIsReused();
+    void testModifiedFileIsNotReused();
+    void testUnindexedFileIsNotReused();
+
+    void testDependenciesAreChangedOnlyWhenDifferent();
+
+private:
+
+    QString createFile(QString const& name, QByteArray const& content);
+
+    LibraryIndex::Entry createEntry(QString const& path, VLNV const& vlnv) const;
+
+    void populateIndex(LibraryIndex& index);
+
+    void overwriteHeaderField(int offset, quint32 value);
+
+    QString indexFilePath() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library location of each test.
+    QSharedPointer<QTemporaryDir> location_;
+
+    //! The indexed component document.
+    QString componentFile_;
+
+    //! The indexed design document with dependencies.
+    QString designFile_;
+
+    //! The indexed file that is not an IP-XACT 2014 document.
+    QString skippedFile_;
+
+    //! The VLNVs of the indexed documents.
+    VLNV componentVLNV_;
+    VLNV designVLNV_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::tst_LibraryIndex()
+//-----------------------------------------------------------------------------
+tst_LibraryIndex::tst_LibraryIndex():
+location_(),
+componentFile_(),
+designFile_(),
+skippedFile_(),
+componentVLNV_(VLNV::COMPONENT, "tuni.fi", "test", "component", "1.0"),
+designVLNV_(VLNV::DESIGN, "tuni.fi", "test", "component.design", "1.0")
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::init()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::init()
+{
+    // The index is stored by the location, so each test uses its own location.
+    location_ = QSharedPointer<QTemporaryDir>(new QTemporaryDir());
+    QVERIFY(location_->isValid());
+
+    componentFile_ = createFile("component/component.1.0.xml", "<ipxact:component/>");
+    designFile_ = createFile("component/component.design.1.0.xml", "<ipxact:design/>");
+    skippedFile_ = createFile("old/old.xml", "<spirit:component/>");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::cleanup()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::cleanup()
+{
+    QFile::remove(indexFilePath());
+    location_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testSavedIndexIsLoaded()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testSavedIndexIsLoaded()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    LibraryIndex loadedIndex;
+    QVERIFY(loadedIndex.load(location_->path()));
+    QCOMPARE(loadedIndex.count(), 3);
+
+    LibraryIndex::Entry const savedDesign = savedIndex.entry(designFile_);
+    LibraryIndex::Entry const loadedDesign = loadedIndex.entry(designFile_);
+    QCOMPARE(loadedDesign.size, savedDesign.size);
+    QCOMPARE(loadedDesign.lastModified, savedDesign.lastModified);
+    QCOMPARE(loadedDesign.contentHash, savedDesign.contentHash);
+    QCOMPARE(loadedDesign.contentHash, LibraryIndex::calculateHash(designFile_));
+    QCOMPARE(loadedDesign.vlnv, designVLNV_);
+    QCOMPARE(loadedDesign.vlnv.getType(), VLNV::DESIGN);
+    QCOMPARE(loadedDesign.dependenciesKnown, true);
+    QCOMPARE(loadedDesign.dependencies, QList<VLNV>({ componentVLNV_ }));
+
+    LibraryIndex::Entry const loadedComponent = loadedIndex.entry(componentFile_);
+    QCOMPARE(loadedComponent.vlnv, componentVLNV_);
+    QCOMPARE(loadedComponent.dependenciesKnown, false);
+    QVERIFY(loadedComponent.dependencies.isEmpty());
+    QVERIFY(loadedComponent.notice.isEmpty());
+
+    LibraryIndex::Entry const loadedSkipped = loadedIndex.entry(skippedFile_);
+    QCOMPARE(loadedSkipped.vlnv.isValid(), false);
+    QCOMPARE(loadedSkipped.notice, savedIndex.entry(skippedFile_).notice);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testOnlyEntriesOfLocationAreSaved()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testOnlyEntriesOfLocationAreSaved()
+{
+    QTemporaryDir otherLocation;
+    QVERIFY(otherLocation.isValid());
+
+    QString otherPath = QFileInfo(otherLocation.path() + "/other.xml").absoluteFilePath();
+
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    savedIndex.insert(otherPath, createEntry(componentFile_, componentVLNV_));
+    QVERIFY(savedIndex.save(location_->path()));
+
+    LibraryIndex loadedIndex;
+    QVERIFY(loadedIndex.load(location_->path()));
+    QCOMPARE(loadedIndex.count(), 3);
+    QCOMPARE(loadedIndex.entry(otherPath).vlnv.isValid(), false);
+
+    // The other location has no index of its own.
+    LibraryIndex otherIndex;
+    QCOMPARE(otherIndex.load(otherLocation.path()), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testMissingIndexIsNotLoaded()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testMissingIndexIsNotLoaded()
+{
+    LibraryIndex index;
+    QCOMPARE(index.load(location_->path()), false);
+    QCOMPARE(index.count(), 0);
+    QVERIFY(index.findUpToDateEntry(QFileInfo(componentFile_)) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testIndexWithOtherMagicIsDiscarded()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testIndexWithOtherMagicIsDiscarded()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    // The magic is the first field of the file. The payload and its checksum are left intact.
+    overwriteHeaderField(0, 0x12345678);
+
+    LibraryIndex loadedIndex;
+    QCOMPARE(loadedIndex.load(location_->path()), false);
+    QCOMPARE(loadedIndex.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testIndexWithOtherVersionIsDiscarded()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testIndexWithOtherVersionIsDiscarded()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    // An index written in an older format.
+    overwriteHeaderField(4, 1);
+
+    LibraryIndex loadedIndex;
+    QCOMPARE(loadedIndex.load(location_->path()), false);
+    QCOMPARE(loadedIndex.count(), 0);
+
+    // The discarded index is replaced on the next save.
+    populateIndex(loadedIndex);
+    QVERIFY(loadedIndex.save(location_->path()));
+    QVERIFY(LibraryIndex().load(location_->path()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testCorruptedIndexIsDiscarded()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testCorruptedIndexIsDiscarded()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    QFile indexFile(indexFilePath());
+    QVERIFY(indexFile.open(QIODevice::ReadWrite));
+    QByteArray content = indexFile.readAll();
+    QVERIFY(content.size() > 16);
+
+    // Flip the first byte of the payload following the magic, the version and the payload length.
+    content[12] = content.at(12) ^ 0x5A;
+    indexFile.seek(0);
+    indexFile.write(content);
+    indexFile.close();
+
+    LibraryIndex loadedIndex;
+    QCOMPARE(loadedIndex.load(location_->path()), false);
+    QCOMPARE(loadedIndex.count(), 0);
+    QVERIFY(loadedIndex.findUpToDateEntry(QFileInfo(componentFile_)) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testTruncatedIndexIsDiscarded()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testTruncatedIndexIsDiscarded()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    QFile indexFile(indexFilePath());
+    QVERIFY(indexFile.resize(indexFile.size() / 2));
+
+    LibraryIndex loadedIndex;
+    QCOMPARE(loadedIndex.load(location_->path()), false);
+    QCOMPARE(loadedIndex.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testUnchangedFileIsReused()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testUnchangedFileIsReused()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    LibraryIndex loadedIndex;
+    QVERIFY(loadedIndex.load(location_->path()));
+
+    LibraryIndex::Entry const* design = loadedIndex.findUpToDateEntry(QFileInfo(designFile_));
+    QVERIFY(design != nullptr);
+    QCOMPARE(design->vlnv, designVLNV_);
+    QCOMPARE(design->dependencies, QList<VLNV>({ componentVLNV_ }));
+
+    LibraryIndex::Entry const* skipped = loadedIndex.findUpToDateEntry(QFileInfo(skippedFile_));
+    QVERIFY(skipped != nullptr);
+    QCOMPARE(skipped->notice.isEmpty(), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testModifiedFileIsNotReused()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testModifiedFileIsNotReused()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    createFile("component/component.1.0.xml", "<ipxact:component>changed</ipxact:component>");
+
+    // Same size, but modified later.
+    QFile designFile(designFile_);
+    QVERIFY(designFile.open(QIODevice::ReadWrite));
+    QVERIFY(designFile.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+    designFile.close();
+
+    LibraryIndex loadedIndex;
+    QVERIFY(loadedIndex.load(location_->path()));
+
+    QVERIFY(loadedIndex.findUpToDateEntry(QFileInfo(componentFile_)) == nullptr);
+    QVERIFY(loadedIndex.findUpToDateEntry(QFileInfo(designFile_)) == nullptr);
+    QVERIFY(loadedIndex.findUpToDateEntry(QFileInfo(skippedFile_)) != nullptr);
+
+    // The stale entry is still available for comparing the content.
+    QCOMPARE(loadedIndex.entry(designFile_).contentHash, LibraryIndex::calculateHash(designFile_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testUnindexedFileIsNotReused()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testUnindexedFileIsNotReused()
+{
+    LibraryIndex savedIndex;
+    populateIndex(savedIndex);
+    QVERIFY(savedIndex.save(location_->path()));
+
+    QString addedFile = createFile("added/added.1.0.xml", "<ipxact:component/>");
+
+    LibraryIndex loadedIndex;
+    QVERIFY(loadedIndex.load(location_->path()));
+    QVERIFY(loadedIndex.findUpToDateEntry(QFileInfo(addedFile)) == nullptr);
+    QCOMPARE(loadedIndex.entry(addedFile).vlnv.isValid(), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::testDependenciesAreChangedOnlyWhenDifferent()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::testDependenciesAreChangedOnlyWhenDifferent()
+{
+    LibraryIndex index;
+    populateIndex(index);
+
+    QCOMPARE(index.setDependencies(designFile_, QList<VLNV>({ componentVLNV_ })), false);
+
+    // Known to have no dependencies differs from unknown dependencies.
+    QCOMPARE(index.setDependencies(componentFile_, QList<VLNV>()), true);
+    QCOMPARE(index.entry(componentFile_).dependenciesKnown, true);
+    QCOMPARE(index.setDependencies(componentFile_, QList<VLNV>()), false);
+
+    QCOMPARE(index.setDependencies(designFile_, QList<VLNV>()), true);
+    QVERIFY(index.entry(designFile_).dependencies.isEmpty());
+
+    // Files not in the index are not added.
+    QString addedFile = createFile("added/added.1.0.xml", "<ipxact:component/>");
+    QCOMPARE(index.setDependencies(addedFile, QList<VLNV>({ componentVLNV_ })), false);
+    QCOMPARE(index.count(), 3);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::createFile()
+//-----------------------------------------------------------------------------
+QString tst_LibraryIndex::createFile(QString const& name, QByteArray const& content)
+{
+    QString path = QFileInfo(location_->path() + "/" + name).absoluteFilePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QFile file(path);
+    file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    file.write(content);
+    file.close();
+
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::createEntry()
+//-----------------------------------------------------------------------------
+LibraryIndex::Entry tst_LibraryIndex::createEntry(QString const& path, VLNV const& vlnv) const
+{
+    QFileInfo fileInfo(path);
+
+    LibraryIndex::Entry entry;
+    entry.size = fileInfo.size();
+    entry.lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
+    entry.contentHash = LibraryIndex::calculateHash(path);
+    entry.vlnv = vlnv;
+
+    return entry;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::populateIndex()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::populateIndex(LibraryIndex& index)
+{
+    index.insert(componentFile_, createEntry(componentFile_, componentVLNV_));
+
+    LibraryIndex::Entry design = createEntry(designFile_, designVLNV_);
+    design.dependencies.append(componentVLNV_);
+    design.dependenciesKnown = true;
+    index.insert(designFile_, design);
+
+    LibraryIndex::Entry skipped = createEntry(skippedFile_, VLNV());
+    skipped.notice = QStringLiteral("File %1 contains an IP-XACT description not compatible "
+        "with the 1685-2014 standard and could not be read.").arg(skippedFile_);
+    index.insert(skippedFile_, skipped);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::overwriteHeaderField()
+//-----------------------------------------------------------------------------
+void tst_LibraryIndex::overwriteHeaderField(int offset, quint32 value)
+{
+    QFile indexFile(indexFilePath());
+    QVERIFY(indexFile.open(QIODevice::ReadWrite));
+    QVERIFY(indexFile.seek(offset));
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << value;
+
+    indexFile.close();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryIndex::indexFilePath()
+//-----------------------------------------------------------------------------
+QString tst_LibraryIndex::indexFilePath() const
+{
+    return ChecksummedFile::cacheFilePath(QStringLiteral("libraryIndex"), QDir(location_->path()).absolutePath(),
+        QStringLiteral(".idx"));
+}
+
+QTEST_APPLESS_MAIN(tst_LibraryIndex)
+
+#include "tst_LibraryIndex.moc"
@@ -0,0 +1,9 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../common/ChecksummedFile.h \
+    ../../library/LibraryIndex.h
+SOURCES += ../../common/ChecksummedFile.cpp \
+    ../../library/LibraryIndex.cpp \
+    ./tst_LibraryIndex.cpp
@@ -0,0 +1,513 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryLoader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class LibraryLoader.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <library/LibraryLoader.h>
+
+#include <common/ChecksummedFile.h>
+#include <common/ui/MessageMediator.h>
+
+#include <QSemaphore>
+#include <QTemporaryDir>
+#include <QThreadPool>
+
+#include <QtConcurrent>
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+//! Records the messages of the scan.
+//-----------------------------------------------------------------------------
+class RecordingMediator : public MessageMediator
+{
+public:
+
+    virtual void showMessage(QString const& message) const { notices_.append(message); }
+
+    virtual void showError(QString const& error) const { errors_.append(error); }
+
+    virtual void showFailure(QString const& error) const { errors_.append(error); }
+
+    virtual void showStatusMessage(QString const& /*status*/) const { }
+
+    //! The notices shown in order.
+    mutable QStringList notices_;
+
+    //! The errors shown in order.
+    mutable QStringList errors_;
+};
+
+class tst_LibraryLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryLoader();
+
+private slots:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void init();
+    void cleanup();
+
+    void testUnchangedLibraryDoesNotRewriteIndex();
+    void testUnchangedUnreadableFileDoesNotRewriteIndex();
+    void testChangedFileRewritesIndex();
+    void testRemovedFileRewritesIndex();
+
+    void testConcurrentScanMatchesSequentialScan();
+    void testProgressIsReported();
+    void testScanIsCancelledFromProgress();
+    void testScanIsCancelledFromOtherThread();
+
+private:
+
+    QVector<LibraryLoader::LoadTarget> createLibrary(QTemporaryDir const& secondLocation);
+
+    QString createDocument(QString const& relativePath, QString const& type, QString const& name);
+
+    QString createFile(QString const& relativePath, QByteArray const& content);
+
+    void markIndexAsOld();
+
+    bool indexIsOld() const;
+
+    QString indexFilePath() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library location of each test.
+    QSharedPointer<QTemporaryDir> location_;
+
+    //! The time set as the modification time of a stored index.
+    QDateTime oldTime_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::tst_LibraryLoader()
+//-----------------------------------------------------------------------------
+tst_LibraryLoader::tst_LibraryLoader():
+location_(),
+oldTime_(QDate(2000, 1, 1), QTime(12, 0))
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+
+    QCoreApplication::setOrganizationDomain(QStringLiteral("tut.fi"));
+    QCoreApplication::setOrganizationName(QStringLiteral("TUT"));
+    QCoreApplication::setApplicationName(QStringLiteral("Kactus2_tests"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::cleanupTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::cleanupTestCase()
+{
+    QSettings().remove(QStringLiteral("Library/ActiveLocations"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::init()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::init()
+{
+    // The index is stored by the location, so each test uses its own location.
+    location_ = QSharedPointer<QTemporaryDir>(new QTemporaryDir());
+    QVERIFY(location_->isValid());
+
+    QSettings().setValue(QStringLiteral("Library/ActiveLocations"), QStringList(location_->path()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::cleanup()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::cleanup()
+{
+    QFile::remove(indexFilePath());
+    location_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testUnchangedLibraryDoesNotRewriteIndex()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testUnchangedLibraryDoesNotRewriteIndex()
+{
+    createDocument("ip/cpu.xml", "component", "cpu");
+    createDocument("ip/bus.xml", "busDefinition", "bus");
+    createFile("old/old.xml", "<spirit:component/>");
+
+    RecordingMediator messages;
+    LibraryLoader firstLoader(&messages);
+    QCOMPARE(firstLoader.parseLibrary().size(), 2);
+    QVERIFY(QFileInfo::exists(indexFilePath()));
+
+    markIndexAsOld();
+
+    RecordingMediator secondMessages;
+    LibraryLoader secondLoader(&secondMessages);
+    QCOMPARE(secondLoader.parseLibrary().size(), 2);
+    QVERIFY(indexIsOld());
+
+    // The skipped file is reported again from the index.
+    QCOMPARE(secondMessages.notices_, messages.notices_);
+    QCOMPARE(secondMessages.notices_.size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testUnchangedUnreadableFileDoesNotRewriteIndex()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testUnchangedUnreadableFileDoesNotRewriteIndex()
+{
+    createDocument("ip/cpu.xml", "component", "cpu");
+    QString unreadable = createDocument("ip/locked.xml", "component", "locked");
+
+    QVERIFY(QFile::setPermissions(unreadable, QFileDevice::WriteOwner));
+    QFile lockedFile(unreadable);
+    if (lockedFile.open(QIODevice::ReadOnly))
+    {
+        QFile::setPermissions(unreadable, QFileDevice::ReadOwner | QFileDevice::WriteOwner);
+        QSKIP("File permissions do not prevent reading for the current user.");
+    }
+
+    RecordingMediator messages;
+    LibraryLoader firstLoader(&messages);
+    QCOMPARE(firstLoader.parseLibrary().size(), 1);
+    QCOMPARE(messages.errors_.size(), 1);
+    QVERIFY(QFileInfo::exists(indexFilePath()));
+
+    markIndexAsOld();
+
+    // The file still fails, but nothing in the index changes.
+    RecordingMediator secondMessages;
+    LibraryLoader secondLoader(&secondMessages);
+    QCOMPARE(secondLoader.parseLibrary().size(), 1);
+    QCOMPARE(secondMessages.errors_, messages.errors_);
+    QVERIFY(indexIsOld());
+
+    QFile::setPermissions(unreadable, QFileDevice::ReadOwner | QFileDevice::WriteOwner);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testChangedFileRewritesIndex()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testChangedFileRewritesIndex()
+{
+    createDocument("ip/cpu.xml", "component", "cpu");
+    createDocument("ip/bus.xml", "busDefinition", "bus");
+
+    RecordingMediator messages;
+    LibraryLoader firstLoader(&messages);
+    firstLoader.parseLibrary();
+
+    markIndexAsOld();
+    createDocument("ip/cpu.xml", "component", "renamedCpu");
+
+    LibraryLoader secondLoader(&messages);
+    QVector<LibraryLoader::LoadTarget> targets = secondLoader.parseLibrary();
+    QCOMPARE(indexIsOld(), false);
+
+    QCOMPARE(targets.size(), 2);
+    QCOMPARE(targets.last().vlnv.getName(), QString("renamedCpu"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testRemovedFileRewritesIndex()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testRemovedFileRewritesIndex()
+{
+    createDocument("ip/cpu.xml", "component", "cpu");
+    QString removed = createDocument("ip/bus.xml", "busDefinition", "bus");
+
+    RecordingMediator messages;
+    LibraryLoader firstLoader(&messages);
+    firstLoader.parseLibrary();
+
+    markIndexAsOld();
+    QVERIFY(QFile::remove(removed));
+
+    LibraryLoader secondLoader(&messages);
+    QCOMPARE(secondLoader.parseLibrary().size(), 1);
+    QCOMPARE(indexIsOld(), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testConcurrentScanMatchesSequentialScan()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testConcurrentScanMatchesSequentialScan()
+{
+    QTemporaryDir secondLocation;
+    QVERIFY(secondLocation.isValid());
+
+    QVector<LibraryLoader::LoadTarget> expected = createLibrary(secondLocation);
+
+    // With a single thread in the pool, the files are read one at a time in order.
+    QThreadPool* pool = QThreadPool::globalInstance();
+    int const maxThreads = pool->maxThreadCount();
+    pool->setMaxThreadCount(1);
+
+    RecordingMediator sequentialMessages;
+    LibraryLoader sequentialLoader(&sequentialMessages);
+    QVector<LibraryLoader::LoadTarget> sequential = sequentialLoader.parseLibrary();
+
+    pool->setMaxThreadCount(qMax(4, maxThreads));
+
+    // Without the index every file is read again.
+    QFile::remove(indexFilePath());
+    QFile::remove(ChecksummedFile::cacheFilePath(QStringLiteral("libraryIndex"),
+        QDir(secondLocation.path()).absolutePath(), QStringLiteral(".idx")));
+
+    RecordingMediator concurrentMessages;
+    LibraryLoader concurrentLoader(&concurrentMessages);
+    QVector<LibraryLoader::LoadTarget> concurrent = concurrentLoader.parseLibrary();
+
+    pool->setMaxThreadCount(maxThreads);
+
+    QCOMPARE(sequential.size(), expected.size());
+    QCOMPARE(concurrent.size(), expected.size());
+    for (int i = 0; i < expected.size(); ++i)
+    {
+        QCOMPARE(sequential.at(i).path, expected.at(i).path);
+        QCOMPARE(sequential.at(i).vlnv, expected.at(i).vlnv);
+        QCOMPARE(concurrent.at(i).path, expected.at(i).path);
+        QCOMPARE(concurrent.at(i).vlnv, expected.at(i).vlnv);
+    }
+
+    QCOMPARE(concurrentMessages.notices_, sequentialMessages.notices_);
+    QCOMPARE(concurrentMessages.notices_.size(), 2);
+
+    QFile::remove(ChecksummedFile::cacheFilePath(QStringLiteral("libraryIndex"),
+        QDir(secondLocation.path()).absolutePath(), QStringLiteral(".idx")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testProgressIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testProgressIsReported()
+{
+    for (int i = 0; i < 600; ++i)
+    {
+        createDocument(QString("ip/component%1.xml").arg(i), "component", QString("component%1").arg(i));
+    }
+
+    QList<QPair<int, int> > reports;
+
+    RecordingMediator messages;
+    LibraryLoader loader(&messages);
+    QCOMPARE(loader.parseLibrary([&reports](int scannedFiles, int totalFiles)
+    {
+        reports.append(qMakePair(scannedFiles, totalFiles));
+        return true;
+    }).size(), 600);
+
+    QList<QPair<int, int> > expected({ qMakePair(0, 600), qMakePair(256, 600), qMakePair(512, 600),
+        qMakePair(600, 600) });
+    QCOMPARE(reports, expected);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testScanIsCancelledFromProgress()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testScanIsCancelledFromProgress()
+{
+    for (int i = 0; i < 600; ++i)
+    {
+        createDocument(QString("ip/component%1.xml").arg(i, 3, 10, QLatin1Char('0')), "component",
+            QString("component%1").arg(i, 3, 10, QLatin1Char('0')));
+    }
+
+    int lastReport = -1;
+
+    RecordingMediator messages;
+    LibraryLoader loader(&messages);
+    QVector<LibraryLoader::LoadTarget> targets = loader.parseLibrary([&lastReport](int scannedFiles, int)
+    {
+        lastReport = scannedFiles;
+        return scannedFiles < 256;
+    });
+
+    // The targets found before the cancellation are returned in order and nothing is reported after it.
+    QCOMPARE(lastReport, 256);
+    QCOMPARE(targets.size(), 256);
+    for (int i = 0; i < targets.size(); ++i)
+    {
+        QCOMPARE(targets.at(i).vlnv.getName(), QString("component%1").arg(i, 3, 10, QLatin1Char('0')));
+    }
+
+    // A cancelled scan does not store a partial index.
+    QCOMPARE(QFileInfo::exists(indexFilePath()), false);
+
+    // The next scan is not affected by the cancellation.
+    QCOMPARE(loader.parseLibrary().size(), 600);
+    QVERIFY(QFileInfo::exists(indexFilePath()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::testScanIsCancelledFromOtherThread()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::testScanIsCancelledFromOtherThread()
+{
+    for (int i = 0; i < 600; ++i)
+    {
+        createDocument(QString("ip/component%1.xml").arg(i), "component", QString("component%1").arg(i));
+    }
+
+    RecordingMediator messages;
+    LibraryLoader loader(&messages);
+
+    // Request the cancellation once the first progress is reported and wait for it before continuing.
+    QSemaphore progressReported;
+    QSemaphore cancelRequested;
+    QFuture<void> canceller = QtConcurrent::run([&loader, &progressReported, &cancelRequested]()
+    {
+        progressReported.acquire();
+        loader.cancelScan();
+        cancelRequested.release();
+    });
+
+    QVector<LibraryLoader::LoadTarget> targets = loader.parseLibrary(
+        [&progressReported, &cancelRequested](int scannedFiles, int)
+    {
+        if (scannedFiles == 0)
+        {
+            progressReported.release();
+            cancelRequested.acquire();
+        }
+        return true;
+    });
+
+    canceller.waitForFinished();
+
+    QVERIFY(targets.isEmpty());
+    QVERIFY(messages.errors_.isEmpty());
+    QCOMPARE(QFileInfo::exists(indexFilePath()), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::createLibrary()
+//-----------------------------------------------------------------------------
+QVector<LibraryLoader::LoadTarget> tst_LibraryLoader::createLibrary(QTemporaryDir const& secondLocation)
+{
+    QVector<LibraryLoader::LoadTarget> firstTargets;
+    QVector<LibraryLoader::LoadTarget> secondTargets;
+
+    // Enough files for several files in progress at once in each thread. The names are created in reverse,
+    // so the creation order differs from the sorted order.
+    for (int i = 299; i >= 0; --i)
+    {
+        QString name = QString("component%1").arg(i, 3, 10, QLatin1Char('0'));
+        QString path = createDocument(QString("ip/%1/%2/%1.xml").arg(name, QString::number(i % 7)),
+            "component", name);
+
+        firstTargets.append(LibraryLoader::LoadTarget(VLNV(VLNV::COMPONENT, "tut.fi", "test", name, "1.0"),
+            path));
+    }
+
+    createFile("old/old.xml", "<spirit:component/>");
+
+    // The same VLNV in both locations is returned twice, first from the first location.
+    QString secondPath = QFileInfo(secondLocation.path() + "/a/component000.xml").absoluteFilePath();
+    QDir().mkpath(QFileInfo(secondPath).absolutePath());
+
+    QFile::copy(firstTargets.last().path, secondPath);
+    QFile::copy(location_->path() + "/old/old.xml", secondLocation.path() + "/a/old.xml");
+    secondTargets.append(LibraryLoader::LoadTarget(firstTargets.last().vlnv, secondPath));
+
+    std::sort(firstTargets.begin(), firstTargets.end(),
+        [](LibraryLoader::LoadTarget const& first, LibraryLoader::LoadTarget const& second)
+    {
+        return first.path < second.path;
+    });
+
+    QSettings().setValue(QStringLiteral("Library/ActiveLocations"),
+        QStringList({ location_->path(), secondLocation.path() }));
+
+    return firstTargets + secondTargets;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::createDocument()
+//-----------------------------------------------------------------------------
+QString tst_LibraryLoader::createDocument(QString const& relativePath, QString const& type, QString const& name)
+{
+    QString content = QStringLiteral(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ipxact:%1 xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\">\n"
+        "    <ipxact:vendor>tut.fi</ipxact:vendor>\n"
+        "    <ipxact:library>test</ipxact:library>\n"
+        "    <ipxact:name>%2</ipxact:name>\n"
+        "    <ipxact:version>1.0</ipxact:version>\n"
+        "</ipxact:%1>\n").arg(type, name);
+
+    return createFile(relativePath, content.toUtf8());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::createFile()
+//-----------------------------------------------------------------------------
+QString tst_LibraryLoader::createFile(QString const& relativePath, QByteArray const& content)
+{
+    QString path = QFileInfo(location_->path() + "/" + relativePath).absoluteFilePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QFile file(path);
+    file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    file.write(content);
+    file.close();
+
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::markIndexAsOld()
+//-----------------------------------------------------------------------------
+void tst_LibraryLoader::markIndexAsOld()
+{
+    // A rewritten index gets the current time, so any rewrite replaces the old time.
+    QFile indexFile(indexFilePath());
+    QVERIFY(indexFile.open(QIODevice::ReadWrite));
+    QVERIFY(indexFile.setFileTime(oldTime_, QFileDevice::FileModificationTime));
+    indexFile.close();
+
+    QVERIFY(indexIsOld());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::indexIsOld()
+//-----------------------------------------------------------------------------
+bool tst_LibraryLoader::indexIsOld() const
+{
+    return QFileInfo(indexFilePath()).lastModified() == oldTime_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryLoader::indexFilePath()
+//-----------------------------------------------------------------------------
+QString tst_LibraryLoader::indexFilePath() const
+{
+    return ChecksummedFile::cacheFilePath(QStringLiteral("libraryIndex"), QDir(location_->path()).absolutePath(),
+        QStringLiteral(".idx"));
+}
+
+QTEST_APPLESS_MAIN(tst_LibraryLoader)
+
+#include "tst_LibraryLoader.moc"
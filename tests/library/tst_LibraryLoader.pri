@@ -0,0 +1,16 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../common/ChecksummedFile.h \
+    ../../library/DocumentFileAccess.h \
+    ../../library/DocumentStreamReader.h \
+    ../../library/LibraryIndex.h \
+    ../../library/LibraryLoader.h \
+    ../../common/ui/MessageMediator.h
+SOURCES += ../../common/ChecksummedFile.cpp \
+    ../../library/DocumentFileAccess.cpp \
+    ../../library/DocumentStreamReader.cpp \
+    ../../library/LibraryIndex.cpp \
+    ../../library/LibraryLoader.cpp \
+    ./tst_LibraryLoader.cpp
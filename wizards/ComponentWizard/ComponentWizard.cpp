@@ -22,6 +22,7 @@
 #include <editors/ComponentEditor/busInterfaces/interfaces/BusInterfaceInterface.h>
 #include <editors/ComponentEditor/busInterfaces/interfaces/BusInterfaceInterfaceFactory.h>
 #include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/common/ParameterCache.h>
 #include <editors/ComponentEditor/fileSet/interfaces/FileSetInterface.h>
 #include <editors/ComponentEditor/fileSet/interfaces/FileInterface.h>
 #include <editors/ComponentEditor/fileSet/interfaces/FileBuilderInterface.h>
@@ -42,7 +43,7 @@ ComponentWizard::ComponentWizard(QSharedPointer<Component> component, QString co
 QWizard(parent),
 originalComponent_(component),
 workingComponent_(component),
-parameterFinder_(new ComponentParameterFinder(workingComponent_)),
+parameterFinder_(new ParameterCache(workingComponent_)),
 expressionFormatter_(new ExpressionFormatter(parameterFinder_)),
 referenceCounter_(new ParameterReferenceCounter(parameterFinder_))
 {
@@ -22,6 +22,7 @@
 #include <editors/ComponentEditor/common/MultipleParameterFinder.h>
 #include <editors/ComponentEditor/common/ExpressionFormatter.h>
 #include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/common/ParameterCache.h>
 
 #include <IPXACTmodels/Component/Component.h>
 
@@ -31,7 +32,7 @@
 ImportWizard::ImportWizard(QSharedPointer<Component> component, LibraryInterface* handler, QWidget* parent):
 QWizard(parent),
 workingComponent_(new Component(*component)),
-updatingFinder_(new ComponentParameterFinder(workingComponent_)),
+updatingFinder_(new ParameterCache(workingComponent_)),
 referenceCounter_(new ParameterReferenceCounter(updatingFinder_))
 {
     QSharedPointer<MultipleParameterFinder> multiFinder(new MultipleParameterFinder());